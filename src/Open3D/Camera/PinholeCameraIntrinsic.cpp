@@ -56,6 +56,21 @@ PinholeCameraIntrinsic::PinholeCameraIntrinsic(
 
 PinholeCameraIntrinsic::~PinholeCameraIntrinsic() {}
 
+Eigen::Vector2d PinholeCameraIntrinsic::DistortNormalizedPoint(
+        const Eigen::Vector2d &point) const {
+    const double k1 = distortion_coefficients_(0);
+    const double k2 = distortion_coefficients_(1);
+    const double p1 = distortion_coefficients_(2);
+    const double p2 = distortion_coefficients_(3);
+    const double k3 = distortion_coefficients_(4);
+    const double x = point(0), y = point(1);
+    const double r2 = x * x + y * y;
+    const double radial = 1.0 + r2 * (k1 + r2 * (k2 + r2 * k3));
+    return Eigen::Vector2d(
+            x * radial + 2.0 * p1 * x * y + p2 * (r2 + 2.0 * x * x),
+            y * radial + p1 * (r2 + 2.0 * y * y) + 2.0 * p2 * x * y);
+}
+
 bool PinholeCameraIntrinsic::ConvertToJsonValue(Json::Value &value) const {
     value["width"] = width_;
     value["height"] = height_;
@@ -63,6 +78,13 @@ bool PinholeCameraIntrinsic::ConvertToJsonValue(Json::Value &value) const {
                                  value["intrinsic_matrix"]) == false) {
         return false;
     }
+    if (HasDistortion()) {
+        Json::Value &coefficients = value["distortion_coefficients"];
+        coefficients.clear();
+        for (int i = 0; i < 5; i++) {
+            coefficients.append(distortion_coefficients_(i));
+        }
+    }
     return true;
 }
 
@@ -81,6 +103,19 @@ bool PinholeCameraIntrinsic::ConvertFromJsonValue(const Json::Value &value) {
                 "PinholeCameraParameters read JSON failed: wrong format.\n");
         return false;
     }
+    distortion_coefficients_.setZero();
+    const Json::Value &coefficients = value["distortion_coefficients"];
+    if (coefficients.isNull() == false) {
+        if (coefficients.size() != 5) {
+            utility::PrintWarning(
+                    "PinholeCameraParameters read JSON failed: wrong format "
+                    "of distortion coefficients.\n");
+            return false;
+        }
+        for (int i = 0; i < 5; i++) {
+            distortion_coefficients_(i) = coefficients[i].asDouble();
+        }
+    }
     return true;
 }
 }  // namespace camera
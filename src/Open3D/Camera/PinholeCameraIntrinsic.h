@@ -69,6 +69,25 @@ public:
 
     double GetSkew() const { return intrinsic_matrix_(0, 1); }
 
+    /// Function to set the lens distortion coefficients, in the order used
+    /// by OpenCV: radial \param k1, \param k2, \param k3 and tangential
+    /// \param p1, \param p2.
+    void SetDistortion(double k1,
+                       double k2,
+                       double p1,
+                       double p2,
+                       double k3 = 0.0) {
+        distortion_coefficients_ << k1, k2, p1, p2, k3;
+    }
+
+    bool HasDistortion() const {
+        return !distortion_coefficients_.isZero(0.0);
+    }
+
+    /// Function to apply the lens distortion to a point in normalized image
+    /// coordinates, i.e. (x / z, y / z) in the camera frame.
+    Eigen::Vector2d DistortNormalizedPoint(const Eigen::Vector2d &point) const;
+
     bool IsValid() const { return (width_ > 0 && height_ > 0); }
 
     bool ConvertToJsonValue(Json::Value &value) const override;
@@ -78,6 +97,10 @@ public:
     int width_ = -1;
     int height_ = -1;
     Eigen::Matrix3d intrinsic_matrix_;
+    /// Brown-Conrady distortion coefficients (k1, k2, p1, p2, k3), all zero
+    /// for an ideal pinhole camera.
+    Eigen::Matrix<double, 5, 1> distortion_coefficients_ =
+            Eigen::Matrix<double, 5, 1>::Zero();
 };
 }  // namespace camera
 }  // namespace open3d
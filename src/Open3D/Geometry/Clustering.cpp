@@ -0,0 +1,280 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
+
+namespace open3d {
+
+namespace {
+using namespace geometry;
+
+/// Lock-free union-find (Anderson and Woll, "Wait-free Parallel Algorithms for
+/// the Union-Find Problem"). Roots are always linked to the smaller root, so
+/// the root of a set is its smallest element whatever the order of the
+/// unions.
+class ConcurrentUnionFind {
+public:
+    explicit ConcurrentUnionFind(int size) : parents_(size) {
+        for (int i = 0; i < size; i++) {
+            parents_[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    int Find(int x) {
+        int parent = parents_[x].load(std::memory_order_relaxed);
+        while (parent != x) {
+            // Path halving; losing the race only skips the shortcut.
+            int grandparent = parents_[parent].load(std::memory_order_relaxed);
+            parents_[x].compare_exchange_weak(parent, grandparent,
+                                              std::memory_order_relaxed);
+            x = grandparent;
+            parent = parents_[x].load(std::memory_order_relaxed);
+        }
+        return x;
+    }
+
+    void Union(int a, int b) {
+        while (true) {
+            a = Find(a);
+            b = Find(b);
+            if (a == b) {
+                return;
+            }
+            if (a < b) {
+                std::swap(a, b);
+            }
+            int expected = a;
+            if (parents_[a].compare_exchange_strong(expected, b)) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::vector<std::atomic<int>> parents_;
+};
+
+/// Numbers the sets of union_find containing an element with keep[i] set,
+/// in the order of their smallest element, and counts their elements. The
+/// other elements get -1.
+std::tuple<std::vector<int>, std::vector<size_t>> LabelSets(
+        ConcurrentUnionFind &union_find,
+        const std::vector<char> &keep,
+        int size) {
+    std::vector<int> roots(size);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < size; i++) {
+        roots[i] = union_find.Find(i);
+    }
+    std::vector<int> labels(size, -1);
+    std::vector<size_t> cluster_sizes;
+    for (int i = 0; i < size; i++) {
+        if (!keep[i]) {
+            continue;
+        }
+        // The root is the smallest element, it is labeled first.
+        if (roots[i] == i) {
+            labels[i] = int(cluster_sizes.size());
+            cluster_sizes.push_back(0);
+        } else {
+            labels[i] = labels[roots[i]];
+        }
+        cluster_sizes[labels[i]]++;
+    }
+    return std::make_tuple(labels, cluster_sizes);
+}
+
+}  // unnamed namespace
+
+namespace geometry {
+
+std::tuple<std::vector<int>, std::vector<size_t>> ClusterDBSCAN(
+        const PointCloud &input, double eps, size_t min_points) {
+    const int num_points = int(input.points_.size());
+    if (eps <= 0.0) {
+        utility::PrintWarning("[ClusterDBSCAN] eps must be positive.\n");
+        return std::make_tuple(std::vector<int>(num_points, -1),
+                               std::vector<size_t>());
+    }
+    KDTreeFlann kdtree(input);
+
+    // Core points.
+    std::vector<char> is_core(num_points, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_points; i++) {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        int count = kdtree.SearchRadius(input.points_[i], eps, indices,
+                                        distance2);
+        is_core[i] = size_t(count) >= min_points ? 1 : 0;
+    }
+
+    // Connect the core points within eps, and attach every border point to
+    // its nearest core point.
+    ConcurrentUnionFind union_find(num_points);
+    std::vector<char> is_clustered(is_core);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int i = 0; i < num_points; i++) {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        kdtree.SearchRadius(input.points_[i], eps, indices, distance2);
+        if (is_core[i]) {
+            for (int j : indices) {
+                if (j < i && is_core[j]) {
+                    union_find.Union(i, j);
+                }
+            }
+        } else {
+            int nearest = -1;
+            for (size_t k = 0; k < indices.size(); k++) {
+                int j = indices[k];
+                if (is_core[j] &&
+                    (nearest < 0 || distance2[k] < distance2[nearest] ||
+                     (distance2[k] == distance2[nearest] &&
+                      j < indices[nearest]))) {
+                    nearest = int(k);
+                }
+            }
+            if (nearest >= 0) {
+                union_find.Union(i, indices[nearest]);
+                is_clustered[i] = 1;
+            }
+        }
+    }
+    return LabelSets(union_find, is_clustered, num_points);
+}
+
+std::tuple<std::vector<int>, std::vector<size_t>> ClusterEuclidean(
+        const PointCloud &input,
+        double tolerance,
+        size_t min_cluster_size,
+        size_t max_cluster_size) {
+    const int num_points = int(input.points_.size());
+    if (tolerance <= 0.0) {
+        utility::PrintWarning(
+                "[ClusterEuclidean] tolerance must be positive.\n");
+        return std::make_tuple(std::vector<int>(num_points, -1),
+                               std::vector<size_t>());
+    }
+    KDTreeFlann kdtree(input);
+
+    // Every point is a core point, a single radius search per point suffices.
+    ConcurrentUnionFind union_find(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int i = 0; i < num_points; i++) {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        kdtree.SearchRadius(input.points_[i], tolerance, indices, distance2);
+        for (int j : indices) {
+            if (j < i) {
+                union_find.Union(i, j);
+            }
+        }
+    }
+    std::vector<int> labels;
+    std::vector<size_t> cluster_sizes;
+    std::tie(labels, cluster_sizes) = LabelSets(
+            union_find, std::vector<char>(num_points, 1), num_points);
+    if (min_cluster_size <= 1 &&
+        max_cluster_size == std::numeric_limits<size_t>::max()) {
+        return std::make_tuple(labels, cluster_sizes);
+    }
+    std::vector<int> new_labels(cluster_sizes.size(), -1);
+    std::vector<size_t> new_cluster_sizes;
+    for (size_t c = 0; c < cluster_sizes.size(); c++) {
+        if (cluster_sizes[c] >= min_cluster_size &&
+            cluster_sizes[c] <= max_cluster_size) {
+            new_labels[c] = int(new_cluster_sizes.size());
+            new_cluster_sizes.push_back(cluster_sizes[c]);
+        }
+    }
+    for (int &label : labels) {
+        if (label >= 0) {
+            label = new_labels[label];
+        }
+    }
+    return std::make_tuple(labels, new_cluster_sizes);
+}
+
+std::tuple<std::vector<int>, std::vector<size_t>> ClusterConnectedTriangles(
+        const TriangleMesh &mesh) {
+    const int num_triangles = int(mesh.triangles_.size());
+
+    // Sort the edges of all triangles so that the triangles sharing an edge
+    // are adjacent.
+    std::vector<std::pair<Eigen::Vector2i, int>> edges(3 * num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
+        const Eigen::Vector3i &triangle = mesh.triangles_[tidx];
+        for (int k = 0; k < 3; k++) {
+            int v0 = triangle(k);
+            int v1 = triangle((k + 1) % 3);
+            edges[3 * tidx + k] = std::make_pair(
+                    Eigen::Vector2i(std::min(v0, v1), std::max(v0, v1)),
+                    tidx);
+        }
+    }
+    utility::ParallelSort(edges.begin(), edges.end(),
+                          [](const std::pair<Eigen::Vector2i, int> &a,
+                             const std::pair<Eigen::Vector2i, int> &b) {
+                              return a.first(0) < b.first(0) ||
+                                     (a.first(0) == b.first(0) &&
+                                      a.first(1) < b.first(1));
+                          });
+
+    ConcurrentUnionFind union_find(num_triangles);
+    const int num_edges = int(edges.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int e = 1; e < num_edges; e++) {
+        if (edges[e].first == edges[e - 1].first) {
+            union_find.Union(edges[e].second, edges[e - 1].second);
+        }
+    }
+    return LabelSets(union_find, std::vector<char>(num_triangles, 1),
+                     num_triangles);
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,580 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/DistanceField.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <queue>
+#include <unordered_set>
+
+#include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+namespace {
+
+const Eigen::Vector3i kInvalidObstacle(std::numeric_limits<int>::min(), 0, 0);
+
+const int kBlockResolution = 8;
+const int kBlockVolume = kBlockResolution * kBlockResolution * kBlockResolution;
+
+/// Dense grids are indexed with int, which limits their number of voxels.
+const int64_t kMaxNumOfDenseVoxels = std::numeric_limits<int>::max();
+
+/// Number of voxels of a dense grid of size resolution, computed without
+/// overflow, -1 if a dimension is negative.
+int64_t CountVoxels(const Eigen::Vector3i &resolution) {
+    if ((resolution.array() < 0).any()) {
+        return -1;
+    }
+    return int64_t(resolution(0)) * int64_t(resolution(1)) *
+           int64_t(resolution(2));
+}
+
+int FloorDivide(int a, int b) { return a / b - (a % b < 0 ? 1 : 0); }
+
+Eigen::Vector3i BlockIndex(const Eigen::Vector3i &index) {
+    return Eigen::Vector3i(FloorDivide(index(0), kBlockResolution),
+                           FloorDivide(index(1), kBlockResolution),
+                           FloorDivide(index(2), kBlockResolution));
+}
+
+int CellOffset(const Eigen::Vector3i &index) {
+    const Eigen::Vector3i local =
+            index - BlockIndex(index) * kBlockResolution;
+    return (local(0) * kBlockResolution + local(1)) * kBlockResolution +
+           local(2);
+}
+
+std::vector<Eigen::Vector3i> CreateNeighborOffsets26() {
+    std::vector<Eigen::Vector3i> offsets;
+    for (int dx = -1; dx <= 1; dx++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dz = -1; dz <= 1; dz++) {
+                if (dx != 0 || dy != 0 || dz != 0) {
+                    offsets.push_back(Eigen::Vector3i(dx, dy, dz));
+                }
+            }
+        }
+    }
+    return offsets;
+}
+
+const std::vector<Eigen::Vector3i> kNeighborOffsets26 =
+        CreateNeighborOffsets26();
+
+/// 1D squared distance transform of f, the lower envelope of the parabolas
+/// rooted at the finite samples of f. v and z are buffers of n and n + 1
+/// elements.
+void SquaredDistanceTransform1D(
+        const float *f, int n, float *d, int *v, float *z) {
+    const float inf = std::numeric_limits<float>::infinity();
+    int k = -1;
+    for (int q = 0; q < n; q++) {
+        if (f[q] == inf) {
+            continue;
+        }
+        float s = -inf;
+        while (k >= 0) {
+            s = ((f[q] + float(q) * q) - (f[v[k]] + float(v[k]) * v[k])) /
+                (2.0f * (q - v[k]));
+            if (s > z[k]) {
+                break;
+            }
+            k--;
+        }
+        k++;
+        v[k] = q;
+        z[k] = k == 0 ? -inf : s;
+        z[k + 1] = inf;
+    }
+    if (k < 0) {
+        std::fill(d, d + n, inf);
+        return;
+    }
+    k = 0;
+    for (int q = 0; q < n; q++) {
+        while (z[k + 1] < q) {
+            k++;
+        }
+        d[q] = float(q - v[k]) * (q - v[k]) + f[v[k]];
+    }
+}
+
+}  // unnamed namespace
+
+namespace geometry {
+
+void ComputeSquaredEuclideanDistanceTransform(
+        std::vector<float> &grid, const Eigen::Vector3i &resolution) {
+    const int64_t count = CountVoxels(resolution);
+    if (count < 0 || count > kMaxNumOfDenseVoxels ||
+        int64_t(grid.size()) != count) {
+        utility::PrintWarning(
+                "[ComputeSquaredEuclideanDistanceTransform] grid does not "
+                "match the resolution.\n");
+        return;
+    }
+    const int strides[3] = {resolution(1) * resolution(2), resolution(2), 1};
+    const int num_voxels = int(count);
+    for (int axis = 0; axis < 3; axis++) {
+        const int n = resolution(axis);
+        const int stride = strides[axis];
+        const int num_lines = n > 0 ? num_voxels / n : 0;
+#ifdef _OPENMP
+#pragma omp parallel
+        {
+#endif
+            std::vector<float> f(n), d(n), z(n + 1);
+            std::vector<int> v(n);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (int line = 0; line < num_lines; line++) {
+                const int start =
+                        (line / stride) * stride * n + line % stride;
+                for (int q = 0; q < n; q++) {
+                    f[q] = grid[start + q * stride];
+                }
+                SquaredDistanceTransform1D(f.data(), n, d.data(), v.data(),
+                                           z.data());
+                for (int q = 0; q < n; q++) {
+                    grid[start + q * stride] = d[q];
+                }
+            }
+#ifdef _OPENMP
+        }
+#endif
+    }
+}
+
+const uint8_t DistanceField::VOXEL_FREE = 0;
+const uint8_t DistanceField::VOXEL_OCCUPIED = 1;
+const uint8_t DistanceField::VOXEL_UNKNOWN = 2;
+
+DistanceField::DistanceField(const Eigen::Vector3d &origin,
+                             double voxel_size,
+                             const Eigen::Vector3i &resolution)
+    : origin_(origin), voxel_size_(voxel_size) {
+    const int64_t count = CountVoxels(resolution);
+    if (count < 0 || count > kMaxNumOfDenseVoxels) {
+        utility::PrintWarning(
+                "[DistanceField] Unsupported resolution, the field is left "
+                "empty.\n");
+        return;
+    }
+    resolution_ = resolution;
+    distances_.resize(size_t(count), 0.0f);
+}
+
+void DistanceField::ComputeSignedDistances(
+        const std::vector<uint8_t> &occupancy) {
+    const int64_t count = CountVoxels(resolution_);
+    if (count > kMaxNumOfDenseVoxels || int64_t(occupancy.size()) != count) {
+        utility::PrintWarning(
+                "[DistanceField::ComputeSignedDistances] occupancy does not "
+                "match the resolution.\n");
+        return;
+    }
+    const int num_voxels = int(count);
+    const float inf = std::numeric_limits<float>::infinity();
+    std::vector<float> outside(num_voxels);
+    std::vector<float> inside(num_voxels);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_voxels; i++) {
+        outside[i] = occupancy[i] == VOXEL_OCCUPIED ? 0.0f : inf;
+        inside[i] = occupancy[i] == VOXEL_FREE ? 0.0f : inf;
+    }
+    ComputeSquaredEuclideanDistanceTransform(outside, resolution_);
+    ComputeSquaredEuclideanDistanceTransform(inside, resolution_);
+    distances_.resize(num_voxels);
+    const float voxel_size = float(voxel_size_);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_voxels; i++) {
+        bool is_inside =
+                occupancy[i] == VOXEL_OCCUPIED ||
+                (occupancy[i] == VOXEL_UNKNOWN && outside[i] < inside[i]);
+        distances_[i] = is_inside
+                                ? -(std::sqrt(inside[i]) - 0.5f) * voxel_size
+                                : (std::sqrt(outside[i]) - 0.5f) * voxel_size;
+    }
+}
+
+double DistanceField::GetDistance(const Eigen::Vector3d &point) const {
+    double distance;
+    Interpolate(point, &distance, nullptr);
+    return distance;
+}
+
+Eigen::Vector3d DistanceField::GetGradient(
+        const Eigen::Vector3d &point) const {
+    double distance;
+    Eigen::Vector3d gradient;
+    Interpolate(point, &distance, &gradient);
+    return gradient;
+}
+
+void DistanceField::Interpolate(const Eigen::Vector3d &point,
+                                double *distance,
+                                Eigen::Vector3d *gradient) const {
+    if (IsEmpty()) {
+        *distance = std::numeric_limits<double>::quiet_NaN();
+        if (gradient != nullptr) {
+            gradient->setZero();
+        }
+        return;
+    }
+    // Continuous coordinates with the voxel centers at integers.
+    Eigen::Vector3d coord = (point - origin_) / voxel_size_;
+    coord.array() -= 0.5;
+    Eigen::Vector3i i0;
+    Eigen::Vector3d t;
+    for (int k = 0; k < 3; k++) {
+        double c = std::min(std::max(coord(k), 0.0),
+                            double(resolution_(k) - 1));
+        i0(k) = std::min(int(std::floor(c)), std::max(resolution_(k) - 2, 0));
+        t(k) = resolution_(k) > 1 ? c - i0(k) : 0.0;
+    }
+    const Eigen::Vector3i max_index = resolution_ - Eigen::Vector3i::Ones();
+    Eigen::Vector3i i1 = (i0 + Eigen::Vector3i::Ones()).cwiseMin(max_index);
+    double values[2][2][2];
+    for (int dx = 0; dx < 2; dx++) {
+        for (int dy = 0; dy < 2; dy++) {
+            for (int dz = 0; dz < 2; dz++) {
+                Eigen::Vector3i index(dx ? i1(0) : i0(0), dy ? i1(1) : i0(1),
+                                      dz ? i1(2) : i0(2));
+                values[dx][dy][dz] = distances_[IndexOf(index)];
+            }
+        }
+    }
+    // Interpolate along z, then y, then x.
+    double vz[2][2];
+    for (int dx = 0; dx < 2; dx++) {
+        for (int dy = 0; dy < 2; dy++) {
+            vz[dx][dy] = values[dx][dy][0] * (1 - t(2)) +
+                         values[dx][dy][1] * t(2);
+        }
+    }
+    double vy[2];
+    for (int dx = 0; dx < 2; dx++) {
+        vy[dx] = vz[dx][0] * (1 - t(1)) + vz[dx][1] * t(1);
+    }
+    *distance = vy[0] * (1 - t(0)) + vy[1] * t(0);
+    if (gradient == nullptr) {
+        return;
+    }
+    (*gradient)(0) = vy[1] - vy[0];
+    (*gradient)(1) = (vz[0][1] - vz[0][0]) * (1 - t(0)) +
+                     (vz[1][1] - vz[1][0]) * t(0);
+    double dz[2][2];
+    for (int dx = 0; dx < 2; dx++) {
+        for (int dy = 0; dy < 2; dy++) {
+            dz[dx][dy] = values[dx][dy][1] - values[dx][dy][0];
+        }
+    }
+    (*gradient)(2) = (dz[0][0] * (1 - t(1)) + dz[0][1] * t(1)) * (1 - t(0)) +
+                     (dz[1][0] * (1 - t(1)) + dz[1][1] * t(1)) * t(0);
+    *gradient /= voxel_size_;
+}
+
+std::shared_ptr<DistanceField> CreateDistanceFieldFromVoxelGrid(
+        const VoxelGrid &voxel_grid, int padding) {
+    if (!voxel_grid.HasVoxels()) {
+        utility::PrintWarning(
+                "[CreateDistanceFieldFromVoxelGrid] voxel_grid has no "
+                "voxels.\n");
+        return std::make_shared<DistanceField>();
+    }
+    typedef Eigen::Matrix<int64_t, 3, 1> Vector3i64;
+    const int64_t pad = std::max(padding, 0);
+    Eigen::Vector3i min_voxel = voxel_grid.voxels_[0].grid_index_;
+    Eigen::Vector3i max_voxel = voxel_grid.voxels_[0].grid_index_;
+    for (const Voxel &voxel : voxel_grid.voxels_) {
+        min_voxel = min_voxel.cwiseMin(voxel.grid_index_);
+        max_voxel = max_voxel.cwiseMax(voxel.grid_index_);
+    }
+    // The bounding grid of a sparse voxel grid can be far too large for a
+    // dense field, its size is checked before any int arithmetic.
+    const Vector3i64 min_index64 = min_voxel.cast<int64_t>().array() - pad;
+    const Vector3i64 max_index64 = max_voxel.cast<int64_t>().array() + pad;
+    const Vector3i64 size64 = max_index64 - min_index64 + Vector3i64::Ones();
+    bool fits =
+            (min_index64.array() >= std::numeric_limits<int>::min()).all() &&
+            (max_index64.array() <= std::numeric_limits<int>::max()).all();
+    int64_t count = 1;
+    for (int k = 0; k < 3 && fits; k++) {
+        count *= size64(k);
+        fits = count <= kMaxNumOfDenseVoxels;
+    }
+    if (!fits) {
+        utility::PrintWarning(
+                "[CreateDistanceFieldFromVoxelGrid] The bounding grid of "
+                "voxel_grid exceeds %d voxels.\n",
+                std::numeric_limits<int>::max());
+        return std::make_shared<DistanceField>();
+    }
+    const Eigen::Vector3i min_index = min_index64.cast<int>();
+    auto field = std::make_shared<DistanceField>(
+            voxel_grid.origin_ +
+                    min_index.cast<double>() * voxel_grid.voxel_size_,
+            voxel_grid.voxel_size_, size64.cast<int>());
+    std::vector<uint8_t> occupancy(field->distances_.size(),
+                                   DistanceField::VOXEL_FREE);
+    for (const Voxel &voxel : voxel_grid.voxels_) {
+        occupancy[field->IndexOf(voxel.grid_index_ - min_index)] =
+                DistanceField::VOXEL_OCCUPIED;
+    }
+    field->ComputeSignedDistances(occupancy);
+    return field;
+}
+
+SparseDistanceField::Block::Block()
+    : cells_(kBlockVolume,
+             Cell{kInvalidObstacle, std::numeric_limits<float>::infinity()}) {}
+
+SparseDistanceField::SparseDistanceField(double voxel_size,
+                                         double max_distance)
+    : voxel_size_(voxel_size), max_distance_(max_distance) {}
+
+void SparseDistanceField::Reset() {
+    blocks_.clear();
+    cached_block_ = nullptr;
+    added_obstacles_.clear();
+    removed_obstacles_.clear();
+}
+
+void SparseDistanceField::AddObstacle(const Eigen::Vector3i &index) {
+    added_obstacles_.push_back(index);
+}
+
+void SparseDistanceField::RemoveObstacle(const Eigen::Vector3i &index) {
+    removed_obstacles_.push_back(index);
+}
+
+void SparseDistanceField::SetObstacles(const VoxelGrid &voxel_grid) {
+    std::unordered_set<Eigen::Vector3i,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            obstacles;
+    for (const Voxel &voxel : voxel_grid.voxels_) {
+        Eigen::Vector3d center =
+                voxel_grid.origin_ +
+                (voxel.grid_index_.cast<double>().array() + 0.5).matrix() *
+                        voxel_grid.voxel_size_;
+        obstacles.insert(LocateVoxel(center));
+    }
+    for (const auto &it : blocks_) {
+        const Eigen::Vector3i origin = it.first * kBlockResolution;
+        for (int i = 0; i < kBlockVolume; i++) {
+            if (it.second.cells_[i].distance_ != 0.0f) {
+                continue;
+            }
+            Eigen::Vector3i local(i / kBlockResolution / kBlockResolution,
+                                  i / kBlockResolution % kBlockResolution,
+                                  i % kBlockResolution);
+            Eigen::Vector3i index = origin + local;
+            if (obstacles.count(index) == 0) {
+                RemoveObstacle(index);
+            }
+        }
+    }
+    for (const Eigen::Vector3i &index : obstacles) {
+        if (!IsObstacle(index)) {
+            AddObstacle(index);
+        }
+    }
+}
+
+bool SparseDistanceField::IsObstacle(const Eigen::Vector3i &index) const {
+    const Cell *cell = GetCell(index);
+    return cell != nullptr && cell->distance_ == 0.0f;
+}
+
+const SparseDistanceField::Cell *SparseDistanceField::GetCell(
+        const Eigen::Vector3i &index) const {
+    auto it = blocks_.find(BlockIndex(index));
+    if (it == blocks_.end()) {
+        return nullptr;
+    }
+    return &it->second.cells_[CellOffset(index)];
+}
+
+SparseDistanceField::Cell *SparseDistanceField::FindCell(
+        const Eigen::Vector3i &index) {
+    const Eigen::Vector3i block_index = BlockIndex(index);
+    if (cached_block_ == nullptr || block_index != cached_block_index_) {
+        auto it = blocks_.find(block_index);
+        if (it == blocks_.end()) {
+            return nullptr;
+        }
+        cached_block_index_ = block_index;
+        cached_block_ = &it->second;
+    }
+    return &cached_block_->cells_[CellOffset(index)];
+}
+
+SparseDistanceField::Cell &SparseDistanceField::GetOrCreateCell(
+        const Eigen::Vector3i &index) {
+    const Eigen::Vector3i block_index = BlockIndex(index);
+    if (cached_block_ == nullptr || block_index != cached_block_index_) {
+        cached_block_index_ = block_index;
+        cached_block_ = &blocks_[block_index];
+    }
+    return cached_block_->cells_[CellOffset(index)];
+}
+
+void SparseDistanceField::Update() {
+    cached_block_ = nullptr;
+    const float inf = std::numeric_limits<float>::infinity();
+    const float max_distance = float(max_distance_ / voxel_size_);
+    typedef std::pair<float, Eigen::Vector3i> QueueEntry;
+    auto greater = [](const QueueEntry &a, const QueueEntry &b) {
+        return a.first > b.first;
+    };
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>,
+                        decltype(greater)>
+            lower_queue(greater);
+
+    // Raise wave: clear the voxels whose nearest obstacle was removed and
+    // collect the valid voxels bordering them to propagate from.
+    std::vector<Eigen::Vector3i> raise_queue;
+    for (const Eigen::Vector3i &index : removed_obstacles_) {
+        Cell *cell = FindCell(index);
+        if (cell != nullptr && cell->distance_ == 0.0f) {
+            cell->distance_ = inf;
+            cell->obstacle_ = kInvalidObstacle;
+            raise_queue.push_back(index);
+        }
+    }
+    std::unordered_set<Eigen::Vector3i,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            raised_blocks;
+    while (!raise_queue.empty()) {
+        Eigen::Vector3i index = raise_queue.back();
+        raise_queue.pop_back();
+        raised_blocks.insert(BlockIndex(index));
+        for (const Eigen::Vector3i &offset : kNeighborOffsets26) {
+            Eigen::Vector3i neighbor = index + offset;
+            Cell *cell = FindCell(neighbor);
+            if (cell == nullptr || cell->obstacle_ == kInvalidObstacle) {
+                continue;
+            }
+            if (IsObstacle(cell->obstacle_)) {
+                lower_queue.push(QueueEntry(cell->distance_, neighbor));
+            } else {
+                cell->distance_ = inf;
+                cell->obstacle_ = kInvalidObstacle;
+                raise_queue.push_back(neighbor);
+            }
+        }
+    }
+    removed_obstacles_.clear();
+
+    for (const Eigen::Vector3i &index : added_obstacles_) {
+        Cell &cell = GetOrCreateCell(index);
+        cell.obstacle_ = index;
+        cell.distance_ = 0.0f;
+        lower_queue.push(QueueEntry(0.0f, index));
+    }
+    added_obstacles_.clear();
+
+    // Lower wave: Dijkstra-like propagation of the nearest obstacles.
+    while (!lower_queue.empty()) {
+        QueueEntry entry = lower_queue.top();
+        lower_queue.pop();
+        const Cell *source = FindCell(entry.second);
+        if (source == nullptr || source->distance_ != entry.first) {
+            continue;
+        }
+        const Eigen::Vector3i obstacle = source->obstacle_;
+        for (const Eigen::Vector3i &offset : kNeighborOffsets26) {
+            Eigen::Vector3i neighbor = entry.second + offset;
+            float distance =
+                    float((neighbor - obstacle).cast<double>().norm());
+            if (distance > max_distance) {
+                continue;
+            }
+            Cell &cell = GetOrCreateCell(neighbor);
+            if (distance < cell.distance_) {
+                cell.distance_ = distance;
+                cell.obstacle_ = obstacle;
+                lower_queue.push(QueueEntry(distance, neighbor));
+            }
+        }
+    }
+
+    // Drop the blocks left without any voxel within max_distance_.
+    for (const Eigen::Vector3i &block_index : raised_blocks) {
+        auto it = blocks_.find(block_index);
+        if (it != blocks_.end() &&
+            std::all_of(it->second.cells_.begin(), it->second.cells_.end(),
+                        [](const Cell &cell) {
+                            return cell.obstacle_ == kInvalidObstacle;
+                        })) {
+            if (cached_block_ == &it->second) {
+                cached_block_ = nullptr;
+            }
+            blocks_.erase(it);
+        }
+    }
+}
+
+float SparseDistanceField::GetVoxelDistance(
+        const Eigen::Vector3i &index) const {
+    const Cell *cell = GetCell(index);
+    if (cell == nullptr || cell->obstacle_ == kInvalidObstacle) {
+        return float(max_distance_);
+    }
+    return float(std::min(cell->distance_ * voxel_size_, max_distance_));
+}
+
+double SparseDistanceField::GetDistance(const Eigen::Vector3d &point) const {
+    return GetVoxelDistance(LocateVoxel(point));
+}
+
+Eigen::Vector3d SparseDistanceField::GetGradient(
+        const Eigen::Vector3d &point) const {
+    const Eigen::Vector3i index = LocateVoxel(point);
+    Eigen::Vector3d gradient;
+    for (int k = 0; k < 3; k++) {
+        Eigen::Vector3i offset = Eigen::Vector3i::Zero();
+        offset(k) = 1;
+        gradient(k) = (GetVoxelDistance(index + offset) -
+                       GetVoxelDistance(index - offset)) /
+                      (2.0 * voxel_size_);
+    }
+    return gradient;
+}
+
+}  // namespace geometry
+}  // namespace open3d
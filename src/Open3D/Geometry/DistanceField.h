@@ -0,0 +1,200 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Open3D/Utility/Helper.h"
+
+namespace open3d {
+namespace geometry {
+
+class VoxelGrid;
+
+/// Computes in place the exact squared Euclidean distance transform of a
+/// dense grid of size resolution, stored as (x * resolution(1) + y) *
+/// resolution(2) + z. On input, grid holds 0 at the sites and infinity
+/// elsewhere; on output, the squared distance in voxels to the closest site.
+/// The transform is separable (Felzenszwalb and Huttenlocher, "Distance
+/// Transforms of Sampled Functions") and runs the 1D passes of each axis in
+/// parallel. Grids are limited to std::numeric_limits<int>::max() voxels.
+void ComputeSquaredEuclideanDistanceTransform(
+        std::vector<float> &grid, const Eigen::Vector3i &resolution);
+
+/// Dense Euclidean signed distance field on a regular grid. Voxel (x, y, z)
+/// spans from origin_ + (x, y, z) * voxel_size_ to origin_ + (x + 1, y + 1,
+/// z + 1) * voxel_size_, and distances_ holds the value at its center.
+class DistanceField {
+public:
+    DistanceField() {}
+    /// The field is left empty if resolution has more than
+    /// std::numeric_limits<int>::max() voxels.
+    DistanceField(const Eigen::Vector3d &origin,
+                  double voxel_size,
+                  const Eigen::Vector3i &resolution);
+    ~DistanceField() {}
+
+public:
+    /// Voxel states taken by ComputeSignedDistances.
+    static const uint8_t VOXEL_FREE;
+    static const uint8_t VOXEL_OCCUPIED;
+    static const uint8_t VOXEL_UNKNOWN;
+
+public:
+    bool IsEmpty() const { return distances_.empty(); }
+
+    int IndexOf(const Eigen::Vector3i &index) const {
+        return (index(0) * resolution_(1) + index(1)) * resolution_(2) +
+               index(2);
+    }
+
+    /// Sets distances_ to the signed distance to the boundary of the
+    /// occupied voxels: positive outside, negative inside. occupancy holds
+    /// VOXEL_FREE, VOXEL_OCCUPIED or VOXEL_UNKNOWN per voxel. Unknown voxels
+    /// are not part of the boundary; they are inside if the closest known
+    /// voxel is occupied, outside otherwise. Distances are measured between
+    /// voxel centers and shifted by half a voxel, so that voxels on either
+    /// side of the boundary get +/- voxel_size_ / 2. If there are no occupied
+    /// (or no free) voxels, the distances are infinite.
+    void ComputeSignedDistances(const std::vector<uint8_t> &occupancy);
+
+    /// Trilinear interpolation of the distance at point. Points outside of
+    /// the grid are clamped to its voxel centers.
+    double GetDistance(const Eigen::Vector3d &point) const;
+
+    /// Gradient of the trilinear interpolation at point, see GetDistance.
+    Eigen::Vector3d GetGradient(const Eigen::Vector3d &point) const;
+
+public:
+    Eigen::Vector3d origin_ = Eigen::Vector3d::Zero();
+    double voxel_size_ = 0.0;
+    Eigen::Vector3i resolution_ = Eigen::Vector3i::Zero();
+    std::vector<float> distances_;
+
+private:
+    void Interpolate(const Eigen::Vector3d &point,
+                     double *distance,
+                     Eigen::Vector3d *gradient) const;
+};
+
+/// Creates the signed distance field of the voxels of voxel_grid, over their
+/// bounding grid extended by padding voxels on each side. Returns an empty
+/// field if that grid has more than std::numeric_limits<int>::max() voxels.
+std::shared_ptr<DistanceField> CreateDistanceFieldFromVoxelGrid(
+        const VoxelGrid &voxel_grid, int padding = 5);
+
+/// Sparse Euclidean distance field, updated incrementally with the wavefront
+/// propagation of Lau et al., "Efficient Grid-Based Spatial Representations
+/// for Robot Navigation in Dynamic Environments" (dynamicEDT3D). Each voxel
+/// keeps its nearest obstacle voxel; adding obstacles lowers the distances
+/// around them, removing obstacles raises the distances that relied on them
+/// until the neighboring wavefronts fill the gap. Only voxels within
+/// max_distance_ of an obstacle are stored, in dense blocks of 8^3 voxels
+/// allocated on demand. Voxel (x, y, z) spans from (x, y, z) * voxel_size_ to
+/// (x + 1, y + 1, z + 1) * voxel_size_. Distances are unsigned and measured
+/// between voxel centers; propagating nearest obstacles between neighbors
+/// makes them approximate in rare configurations.
+class SparseDistanceField {
+public:
+    struct Cell {
+        /// Index of the nearest obstacle voxel.
+        Eigen::Vector3i obstacle_;
+        /// Distance to obstacle_ in voxels, infinity if there is none.
+        float distance_;
+    };
+
+    struct Block {
+        Block();
+        /// Cells stored as (x * 8 + y) * 8 + z in block coordinates.
+        std::vector<Cell> cells_;
+    };
+
+public:
+    SparseDistanceField(double voxel_size, double max_distance);
+    ~SparseDistanceField() {}
+
+public:
+    void Reset();
+
+    /// Queues the voxel index as a new obstacle, see Update.
+    void AddObstacle(const Eigen::Vector3i &index);
+
+    /// Queues the removal of the obstacle at voxel index, see Update.
+    void RemoveObstacle(const Eigen::Vector3i &index);
+
+    /// Queues the changes making the obstacles equal to the voxels of
+    /// voxel_grid, each mapped to the voxel containing its center.
+    void SetObstacles(const VoxelGrid &voxel_grid);
+
+    /// Propagates the queued changes.
+    void Update();
+
+    bool IsObstacle(const Eigen::Vector3i &index) const;
+
+    /// Returns the cell of voxel index, nullptr if it is not stored.
+    const Cell *GetCell(const Eigen::Vector3i &index) const;
+
+    /// Distance of the voxel containing point to the closest obstacle,
+    /// max_distance_ if it is further away.
+    double GetDistance(const Eigen::Vector3d &point) const;
+
+    /// Central difference gradient of the voxel distances at point.
+    Eigen::Vector3d GetGradient(const Eigen::Vector3d &point) const;
+
+    Eigen::Vector3i LocateVoxel(const Eigen::Vector3d &point) const {
+        return Eigen::Vector3i((int)std::floor(point(0) / voxel_size_),
+                               (int)std::floor(point(1) / voxel_size_),
+                               (int)std::floor(point(2) / voxel_size_));
+    }
+
+public:
+    double voxel_size_;
+    double max_distance_;
+    std::unordered_map<Eigen::Vector3i,
+                       Block,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            blocks_;
+
+private:
+    Cell *FindCell(const Eigen::Vector3i &index);
+    Cell &GetOrCreateCell(const Eigen::Vector3i &index);
+    float GetVoxelDistance(const Eigen::Vector3i &index) const;
+
+    std::vector<Eigen::Vector3i> added_obstacles_;
+    std::vector<Eigen::Vector3i> removed_obstacles_;
+
+    /// Last block accessed by FindCell and GetOrCreateCell during Update,
+    /// neighboring voxels mostly share it.
+    Eigen::Vector3i cached_block_index_;
+    Block *cached_block_ = nullptr;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -25,6 +25,9 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
@@ -77,12 +80,76 @@ Eigen::Vector3d FastEigen3x3(const Eigen::Matrix3d &A) {
     }
 }
 
+/// Function to compute the eigenvector of the smallest eigenvalue of the
+/// positive semi-definite matrix \param A without trigonometry.
+/// The eigenvalue is the smallest root of the characteristic polynomial,
+/// increasing and concave below it, so that Newton's method started from 0
+/// converges to it monotonically. The eigenvector is then the largest cross
+/// product of two rows of A - lambda I.
+Eigen::Vector3d FastSmallestEigenvector3x3(const Eigen::Matrix3d &A) {
+    const double c2 = A.trace();
+    const double c1 = A(0, 0) * A(1, 1) + A(0, 0) * A(2, 2) +
+                      A(1, 1) * A(2, 2) - sqr(A(0, 1)) - sqr(A(0, 2)) -
+                      sqr(A(1, 2));
+    const double c0 = A.determinant();
+    double lambda = 0.0;
+    for (int i = 0; i < 16; i++) {
+        const double f = ((lambda - c2) * lambda + c1) * lambda - c0;
+        const double df = (3.0 * lambda - 2.0 * c2) * lambda + c1;
+        if (f >= 0.0 || df <= 0.0) {
+            break;
+        }
+        const double step = f / df;
+        lambda -= step;
+        if (-step <= 1e-12 * c2) {
+            break;
+        }
+    }
+    const Eigen::Matrix3d B = A - lambda * Eigen::Matrix3d::Identity();
+    const Eigen::Vector3d r0 = B.row(0);
+    const Eigen::Vector3d r1 = B.row(1);
+    const Eigen::Vector3d r2 = B.row(2);
+    Eigen::Vector3d eigenvector = r0.cross(r1);
+    double len2 = eigenvector.squaredNorm();
+    const Eigen::Vector3d e02 = r0.cross(r2);
+    if (e02.squaredNorm() > len2) {
+        eigenvector = e02;
+        len2 = e02.squaredNorm();
+    }
+    const Eigen::Vector3d e12 = r1.cross(r2);
+    if (e12.squaredNorm() > len2) {
+        eigenvector = e12;
+        len2 = e12.squaredNorm();
+    }
+    if (len2 == 0.0) {
+        return Eigen::Vector3d::Zero();
+    } else {
+        return eigenvector / std::sqrt(len2);
+    }
+}
+
+/// Function to compute the covariance matrix from the means of x, y, z, xx,
+/// xy, xz, yy, yz and zz of a neighbourhood.
+Eigen::Matrix3d ComputeCovariance(
+        const Eigen::Matrix<double, 9, 1> &cumulants) {
+    Eigen::Matrix3d covariance;
+    covariance(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
+    covariance(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
+    covariance(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
+    covariance(0, 1) = cumulants(4) - cumulants(0) * cumulants(1);
+    covariance(1, 0) = covariance(0, 1);
+    covariance(0, 2) = cumulants(5) - cumulants(0) * cumulants(2);
+    covariance(2, 0) = covariance(0, 2);
+    covariance(1, 2) = cumulants(7) - cumulants(1) * cumulants(2);
+    covariance(2, 1) = covariance(1, 2);
+    return covariance;
+}
+
 Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
                               const std::vector<int> &indices) {
     if (indices.size() == 0) {
         return Eigen::Vector3d::Zero();
     }
-    Eigen::Matrix3d covariance;
     Eigen::Matrix<double, 9, 1> cumulants;
     cumulants.setZero();
     for (size_t i = 0; i < indices.size(); i++) {
@@ -98,22 +165,182 @@ Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
         cumulants(8) += point(2) * point(2);
     }
     cumulants /= (double)indices.size();
-    covariance(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
-    covariance(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
-    covariance(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
-    covariance(0, 1) = cumulants(4) - cumulants(0) * cumulants(1);
-    covariance(1, 0) = covariance(0, 1);
-    covariance(0, 2) = cumulants(5) - cumulants(0) * cumulants(2);
-    covariance(2, 0) = covariance(0, 2);
-    covariance(1, 2) = cumulants(7) - cumulants(1) * cumulants(2);
-    covariance(2, 1) = covariance(1, 2);
 
-    return FastEigen3x3(covariance);
+    return FastEigen3x3(ComputeCovariance(cumulants));
     // Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
-    // solver.compute(covariance, Eigen::ComputeEigenvectors);
+    // solver.compute(ComputeCovariance(cumulants), Eigen::ComputeEigenvectors);
     // return solver.eigenvectors().col(0);
 }
 
+/// Number of values per pixel of the integral image of an organised point
+/// cloud: the count of valid points, then the sums of x, y, z, xx, xy, xz,
+/// yy, yz and zz.
+const int kNumOfIntegralValues = 10;
+
+/// Summed-area table of the moments of the valid points of an organised
+/// point cloud, relative to \param origin to limit cancellation.
+class IntegralMoments {
+public:
+    IntegralMoments(const PointCloud &cloud,
+                    int width,
+                    int height,
+                    const Eigen::Vector3d &origin)
+        : width_(width),
+          values_(size_t(width + 1) * size_t(height + 1) *
+                          kNumOfIntegralValues,
+                  0.0) {
+        const int row_size = (width + 1) * kNumOfIntegralValues;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int v = 0; v < height; v++) {
+            double *row = values_.data() + size_t(v + 1) * row_size;
+            double sum[kNumOfIntegralValues] = {0.0};
+            for (int u = 0; u < width; u++) {
+                const Eigen::Vector3d &point =
+                        cloud.points_[size_t(v) * width + u];
+                if (!std::isnan(point(0))) {
+                    const Eigen::Vector3d p = point - origin;
+                    sum[0] += 1.0;
+                    sum[1] += p(0);
+                    sum[2] += p(1);
+                    sum[3] += p(2);
+                    sum[4] += p(0) * p(0);
+                    sum[5] += p(0) * p(1);
+                    sum[6] += p(0) * p(2);
+                    sum[7] += p(1) * p(1);
+                    sum[8] += p(1) * p(2);
+                    sum[9] += p(2) * p(2);
+                }
+                double *value = row + (u + 1) * kNumOfIntegralValues;
+                for (int k = 0; k < kNumOfIntegralValues; k++) {
+                    value[k] = sum[k];
+                }
+            }
+        }
+        for (int v = 1; v < height; v++) {
+            const double *previous = values_.data() + size_t(v) * row_size;
+            double *row = values_.data() + size_t(v + 1) * row_size;
+            for (int k = 0; k < row_size; k++) {
+                row[k] += previous[k];
+            }
+        }
+    }
+
+    /// Function to sum the moments of the pixels in [u0, u1) x [v0, v1).
+    void Sum(int u0,
+             int v0,
+             int u1,
+             int v1,
+             double sum[kNumOfIntegralValues]) const {
+        const double *a = At(u0, v0);
+        const double *b = At(u1, v0);
+        const double *c = At(u0, v1);
+        const double *d = At(u1, v1);
+        for (int k = 0; k < kNumOfIntegralValues; k++) {
+            sum[k] = d[k] - b[k] - c[k] + a[k];
+        }
+    }
+
+private:
+    const double *At(int u, int v) const {
+        return values_.data() +
+               (size_t(v) * (width_ + 1) + u) * kNumOfIntegralValues;
+    }
+
+private:
+    int width_;
+    std::vector<double> values_;
+};
+
+/// Function to flag the points of an organised point cloud that have a
+/// 4-neighbour across a depth discontinuity, i.e. further away than
+/// \param max_depth_change_factor times the smaller of their distances to
+/// \param camera_location.
+std::vector<uint8_t> ComputeDepthDiscontinuities(
+        const PointCloud &cloud,
+        int width,
+        int height,
+        const Eigen::Vector3d &camera_location,
+        double max_depth_change_factor) {
+    const auto &points = cloud.points_;
+    const double factor2 = max_depth_change_factor * max_depth_change_factor;
+    std::vector<double> distances2(points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        distances2[i] = (points[i] - camera_location).squaredNorm();
+    }
+    const int offsets[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+    std::vector<uint8_t> discontinuities(points.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            const size_t i = size_t(v) * width + u;
+            if (std::isnan(distances2[i])) {
+                continue;
+            }
+            for (int k = 0; k < 4; k++) {
+                const int un = u + offsets[k][0];
+                const int vn = v + offsets[k][1];
+                if (un < 0 || un >= width || vn < 0 || vn >= height) {
+                    continue;
+                }
+                const size_t j = size_t(vn) * width + un;
+                // The comparison is false for invalid neighbours.
+                if ((points[j] - points[i]).squaredNorm() >
+                    factor2 * std::min(distances2[i], distances2[j])) {
+                    discontinuities[i] = 1;
+                    break;
+                }
+            }
+        }
+    }
+    return discontinuities;
+}
+
+/// Function to compute the chessboard distance from each pixel to the
+/// nearest flagged one, clamped to \param max_distance, with the two-pass
+/// chamfer transform.
+std::vector<int> ComputeChessboardDistances(const std::vector<uint8_t> &flags,
+                                            int width,
+                                            int height,
+                                            int max_distance) {
+    std::vector<int> distances(flags.size());
+    for (size_t i = 0; i < flags.size(); i++) {
+        distances[i] = flags[i] ? 0 : max_distance;
+    }
+    for (int v = 0; v < height; v++) {
+        int *row = distances.data() + size_t(v) * width;
+        const int *previous = v > 0 ? row - width : nullptr;
+        for (int u = 0; u < width; u++) {
+            int d = row[u];
+            if (u > 0) d = std::min(d, row[u - 1] + 1);
+            if (previous) {
+                d = std::min(d, previous[u] + 1);
+                if (u > 0) d = std::min(d, previous[u - 1] + 1);
+                if (u + 1 < width) d = std::min(d, previous[u + 1] + 1);
+            }
+            row[u] = d;
+        }
+    }
+    for (int v = height - 1; v >= 0; v--) {
+        int *row = distances.data() + size_t(v) * width;
+        const int *next = v + 1 < height ? row + width : nullptr;
+        for (int u = width - 1; u >= 0; u--) {
+            int d = row[u];
+            if (u + 1 < width) d = std::min(d, row[u + 1] + 1);
+            if (next) {
+                d = std::min(d, next[u] + 1);
+                if (u > 0) d = std::min(d, next[u - 1] + 1);
+                if (u + 1 < width) d = std::min(d, next[u + 1] + 1);
+            }
+            row[u] = d;
+        }
+    }
+    return distances;
+}
+
 }  // unnamed namespace
 
 namespace geometry {
@@ -156,6 +383,139 @@ bool EstimateNormals(
     return true;
 }
 
+bool EstimateNormalsOrganised(
+        PointCloud &cloud,
+        int width,
+        int height,
+        int half_window_size /* = 3*/,
+        double max_depth_change_factor /* = 0.02*/,
+        const Eigen::Vector3d &camera_location /* = Eigen::Vector3d::Zero()*/) {
+    if (width <= 0 || height <= 0 ||
+        cloud.points_.size() != size_t(width) * size_t(height)) {
+        utility::PrintWarning(
+                "[EstimateNormalsOrganised] The point cloud is not organised "
+                "as a %d x %d image.\n",
+                width, height);
+        return false;
+    }
+    if (half_window_size < 1) {
+        utility::PrintWarning(
+                "[EstimateNormalsOrganised] Invalid half window size %d.\n",
+                half_window_size);
+        return false;
+    }
+    bool has_normal = cloud.HasNormals();
+    if (cloud.HasNormals() == false) {
+        cloud.normals_.resize(cloud.points_.size());
+    }
+    const auto &points = cloud.points_;
+
+    // A window of half size r around a pixel crosses no discontinuity if it
+    // contains no flagged pixel, i.e. if r is less than the chessboard
+    // distance to the nearest one.
+    auto discontinuities = ComputeDepthDiscontinuities(
+            cloud, width, height, camera_location, max_depth_change_factor);
+    auto distances = ComputeChessboardDistances(discontinuities, width,
+                                                height, half_window_size + 1);
+    Eigen::Vector3d origin = Eigen::Vector3d::Zero();
+    size_t num_of_valid = 0;
+    for (const auto &point : points) {
+        if (!std::isnan(point(0))) {
+            origin += point;
+            num_of_valid++;
+        }
+    }
+    if (num_of_valid > 0) {
+        origin /= double(num_of_valid);
+    }
+    IntegralMoments moments(cloud, width, height, origin);
+
+    // Neighbour of pixel i at offset (du, dv) on the same surface, if any.
+    auto get_neighbour = [&](int u, int v, int du, int dv,
+                             const Eigen::Vector3d *&neighbour) {
+        const int un = u + du;
+        const int vn = v + dv;
+        if (un < 0 || un >= width || vn < 0 || vn >= height) {
+            return false;
+        }
+        const size_t i = size_t(v) * width + u;
+        const size_t j = size_t(vn) * width + un;
+        if (std::isnan(points[j](0)) ||
+            (discontinuities[i] &&
+             (points[j] - points[i]).norm() >
+                     max_depth_change_factor *
+                             std::min((points[i] - camera_location).norm(),
+                                      (points[j] - camera_location).norm()))) {
+            return false;
+        }
+        neighbour = &points[j];
+        return true;
+    };
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            const size_t i = size_t(v) * width + u;
+            const Eigen::Vector3d &point = points[i];
+            if (std::isnan(point(0))) {
+                cloud.normals_[i] = Eigen::Vector3d(nan, nan, nan);
+                continue;
+            }
+            Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+            const int r = std::min(half_window_size, distances[i] - 1);
+            if (r >= 1) {
+                double sum[kNumOfIntegralValues];
+                moments.Sum(std::max(u - r, 0), std::max(v - r, 0),
+                            std::min(u + r + 1, width),
+                            std::min(v + r + 1, height), sum);
+                if (sum[0] >= 3.0) {
+                    Eigen::Matrix<double, 9, 1> cumulants;
+                    for (int k = 0; k < 9; k++) {
+                        cumulants(k) = sum[k + 1] / sum[0];
+                    }
+                    normal = FastSmallestEigenvector3x3(
+                            ComputeCovariance(cumulants));
+                }
+            }
+            if (normal.norm() == 0.0) {
+                // Close to discontinuities, cross product of the tangents to
+                // the neighbours on the same surface.
+                const Eigen::Vector3d *right = &point, *left = &point;
+                const Eigen::Vector3d *down = &point, *up = &point;
+                bool has_du = get_neighbour(u, v, 1, 0, right) |
+                              get_neighbour(u, v, -1, 0, left);
+                bool has_dv = get_neighbour(u, v, 0, 1, down) |
+                              get_neighbour(u, v, 0, -1, up);
+                if (has_du && has_dv) {
+                    normal = (*right - *left).cross(*down - *up);
+                    if (normal.norm() != 0.0) {
+                        normal.normalize();
+                    }
+                }
+            }
+            if (normal.norm() == 0.0) {
+                if (has_normal) {
+                    normal = cloud.normals_[i];
+                } else {
+                    normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+                }
+            }
+            if (has_normal) {
+                if (normal.dot(cloud.normals_[i]) < 0.0) {
+                    normal *= -1.0;
+                }
+            } else if (normal.dot(camera_location - point) < 0.0) {
+                normal *= -1.0;
+            }
+            cloud.normals_[i] = normal;
+        }
+    }
+    return true;
+}
+
 bool OrientNormalsToAlignWithDirection(
         PointCloud &cloud, const Eigen::Vector3d &orientation_reference
         /* = Eigen::Vector3d(0.0, 0.0, 1.0)*/) {
@@ -47,115 +47,132 @@ void HalfEdgeTriangleMesh::Clear() {
     ordered_half_edge_from_vertex_.clear();
 }
 
+HalfEdgeTriangleMesh::HalfEdgeCirculator::Iterator &HalfEdgeTriangleMesh::
+        HalfEdgeCirculator::Iterator::operator++() {
+    const HalfEdgeCirculator &c = *circulator_;
+    int next_index = c.type_ == CirculatorType::OneRing
+                             ? c.mesh_.NextHalfEdgeFromVertex(half_edge_index_)
+                             : c.mesh_.NextHalfEdgeOnBoundary(half_edge_index_);
+    half_edge_index_ = next_index == c.first_ ? -1 : next_index;
+    return *this;
+}
+
 bool HalfEdgeTriangleMesh::ComputeHalfEdges() {
     // Clean up half-edge related data structures
     half_edges_.clear();
     ordered_half_edge_from_vertex_.clear();
 
-    // Collect half edges
-    // Check: for valid manifolds, there mustn't be duplicated half-edges
-    std::unordered_map<Eigen::Vector2i, size_t,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            vertex_indices_to_half_edge_index;
-
-    for (size_t triangle_index = 0; triangle_index < triangles_.size();
+    // Collect half edges, half edge 3 * t + k belongs to triangle t
+    int triangle_num = int(triangles_.size());
+    half_edges_.resize(3 * triangle_num);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int triangle_index = 0; triangle_index < triangle_num;
          triangle_index++) {
         const Eigen::Vector3i& triangle = triangles_[triangle_index];
-        size_t num_half_edges = half_edges_.size();
-
-        size_t he_0_index = num_half_edges;
-        size_t he_1_index = num_half_edges + 1;
-        size_t he_2_index = num_half_edges + 2;
-        HalfEdge he_0(Eigen::Vector2i(triangle(0), triangle(1)), triangle_index,
-                      he_1_index, -1);
-        HalfEdge he_1(Eigen::Vector2i(triangle(1), triangle(2)), triangle_index,
-                      he_2_index, -1);
-        HalfEdge he_2(Eigen::Vector2i(triangle(2), triangle(0)), triangle_index,
-                      he_0_index, -1);
-
-        if (vertex_indices_to_half_edge_index.find(he_0.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_1.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_2.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            utility::PrintError(
-                    "ComputeHalfEdges failed. Duplicated half-edges.\n");
-            return false;
+        for (int k = 0; k < 3; ++k) {
+            half_edges_[3 * triangle_index + k] = HalfEdge(
+                    Eigen::Vector2i(triangle(k), triangle((k + 1) % 3)),
+                    triangle_index, 3 * triangle_index + (k + 1) % 3, -1);
         }
-
-        half_edges_.push_back(he_0);
-        half_edges_.push_back(he_1);
-        half_edges_.push_back(he_2);
-        vertex_indices_to_half_edge_index[he_0.vertex_indices_] = he_0_index;
-        vertex_indices_to_half_edge_index[he_1.vertex_indices_] = he_1_index;
-        vertex_indices_to_half_edge_index[he_2.vertex_indices_] = he_2_index;
     }
 
-    // Fill twin half-edge. In the previous step, it is already guaranteed that
-    // each half-edge can have at most one twin half-edge.
-    for (size_t this_he_index = 0; this_he_index < half_edges_.size();
-         this_he_index++) {
-        HalfEdge& this_he = half_edges_[this_he_index];
-        Eigen::Vector2i twin_end_points(this_he.vertex_indices_(1),
-                                        this_he.vertex_indices_(0));
-        if (this_he.twin_ == -1 &&
-            vertex_indices_to_half_edge_index.find(twin_end_points) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            size_t twin_he_index =
-                    vertex_indices_to_half_edge_index[twin_end_points];
-            HalfEdge& twin_he = half_edges_[twin_he_index];
-            this_he.twin_ = int(twin_he_index);
-            twin_he.twin_ = int(this_he_index);
+    // Fill twin half-edges. The half edges of the same edge are contiguous
+    // in the sorted half edges. Check: for valid manifolds, there mustn't be
+    // duplicated half-edges, i.e., an edge has at most two half edges with
+    // opposite directions.
+    std::vector<Eigen::Vector3i> sorted_half_edges = GetSortedHalfEdges();
+    int half_edge_num = int(sorted_half_edges.size());
+    int num_duplicated = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : num_duplicated)
+#endif
+    for (int sidx = 0; sidx < half_edge_num; ++sidx) {
+        if (sidx > 0 && sorted_half_edges[sidx].head<2>() ==
+                                sorted_half_edges[sidx - 1].head<2>()) {
+            continue;
+        }
+        int send = sidx + 1;
+        while (send < half_edge_num &&
+               sorted_half_edges[send].head<2>() ==
+                       sorted_half_edges[sidx].head<2>()) {
+            send++;
+        }
+        if (send - sidx == 2) {
+            HalfEdge& he_0 = half_edges_[sorted_half_edges[sidx](2)];
+            HalfEdge& he_1 = half_edges_[sorted_half_edges[sidx + 1](2)];
+            if (he_0.vertex_indices_ == he_1.vertex_indices_) {
+                num_duplicated++;
+            } else {
+                he_0.twin_ = sorted_half_edges[sidx + 1](2);
+                he_1.twin_ = sorted_half_edges[sidx](2);
+            }
+        } else if (send - sidx > 2) {
+            num_duplicated++;
         }
     }
+    if (num_duplicated > 0) {
+        half_edges_.clear();
+        utility::PrintError(
+                "ComputeHalfEdges failed. Duplicated half-edges.\n");
+        return false;
+    }
 
-    // Get out-going half-edges from each vertex. This can be done during
-    // half-edge construction. Done here for readability.
-    std::vector<std::vector<int>> half_edges_from_vertex(vertices_.size());
-    for (size_t half_edge_index = 0; half_edge_index < half_edges_.size();
+    // Get the number of out-going half-edges from each vertex and the
+    // half-edge to start the traversal with. To be a valid manifold, there
+    // can be at most 1 boundary half-edge from each vertex. If there is a
+    // boundary edge, start from that; otherwise start with any half-edge
+    // started from this vertex.
+    int vertex_num = int(vertices_.size());
+    std::vector<int> num_half_edges_from_vertex(vertex_num, 0);
+    std::vector<int> num_boundaries(vertex_num, 0);
+    std::vector<int> init_half_edge_index(vertex_num, -1);
+    for (int half_edge_index = 0; half_edge_index < int(half_edges_.size());
          half_edge_index++) {
-        int src_vertex_index = half_edges_[half_edge_index].vertex_indices_(0);
-        half_edges_from_vertex[src_vertex_index].push_back(
-                int(half_edge_index));
+        const HalfEdge& he = half_edges_[half_edge_index];
+        int src_vertex_index = he.vertex_indices_(0);
+        num_half_edges_from_vertex[src_vertex_index]++;
+        if (he.IsBoundary()) {
+            num_boundaries[src_vertex_index]++;
+            init_half_edge_index[src_vertex_index] = half_edge_index;
+        } else if (init_half_edge_index[src_vertex_index] == -1) {
+            init_half_edge_index[src_vertex_index] = half_edge_index;
+        }
     }
 
-    // Find ordered half-edges from each vertex by traversal. To be a valid
-    // manifold, there can be at most 1 boundary half-edge from each vertex.
-    ordered_half_edge_from_vertex_.resize(vertices_.size());
-    for (size_t vertex_index = 0; vertex_index < vertices_.size();
-         vertex_index++) {
-        size_t num_boundaries = 0;
-        int init_half_edge_index = 0;
-        for (const int& half_edge_index :
-             half_edges_from_vertex[vertex_index]) {
-            if (bool is_boundary = half_edges_[half_edge_index].IsBoundary()) {
-                num_boundaries++;
-                init_half_edge_index = half_edge_index;
-            }
-        }
-        if (num_boundaries > 1) {
-            utility::PrintError("ComputeHalfEdges failed. Invalid vertex.\n");
-            return false;
+    // Find ordered half-edges from each vertex by traversal. A manifold
+    // vertex reaches all its out-going half-edges.
+    ordered_half_edge_from_vertex_.resize(vertex_num);
+    int num_invalid = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : num_invalid)
+#endif
+    for (int vertex_index = 0; vertex_index < vertex_num; vertex_index++) {
+        if (num_boundaries[vertex_index] > 1) {
+            num_invalid++;
+            continue;
         }
-        // If there is a boundary edge, start from that; otherwise start
-        // with any half-edge (default 0) started from this vertex.
-        if (num_boundaries == 0) {
-            init_half_edge_index = half_edges_from_vertex[vertex_index][0];
+        std::vector<int>& ordered_half_edges =
+                ordered_half_edge_from_vertex_[vertex_index];
+        ordered_half_edges.reserve(num_half_edges_from_vertex[vertex_index]);
+        HalfEdgeCirculator one_ring(*this,
+                                    HalfEdgeCirculator::CirculatorType::OneRing,
+                                    init_half_edge_index[vertex_index]);
+        for (int half_edge_index : one_ring) {
+            ordered_half_edges.push_back(half_edge_index);
         }
-
-        // Push edges to ordered_half_edge_from_vertex_.
-        int curr_he_index = init_half_edge_index;
-        ordered_half_edge_from_vertex_[vertex_index].push_back(curr_he_index);
-        int next_next_twin_he_index = NextHalfEdgeFromVertex(curr_he_index);
-        curr_he_index = next_next_twin_he_index;
-        while (curr_he_index != -1 && curr_he_index != init_half_edge_index) {
-            ordered_half_edge_from_vertex_[vertex_index].push_back(
-                    curr_he_index);
-            next_next_twin_he_index = NextHalfEdgeFromVertex(curr_he_index);
-            curr_he_index = next_next_twin_he_index;
+        if (int(ordered_half_edges.size()) !=
+            num_half_edges_from_vertex[vertex_index]) {
+            num_invalid++;
         }
     }
+    if (num_invalid > 0) {
+        half_edges_.clear();
+        ordered_half_edge_from_vertex_.clear();
+        utility::PrintError("ComputeHalfEdges failed. Invalid vertex.\n");
+        return false;
+    }
     return true;
 }
 
@@ -186,12 +203,8 @@ std::vector<int> HalfEdgeTriangleMesh::BoundaryHalfEdgesFromVertex(
     }
 
     std::vector<int> boundary_half_edge_indices;
-    int curr_he_index = init_he_index;
-    boundary_half_edge_indices.push_back(curr_he_index);
-    curr_he_index = NextHalfEdgeOnBoundary(curr_he_index);
-    while (curr_he_index != init_he_index && curr_he_index != -1) {
-        boundary_half_edge_indices.push_back(curr_he_index);
-        curr_he_index = NextHalfEdgeOnBoundary(curr_he_index);
+    for (int he_index : BoundaryLoopHalfEdges(init_he_index)) {
+        boundary_half_edge_indices.push_back(he_index);
     }
     return boundary_half_edge_indices;
 }
@@ -210,28 +223,46 @@ std::vector<int> HalfEdgeTriangleMesh::BoundaryVerticesFromVertex(
 
 std::vector<std::vector<int>> HalfEdgeTriangleMesh::GetBoundaries() const {
     std::vector<std::vector<int>> boundaries;
-    std::unordered_set<int> visited;
+    std::vector<bool> visited(vertices_.size(), false);
 
     for (int vertex_ind = 0; vertex_ind < int(vertices_.size()); ++vertex_ind) {
-        if (visited.find(vertex_ind) != visited.end()) {
+        if (visited[vertex_ind] ||
+            ordered_half_edge_from_vertex_[vertex_ind].empty()) {
             continue;
         }
         // It is guaranteed that if a vertex in on boundary, the starting
-        // edge must be on boundary. After purging, it's also guaranteed that
-        // a vertex always have out-going half-edges after purging.
+        // edge must be on boundary.
         int first_half_edge_ind = ordered_half_edge_from_vertex_[vertex_ind][0];
         if (half_edges_[first_half_edge_ind].IsBoundary()) {
-            std::vector<int> boundary = BoundaryVerticesFromVertex(vertex_ind);
-            boundaries.push_back(boundary);
-            for (int boundary_vertex : boundary) {
-                visited.insert(boundary_vertex);
+            std::vector<int> boundary;
+            for (int he_index : BoundaryLoopHalfEdges(first_half_edge_ind)) {
+                int boundary_vertex = half_edges_[he_index].vertex_indices_(0);
+                boundary.push_back(boundary_vertex);
+                visited[boundary_vertex] = true;
             }
+            boundaries.push_back(boundary);
         }
-        visited.insert(vertex_ind);
+        visited[vertex_ind] = true;
     }
     return boundaries;
 }
 
+HalfEdgeTriangleMesh::HalfEdgeCirculator
+HalfEdgeTriangleMesh::OneRingHalfEdges(int vertex_index) const {
+    const std::vector<int>& ordered_half_edges =
+            ordered_half_edge_from_vertex_[vertex_index];
+    return HalfEdgeCirculator(
+            *this, HalfEdgeCirculator::CirculatorType::OneRing,
+            ordered_half_edges.empty() ? -1 : ordered_half_edges[0]);
+}
+
+HalfEdgeTriangleMesh::HalfEdgeCirculator
+HalfEdgeTriangleMesh::BoundaryLoopHalfEdges(int half_edge_index) const {
+    return HalfEdgeCirculator(*this,
+                              HalfEdgeCirculator::CirculatorType::BoundaryLoop,
+                              half_edge_index);
+}
+
 int HalfEdgeTriangleMesh::NextHalfEdgeOnBoundary(
         int curr_half_edge_index) const {
     if (!HasHalfEdges() || curr_half_edge_index >= half_edges_.size() ||
@@ -290,9 +321,10 @@ std::shared_ptr<HalfEdgeTriangleMesh> CreateHalfEdgeMeshFromMesh(
     return half_edge_mesh;
 }
 
-void HalfEdgeTriangleMesh::RemoveDuplicatedVertices() {
+void HalfEdgeTriangleMesh::RemoveDuplicatedVertices(
+        double eps /* = 0.0 */) {
     size_t before_num = vertices_.size();
-    TriangleMesh::RemoveDuplicatedVertices();
+    TriangleMesh::RemoveDuplicatedVertices(eps);
     if (HasHalfEdges() && vertices_.size() != before_num) {
         ComputeHalfEdges();
     }
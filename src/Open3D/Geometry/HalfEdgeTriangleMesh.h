@@ -27,7 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
-#include <unordered_map>
+#include <vector>
 
 #include "Open3D/Geometry/Geometry3D.h"
 #include "Open3D/Geometry/TriangleMesh.h"
@@ -57,12 +57,54 @@ public:
         int triangle_index_ = -1;
     };
 
+    /// Forward range over half-edge indices that circulates either around a
+    /// vertex (one-ring) or along a boundary loop. The traversal stops when
+    /// the first half-edge is reached again or when it hits a boundary.
+    /// Usage: for (int he : mesh.OneRingHalfEdges(vertex_index)) { ... }
+    class HalfEdgeCirculator {
+    public:
+        enum class CirculatorType { OneRing, BoundaryLoop };
+
+        class Iterator {
+        public:
+            Iterator(const HalfEdgeCirculator *circulator, int half_edge_index)
+                : circulator_(circulator), half_edge_index_(half_edge_index) {}
+            int operator*() const { return half_edge_index_; }
+            Iterator &operator++();
+            bool operator==(const Iterator &other) const {
+                return half_edge_index_ == other.half_edge_index_;
+            }
+            bool operator!=(const Iterator &other) const {
+                return half_edge_index_ != other.half_edge_index_;
+            }
+
+        private:
+            const HalfEdgeCirculator *circulator_;
+            int half_edge_index_;
+        };
+
+    public:
+        HalfEdgeCirculator(const HalfEdgeTriangleMesh &mesh,
+                           CirculatorType type,
+                           int first_half_edge_index)
+            : mesh_(mesh), type_(type), first_(first_half_edge_index) {}
+        Iterator begin() const { return Iterator(this, first_); }
+        Iterator end() const { return Iterator(this, -1); }
+
+    private:
+        const HalfEdgeTriangleMesh &mesh_;
+        CirculatorType type_;
+        int first_;
+    };
+
 public:
     HalfEdgeTriangleMesh()
         : TriangleMesh(Geometry::GeometryType::HalfEdgeTriangleMesh) {}
 
     /// Compute and update half edges, half edge can only be computed if the
     /// mesh is a manifold. Returns true if half edges are computed.
+    /// The half edge 3 * t + k points from triangles_[t](k) to
+    /// triangles_[t]((k + 1) % 3), twins are matched via sorted edge keys.
     bool ComputeHalfEdges();
 
     /// True if half-edges have already been computed
@@ -79,10 +121,19 @@ public:
     /// Returns a vector of boundaries. A boundary is a vector of vertices.
     std::vector<std::vector<int>> GetBoundaries() const;
 
+    /// Counter-clockwise circulator over the out-going half edges of a
+    /// vertex. If the vertex is on the boundary, the circulation starts at
+    /// the out-going boundary half edge.
+    HalfEdgeCirculator OneRingHalfEdges(int vertex_index) const;
+
+    /// Circulator over the boundary loop that contains the boundary half edge
+    /// \param half_edge_index.
+    HalfEdgeCirculator BoundaryLoopHalfEdges(int half_edge_index) const;
+
     /// Clear all data in HalfEdgeTriangleMesh
     void Clear() override;
 
-    void RemoveDuplicatedVertices() override;
+    void RemoveDuplicatedVertices(double eps = 0.0) override;
     void RemoveDuplicatedTriangles() override;
     void RemoveUnreferencedVertices() override;
     void RemoveDegenerateTriangles() override;
@@ -24,7 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/ImagePool.h"
 
 namespace {
 /// Isotropic 2D kernels are separable:
@@ -35,6 +43,158 @@ const std::vector<double> Gaussian7 = {0.03125, 0.109375, 0.21875, 0.28125,
                                        0.21875, 0.109375, 0.03125};
 const std::vector<double> Sobel31 = {-1.0, 0.0, 1.0};
 const std::vector<double> Sobel32 = {1.0, 2.0, 1.0};
+
+std::vector<float> ToFloatKernel(const std::vector<double> &kernel) {
+    return std::vector<float>(kernel.begin(), kernel.end());
+}
+
+/// Function to convolve the row \param input of \param width pixels with
+/// \param kernel into \param output, clamping at the borders. Each tap adds
+/// the float product of pixel and weight to a double accumulator, in kernel
+/// order. The interior loops run over contiguous pixels without clamping so
+/// that the compiler vectorizes them. The output may be the input.
+void ConvolveRow(const float *input,
+                 int width,
+                 const std::vector<float> &kernel,
+                 double *accumulator,
+                 float *output) {
+    const int kernel_size = int(kernel.size());
+    const int half_kernel_size = kernel_size / 2;
+    const int interior_begin = std::min(half_kernel_size, width);
+    const int interior_end = std::max(interior_begin, width - half_kernel_size);
+    std::fill(accumulator, accumulator + width, 0.0);
+    for (int k = 0; k < kernel_size; k++) {
+        const float weight = kernel[k];
+        const float *shifted = input + (k - half_kernel_size);
+        for (int x = interior_begin; x < interior_end; x++) {
+            accumulator[x] += shifted[x] * weight;
+        }
+    }
+    auto convolve_border = [&](int x) {
+        for (int k = 0; k < kernel_size; k++) {
+            int x_shift = x + k - half_kernel_size;
+            if (x_shift < 0) x_shift = 0;
+            if (x_shift > width - 1) x_shift = width - 1;
+            accumulator[x] += input[x_shift] * kernel[k];
+        }
+    };
+    for (int x = 0; x < interior_begin; x++) {
+        convolve_border(x);
+    }
+    for (int x = interior_end; x < width; x++) {
+        convolve_border(x);
+    }
+    for (int x = 0; x < width; x++) {
+        output[x] = (float)accumulator[x];
+    }
+}
+
+/// Function to convolve the columns of \param rows, one row per tap of
+/// \param kernel, into \param output, with the arithmetic of ConvolveRow.
+void ConvolveColumns(const float *const *rows,
+                     int width,
+                     const std::vector<float> &kernel,
+                     double *accumulator,
+                     float *output) {
+    std::fill(accumulator, accumulator + width, 0.0);
+    for (size_t k = 0; k < kernel.size(); k++) {
+        const float weight = kernel[k];
+        const float *row = rows[k];
+        for (int x = 0; x < width; x++) {
+            accumulator[x] += row[x] * weight;
+        }
+    }
+    for (int x = 0; x < width; x++) {
+        output[x] = (float)accumulator[x];
+    }
+}
+
+/// Ring buffer of the rows of an image convolved with a horizontal kernel,
+/// filled on demand. Each thread owns one, and with a static schedule walks
+/// down its rows, so that every row is convolved about once per thread and
+/// the rows in use stay in cache.
+class HorizontalRowCache {
+public:
+    HorizontalRowCache(const open3d::geometry::ImageView<const float> &input,
+                       const std::vector<float> &kernel,
+                       int num_of_rows)
+        : input_(input),
+          kernel_(kernel),
+          rows_(size_t(num_of_rows) * input.width_),
+          tags_(num_of_rows, -1),
+          accumulator_(input.width_) {}
+
+    /// Function to get the convolved row \param v, clamped to the image.
+    const float *GetRow(int v) {
+        if (v < 0) v = 0;
+        if (v > input_.height_ - 1) v = input_.height_ - 1;
+        int slot = v % int(tags_.size());
+        float *row = rows_.data() + size_t(slot) * input_.width_;
+        if (tags_[slot] != v) {
+            ConvolveRow(input_.Row(v), input_.width_, kernel_,
+                        accumulator_.data(), row);
+            tags_[slot] = v;
+        }
+        return row;
+    }
+
+private:
+    const open3d::geometry::ImageView<const float> &input_;
+    const std::vector<float> &kernel_;
+    std::vector<float> rows_;
+    std::vector<int> tags_;
+    std::vector<double> accumulator_;
+};
+
+bool Overlap(const open3d::geometry::ImageView<const float> &a,
+             const open3d::geometry::ImageView<float> &b) {
+    if (a.IsEmpty() || b.IsEmpty()) {
+        return false;
+    }
+    const float *a_end = a.Row(a.height_ - 1) + a.width_;
+    const float *b_end = b.Row(b.height_ - 1) + b.width_;
+    return a.data_ < b_end && b.data_ < a_end;
+}
+
+inline bool IsValidDepth(float depth) {
+    return depth > 0.0f && depth < std::numeric_limits<float>::infinity();
+}
+
+/// Selection networks (Devillard, "Fast median search: an ANSI C
+/// implementation", 1998) leaving the median of 9 and 25 values in the
+/// middle element.
+const int kMedian9Network[][2] = {
+        {1, 2}, {4, 5}, {7, 8}, {0, 1}, {3, 4}, {6, 7}, {1, 2},
+        {4, 5}, {7, 8}, {0, 3}, {5, 8}, {4, 7}, {3, 6}, {1, 4},
+        {2, 5}, {4, 7}, {4, 2}, {6, 4}, {4, 2}};
+const int kMedian25Network[][2] = {
+        {0, 1},   {3, 4},   {2, 4},   {2, 3},   {6, 7},   {5, 7},
+        {5, 6},   {9, 10},  {8, 10},  {8, 9},   {12, 13}, {11, 13},
+        {11, 12}, {15, 16}, {14, 16}, {14, 15}, {18, 19}, {17, 19},
+        {17, 18}, {21, 22}, {20, 22}, {20, 21}, {23, 24}, {2, 5},
+        {3, 6},   {0, 6},   {0, 3},   {4, 7},   {1, 7},   {1, 4},
+        {11, 14}, {8, 14},  {8, 11},  {12, 15}, {9, 15},  {9, 12},
+        {13, 16}, {10, 16}, {10, 13}, {20, 23}, {17, 23}, {17, 20},
+        {21, 24}, {18, 24}, {18, 21}, {19, 22}, {8, 17},  {9, 18},
+        {0, 18},  {0, 9},   {10, 19}, {1, 19},  {1, 10},  {11, 20},
+        {2, 20},  {2, 11},  {12, 21}, {3, 21},  {3, 12},  {13, 22},
+        {4, 22},  {4, 13},  {14, 23}, {5, 23},  {5, 14},  {15, 24},
+        {6, 24},  {6, 15},  {7, 16},  {7, 19},  {13, 21}, {15, 23},
+        {7, 13},  {7, 15},  {1, 9},   {3, 11},  {5, 17},  {11, 17},
+        {9, 17},  {4, 10},  {6, 12},  {7, 14},  {4, 6},   {4, 7},
+        {12, 14}, {10, 14}, {6, 7},   {10, 12}, {6, 10},  {6, 17},
+        {12, 17}, {7, 17},  {7, 10},  {12, 18}, {7, 12},  {10, 18},
+        {12, 20}, {10, 20}, {10, 12}};
+
+/// Number of bins of the range weight lookup table of the bilateral filter,
+/// which covers depth differences up to kBilateralRangeLUTSigmas standard
+/// deviations; larger differences get no weight.
+const int kBilateralRangeLUTSize = 1024;
+const double kBilateralRangeLUTSigmas = 4.0;
+
+/// Number of depth conversion tables kept for reuse.
+const size_t kMaxNumOfDepthConversionTables = 4;
+
 }  // unnamed namespace
 
 namespace open3d {
@@ -107,10 +267,46 @@ template uint16_t *PointerAt<uint16_t>(const Image &image,
                                        int v,
                                        int ch);
 
+std::shared_ptr<const std::vector<float>> GetDepthConversionTable(
+        double depth_scale, double depth_trunc) {
+    typedef std::shared_ptr<const std::vector<float>> Table;
+    typedef std::tuple<double, double, Table> Entry;
+    static std::mutex mutex;
+    static std::vector<Entry> tables;
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto &entry : tables) {
+        if (std::get<0>(entry) == depth_scale &&
+            std::get<1>(entry) == depth_trunc) {
+            return std::get<2>(entry);
+        }
+    }
+    auto table = std::make_shared<std::vector<float>>(65536);
+    for (int d = 0; d < 65536; d++) {
+        // Same operations as the per-pixel conversion, for the same result.
+        float depth = (float)d;
+        depth /= (float)depth_scale;
+        (*table)[d] = depth >= depth_trunc ? 0.0f : depth;
+    }
+    if (tables.size() == kMaxNumOfDepthConversionTables) {
+        tables.erase(tables.begin());
+    }
+    tables.push_back(std::make_tuple(depth_scale, depth_trunc, table));
+    return table;
+}
+
 std::shared_ptr<Image> ConvertDepthToFloatImage(
         const Image &depth,
         double depth_scale /* = 1000.0*/,
         double depth_trunc /* = 3.0*/) {
+    if (!depth.IsEmpty() && depth.num_of_channels_ == 1 &&
+        depth.bytes_per_channel_ == 2) {
+        auto output =
+                CreatePooledImage(depth.width_, depth.height_, 1, 4, false);
+        ConvertDepthToFloatImage(CreateImageView<uint16_t>(depth),
+                                 CreateImageView<float>(*output), depth_scale,
+                                 depth_trunc);
+        return output;
+    }
     // don't need warning message about image type
     // as we call CreateFloatImageFromImage
     auto output = CreateFloatImageFromImage(depth);
@@ -124,6 +320,83 @@ std::shared_ptr<Image> ConvertDepthToFloatImage(
     return output;
 }
 
+bool ConvertDepthToFloatImage(const ImageView<const uint16_t> &depth,
+                              const ImageView<float> &output,
+                              double depth_scale /* = 1000.0*/,
+                              double depth_trunc /* = 3.0*/) {
+    if (output.width_ != depth.width_ || output.height_ != depth.height_) {
+        utility::PrintWarning(
+                "[ConvertDepthToFloatImage] Unsupported image size.\n");
+        return false;
+    }
+    return ConvertDepthToFloatImage(
+            depth, output, *GetDepthConversionTable(depth_scale, depth_trunc));
+}
+
+bool ConvertDepthToFloatImage(const ImageView<const uint16_t> &depth,
+                              const ImageView<float> &output,
+                              const std::vector<float> &table) {
+    if (output.width_ != depth.width_ || output.height_ != depth.height_) {
+        utility::PrintWarning(
+                "[ConvertDepthToFloatImage] Unsupported image size.\n");
+        return false;
+    }
+    if (table.size() != 65536) {
+        utility::PrintWarning(
+                "[ConvertDepthToFloatImage] Invalid conversion table.\n");
+        return false;
+    }
+    const float *lut = table.data();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int y = 0; y < depth.height_; y++) {
+        const uint16_t *pi = depth.Row(y);
+        float *po = output.Row(y);
+        for (int x = 0; x < depth.width_; x++) {
+            po[x] = lut[pi[x]];
+        }
+    }
+    return true;
+}
+
+bool ConvertColorToIntensity(
+        const ImageView<const uint8_t, 3> &color,
+        const ImageView<float> &output,
+        Image::ColorToIntensityConversionType type /* = Weighted*/) {
+    if (output.width_ != color.width_ || output.height_ != color.height_) {
+        utility::PrintWarning(
+                "[ConvertColorToIntensity] Unsupported image size.\n");
+        return false;
+    }
+    const bool weighted =
+            type == Image::ColorToIntensityConversionType::Weighted;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int y = 0; y < color.height_; y++) {
+        const uint8_t *pi = color.Row(y);
+        float *po = output.Row(y);
+        // Branch-free loops over interleaved channels, which vectorize. The
+        // expressions are those of CreateFloatImageFromImage.
+        if (weighted) {
+            for (int x = 0; x < color.width_; x++) {
+                po[x] = (0.2990f * (float)(pi[3 * x]) +
+                         0.5870f * (float)(pi[3 * x + 1]) +
+                         0.1140f * (float)(pi[3 * x + 2])) /
+                        255.0f;
+            }
+        } else {
+            for (int x = 0; x < color.width_; x++) {
+                po[x] = ((float)(pi[3 * x]) + (float)(pi[3 * x + 1]) +
+                         (float)(pi[3 * x + 2])) /
+                        3.0f / 255.0f;
+            }
+        }
+    }
+    return true;
+}
+
 void ClipIntensityImage(Image &input,
                         double min /* = 0.0*/,
                         double max /* = 1.0*/) {
@@ -158,71 +431,91 @@ void LinearTransformImage(Image &input,
 }
 
 std::shared_ptr<Image> DownsampleImage(const Image &input) {
-    auto output = std::make_shared<Image>();
     if (input.num_of_channels_ != 1 || input.bytes_per_channel_ != 4) {
         utility::PrintWarning("[DownsampleImage] Unsupported image format.\n");
-        return output;
+        return std::make_shared<Image>();
     }
     int half_width = (int)floor((double)input.width_ / 2.0);
     int half_height = (int)floor((double)input.height_ / 2.0);
-    output->PrepareImage(half_width, half_height, 1, 4);
+    auto output = CreatePooledImage(half_width, half_height, 1, 4, false);
+    DownsampleImage(CreateImageView<float>(input),
+                    CreateImageView<float>(*output));
+    return output;
+}
+
+bool DownsampleImage(const ImageView<const float> &input,
+                     const ImageView<float> &output) {
+    if (output.width_ != input.width_ / 2 ||
+        output.height_ != input.height_ / 2) {
+        utility::PrintWarning("[DownsampleImage] Unsupported image size.\n");
+        return false;
+    }
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int y = 0; y < output->height_; y++) {
-        for (int x = 0; x < output->width_; x++) {
-            float *p1 = PointerAt<float>(input, x * 2, y * 2);
-            float *p2 = PointerAt<float>(input, x * 2 + 1, y * 2);
-            float *p3 = PointerAt<float>(input, x * 2, y * 2 + 1);
-            float *p4 = PointerAt<float>(input, x * 2 + 1, y * 2 + 1);
-            float *p = PointerAt<float>(*output, x, y);
-            *p = (*p1 + *p2 + *p3 + *p4) / 4.0f;
+    for (int y = 0; y < output.height_; y++) {
+        const float *p1 = input.Row(y * 2);
+        const float *p3 = input.Row(y * 2 + 1);
+        float *p = output.Row(y);
+        for (int x = 0; x < output.width_; x++) {
+            p[x] = (p1[x * 2] + p1[x * 2 + 1] + p3[x * 2] + p3[x * 2 + 1]) /
+                   4.0f;
         }
     }
-    return output;
+    return true;
 }
 
 std::shared_ptr<Image> FilterHorizontalImage(
         const Image &input, const std::vector<double> &kernel) {
-    auto output = std::make_shared<Image>();
     if (input.num_of_channels_ != 1 || input.bytes_per_channel_ != 4 ||
         kernel.size() % 2 != 1) {
         utility::PrintWarning(
                 "[FilterHorizontalImage] Unsupported image format or kernel "
                 "size.\n");
-        return output;
+        return std::make_shared<Image>();
     }
-    output->PrepareImage(input.width_, input.height_, 1, 4);
+    auto output = CreatePooledImage(input.width_, input.height_, 1, 4, false);
+    FilterHorizontalImage(CreateImageView<float>(input), kernel,
+                          CreateImageView<float>(*output));
+    return output;
+}
 
-    const int half_kernel_size = (int)(floor((double)kernel.size() / 2.0));
+bool FilterHorizontalImage(const ImageView<const float> &input,
+                           const std::vector<double> &kernel,
+                           const ImageView<float> &output) {
+    if (kernel.size() % 2 != 1 || output.width_ != input.width_ ||
+        output.height_ != input.height_) {
+        utility::PrintWarning(
+                "[FilterHorizontalImage] Unsupported image size or kernel "
+                "size.\n");
+        return false;
+    }
+
+    const std::vector<float> kernel_f = ToFloatKernel(kernel);
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static)
+#pragma omp parallel
 #endif
-    for (int y = 0; y < input.height_; y++) {
-        for (int x = 0; x < input.width_; x++) {
-            float *po = PointerAt<float>(*output, x, y, 0);
-            double temp = 0;
-            for (int i = -half_kernel_size; i <= half_kernel_size; i++) {
-                int x_shift = x + i;
-                if (x_shift < 0) x_shift = 0;
-                if (x_shift > input.width_ - 1) x_shift = input.width_ - 1;
-                float *pi = PointerAt<float>(input, x_shift, y, 0);
-                temp += (*pi * (float)kernel[i + half_kernel_size]);
-            }
-            *po = (float)temp;
+    {
+        std::vector<double> accumulator(input.width_);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int y = 0; y < input.height_; y++) {
+            ConvolveRow(input.Row(y), input.width_, kernel_f,
+                        accumulator.data(), output.Row(y));
         }
     }
-    return output;
+    return true;
 }
 
 std::shared_ptr<Image> FilterImage(const Image &input, Image::FilterType type) {
-    auto output = std::make_shared<Image>();
     if (input.num_of_channels_ != 1 || input.bytes_per_channel_ != 4) {
         utility::PrintWarning("[FilterImage] Unsupported image format.\n");
-        return output;
+        return std::make_shared<Image>();
     }
 
+    std::shared_ptr<Image> output;
     switch (type) {
         case Image::FilterType::Gaussian3:
             output = FilterImage(input, Gaussian3, Gaussian3);
@@ -241,6 +534,7 @@ std::shared_ptr<Image> FilterImage(const Image &input, Image::FilterType type) {
             break;
         default:
             utility::PrintWarning("[FilterImage] Unsupported filter type.\n");
+            output = std::make_shared<Image>();
             break;
     }
     return output;
@@ -256,29 +550,156 @@ ImagePyramid FilterImagePyramid(const ImagePyramid &input,
     return output;
 }
 
+bool FilterImage(const ImageView<const float> &input,
+                 Image::FilterType type,
+                 const ImageView<float> &output) {
+    switch (type) {
+        case Image::FilterType::Gaussian3:
+            return FilterImage(input, Gaussian3, Gaussian3, output);
+        case Image::FilterType::Gaussian5:
+            return FilterImage(input, Gaussian5, Gaussian5, output);
+        case Image::FilterType::Gaussian7:
+            return FilterImage(input, Gaussian7, Gaussian7, output);
+        case Image::FilterType::Sobel3Dx:
+            return FilterImage(input, Sobel31, Sobel32, output);
+        case Image::FilterType::Sobel3Dy:
+            return FilterImage(input, Sobel32, Sobel31, output);
+        default:
+            utility::PrintWarning("[FilterImage] Unsupported filter type.\n");
+            return false;
+    }
+}
+
 std::shared_ptr<Image> FilterImage(const Image &input,
                                    const std::vector<double> &dx,
                                    const std::vector<double> &dy) {
-    auto output = std::make_shared<Image>();
     if (input.num_of_channels_ != 1 || input.bytes_per_channel_ != 4) {
         utility::PrintWarning("[FilterImage] Unsupported image format.\n");
-        return output;
+        return std::make_shared<Image>();
     }
+    auto output = CreatePooledImage(input.width_, input.height_, 1, 4, false);
+    if (!FilterImage(CreateImageView<float>(input), dx, dy,
+                     CreateImageView<float>(*output))) {
+        output->Clear();
+    }
+    return output;
+}
 
-    auto temp1 = FilterHorizontalImage(input, dx);
-    auto temp2 = FlipImage(*temp1);
-    auto temp3 = FilterHorizontalImage(*temp2, dy);
-    auto temp4 = FlipImage(*temp3);
-    return temp4;
+bool FilterImage(const ImageView<const float> &input,
+                 const std::vector<double> &dx,
+                 const std::vector<double> &dy,
+                 const ImageView<float> &output) {
+    if (dx.size() % 2 != 1 || dy.size() % 2 != 1 ||
+        output.width_ != input.width_ || output.height_ != input.height_) {
+        utility::PrintWarning(
+                "[FilterImage] Unsupported image size or kernel size.\n");
+        return false;
+    }
+    if (input.IsEmpty()) {
+        return true;
+    }
+
+    // Output rows are written while later ones are still read, so filter
+    // from a copy if the output overlaps the input.
+    std::vector<float> input_copy;
+    ImageView<const float> source = input;
+    if (Overlap(input, output)) {
+        input_copy.resize(size_t(input.width_) * input.height_);
+        ImageView<float> copy(input_copy.data(), input.width_, input.height_);
+        for (int y = 0; y < input.height_; y++) {
+            std::copy(input.Row(y), input.Row(y) + input.width_, copy.Row(y));
+        }
+        source = copy;
+    }
+
+    const std::vector<float> dx_f = ToFloatKernel(dx);
+    const std::vector<float> dy_f = ToFloatKernel(dy);
+    const int half_kernel_size = int(dy.size()) / 2;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        HorizontalRowCache cache(source, dx_f, int(dy.size()));
+        std::vector<const float *> rows(dy.size());
+        std::vector<double> accumulator(input.width_);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int y = 0; y < input.height_; y++) {
+            for (size_t k = 0; k < dy.size(); k++) {
+                rows[k] = cache.GetRow(y + int(k) - half_kernel_size);
+            }
+            ConvolveColumns(rows.data(), input.width_, dy_f,
+                            accumulator.data(), output.Row(y));
+        }
+    }
+    return true;
+}
+
+bool FilterAndDownsampleImage(const ImageView<const float> &input,
+                              const std::vector<double> &kernel,
+                              const ImageView<float> &output) {
+    if (kernel.size() % 2 != 1 || output.width_ != input.width_ / 2 ||
+        output.height_ != input.height_ / 2) {
+        utility::PrintWarning(
+                "[FilterAndDownsampleImage] Unsupported image size or kernel "
+                "size.\n");
+        return false;
+    }
+    if (output.IsEmpty()) {
+        return true;
+    }
+    if (Overlap(input, output)) {
+        utility::PrintWarning(
+                "[FilterAndDownsampleImage] The output overlaps the input.\n");
+        return false;
+    }
+
+    // Only the two filtered rows averaged into each output row are
+    // computed, and only the columns that are averaged.
+    const std::vector<float> kernel_f = ToFloatKernel(kernel);
+    const int half_kernel_size = int(kernel.size()) / 2;
+    const int filtered_width = output.width_ * 2;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        HorizontalRowCache cache(input, kernel_f, int(kernel.size()) + 1);
+        std::vector<const float *> rows(kernel.size());
+        std::vector<double> accumulator(filtered_width);
+        std::vector<float> filtered(2 * filtered_width);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int y = 0; y < output.height_; y++) {
+            for (int r = 0; r < 2; r++) {
+                for (size_t k = 0; k < kernel.size(); k++) {
+                    rows[k] = cache.GetRow(2 * y + r + int(k) -
+                                           half_kernel_size);
+                }
+                ConvolveColumns(rows.data(), filtered_width, kernel_f,
+                                accumulator.data(),
+                                filtered.data() + r * filtered_width);
+            }
+            const float *p1 = filtered.data();
+            const float *p3 = filtered.data() + filtered_width;
+            float *p = output.Row(y);
+            for (int x = 0; x < output.width_; x++) {
+                p[x] = (p1[x * 2] + p1[x * 2 + 1] + p3[x * 2] +
+                        p3[x * 2 + 1]) /
+                       4.0f;
+            }
+        }
+    }
+    return true;
 }
 
 std::shared_ptr<Image> FlipImage(const Image &input) {
-    auto output = std::make_shared<Image>();
     if (input.num_of_channels_ != 1 || input.bytes_per_channel_ != 4) {
         utility::PrintWarning("[FilpImage] Unsupported image format.\n");
-        return output;
+        return std::make_shared<Image>();
     }
-    output->PrepareImage(input.height_, input.width_, 1, 4);
+    auto output = CreatePooledImage(input.height_, input.width_, 1, 4, false);
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
@@ -295,12 +716,11 @@ std::shared_ptr<Image> FlipImage(const Image &input) {
 
 std::shared_ptr<Image> DilateImage(const Image &input,
                                    int half_kernel_size /* = 1 */) {
-    auto output = std::make_shared<Image>();
     if (input.num_of_channels_ != 1 || input.bytes_per_channel_ != 1) {
         utility::PrintWarning("[DilateImage] Unsupported image format.\n");
-        return output;
+        return std::make_shared<Image>();
     }
-    output->PrepareImage(input.width_, input.height_, 1, 1);
+    auto output = CreatePooledImage(input.width_, input.height_, 1, 1);
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
@@ -337,8 +757,7 @@ std::shared_ptr<Image> CreateDepthBoundaryMask(
             FilterImage(*depth_image, Image::FilterType::Sobel3Dx);
     auto depth_image_gradient_dy =
             FilterImage(*depth_image, Image::FilterType::Sobel3Dy);
-    auto mask = std::make_shared<Image>();
-    mask->PrepareImage(width, height, 1, 1);
+    auto mask = CreatePooledImage(width, height, 1, 1, false);
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
@@ -364,5 +783,345 @@ std::shared_ptr<Image> CreateDepthBoundaryMask(
     }
 }
 
+bool BilateralFilterDepthImage(const ImageView<const float> &input,
+                               const ImageView<float> &output,
+                               int half_kernel_size /* = 2*/,
+                               double sigma_space /* = 1.5*/,
+                               double sigma_depth /* = 0.03*/) {
+    if (output.width_ != input.width_ || output.height_ != input.height_ ||
+        half_kernel_size < 0 || sigma_space <= 0.0 || sigma_depth <= 0.0) {
+        utility::PrintWarning(
+                "[BilateralFilterDepthImage] Unsupported image size or "
+                "parameters.\n");
+        return false;
+    }
+    if (Overlap(input, output)) {
+        utility::PrintWarning(
+                "[BilateralFilterDepthImage] The output overlaps the "
+                "input.\n");
+        return false;
+    }
+
+    const int kernel_size = 2 * half_kernel_size + 1;
+    std::vector<float> space_weights(kernel_size * kernel_size);
+    for (int dy = -half_kernel_size; dy <= half_kernel_size; dy++) {
+        for (int dx = -half_kernel_size; dx <= half_kernel_size; dx++) {
+            space_weights[(dy + half_kernel_size) * kernel_size + dx +
+                          half_kernel_size] =
+                    (float)std::exp(-(dx * dx + dy * dy) /
+                                    (2.0 * sigma_space * sigma_space));
+        }
+    }
+    const double lut_range = kBilateralRangeLUTSigmas * sigma_depth;
+    const float lut_scale = (float)(kBilateralRangeLUTSize / lut_range);
+    std::vector<float> range_weights(kBilateralRangeLUTSize + 1);
+    for (int i = 0; i < kBilateralRangeLUTSize; i++) {
+        double difference = (i + 0.5) / lut_scale;
+        range_weights[i] = (float)std::exp(-difference * difference /
+                                           (2.0 * sigma_depth * sigma_depth));
+    }
+    // Sentinel for differences beyond the table.
+    range_weights[kBilateralRangeLUTSize] = 0.0f;
+
+    const int width = input.width_;
+    const int height = input.height_;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int y = 0; y < height; y++) {
+        const int dy_min = std::max(-half_kernel_size, -y);
+        const int dy_max = std::min(half_kernel_size, height - 1 - y);
+        float *po = output.Row(y);
+        for (int x = 0; x < width; x++) {
+            const float center = input(x, y);
+            if (!IsValidDepth(center)) {
+                po[x] = 0.0f;
+                continue;
+            }
+            const int dx_min = std::max(-half_kernel_size, -x);
+            const int dx_max = std::min(half_kernel_size, width - 1 - x);
+            float sum = 0.0f;
+            float weight_sum = 0.0f;
+            for (int dy = dy_min; dy <= dy_max; dy++) {
+                const float *pi = input.Row(y + dy) + x;
+                const float *ws = space_weights.data() +
+                                  (dy + half_kernel_size) * kernel_size +
+                                  half_kernel_size;
+                for (int dx = dx_min; dx <= dx_max; dx++) {
+                    const float depth = pi[dx];
+                    if (!IsValidDepth(depth)) {
+                        continue;
+                    }
+                    const int bin = (int)std::min(
+                            std::abs(depth - center) * lut_scale,
+                            (float)kBilateralRangeLUTSize);
+                    const float weight = ws[dx] * range_weights[bin];
+                    sum += weight * depth;
+                    weight_sum += weight;
+                }
+            }
+            // The center always has a positive weight.
+            po[x] = sum / weight_sum;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<Image> BilateralFilterDepthImage(
+        const Image &input,
+        int half_kernel_size /* = 2*/,
+        double sigma_space /* = 1.5*/,
+        double sigma_depth /* = 0.03*/) {
+    if (input.num_of_channels_ != 1 || input.bytes_per_channel_ != 4) {
+        utility::PrintWarning(
+                "[BilateralFilterDepthImage] Unsupported image format.\n");
+        return std::make_shared<Image>();
+    }
+    auto output = CreatePooledImage(input.width_, input.height_, 1, 4, false);
+    if (!BilateralFilterDepthImage(CreateImageView<float>(input),
+                                   CreateImageView<float>(*output),
+                                   half_kernel_size, sigma_space,
+                                   sigma_depth)) {
+        output->Clear();
+    }
+    return output;
+}
+
+bool MedianFilterDepthImage(const ImageView<const float> &input,
+                            const ImageView<float> &output,
+                            int kernel_size /* = 3*/) {
+    if (output.width_ != input.width_ || output.height_ != input.height_ ||
+        (kernel_size != 3 && kernel_size != 5)) {
+        utility::PrintWarning(
+                "[MedianFilterDepthImage] Unsupported image size or kernel "
+                "size.\n");
+        return false;
+    }
+    if (Overlap(input, output)) {
+        utility::PrintWarning(
+                "[MedianFilterDepthImage] The output overlaps the input.\n");
+        return false;
+    }
+
+    const int width = input.width_;
+    const int height = input.height_;
+    const int half_kernel_size = kernel_size / 2;
+    const int window_size = kernel_size * kernel_size;
+    const int(*network)[2] = kernel_size == 3 ? kMedian9Network
+                                              : kMedian25Network;
+    const int network_size =
+            kernel_size == 3 ? int(sizeof(kMedian9Network) / sizeof(int[2]))
+                             : int(sizeof(kMedian25Network) / sizeof(int[2]));
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // Element k of the windows of a whole row is stored in
+        // window[k * width, (k + 1) * width), so that the selection network
+        // runs on all the pixels of the row at once with vector min/max.
+        // Invalid pixels are replaced alternately by +inf and -inf, which
+        // leaves the median of the valid pixels in the middle (the upper
+        // one for an even number of valid pixels).
+        std::vector<float> window(size_t(window_size) * width);
+        std::vector<float> replacements(width);
+        const float infinity = std::numeric_limits<float>::infinity();
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int y = 0; y < height; y++) {
+            for (int dy = -half_kernel_size; dy <= half_kernel_size; dy++) {
+                int y_shift = std::min(std::max(y + dy, 0), height - 1);
+                const float *pi = input.Row(y_shift);
+                for (int dx = -half_kernel_size; dx <= half_kernel_size;
+                     dx++) {
+                    float *pw = window.data() +
+                                size_t((dy + half_kernel_size) * kernel_size +
+                                       dx + half_kernel_size) *
+                                        width;
+                    const int interior_begin =
+                            std::min(std::max(-dx, 0), width);
+                    const int interior_end = std::max(
+                            interior_begin, std::min(width - dx, width));
+                    for (int x = 0; x < interior_begin; x++) {
+                        pw[x] = pi[std::min(std::max(x + dx, 0), width - 1)];
+                    }
+                    std::copy(pi + interior_begin + dx, pi + interior_end + dx,
+                              pw + interior_begin);
+                    for (int x = interior_end; x < width; x++) {
+                        pw[x] = pi[std::min(std::max(x + dx, 0), width - 1)];
+                    }
+                }
+            }
+            std::fill(replacements.begin(), replacements.end(), infinity);
+            for (int k = 0; k < window_size; k++) {
+                float *pw = window.data() + size_t(k) * width;
+                for (int x = 0; x < width; x++) {
+                    const float depth = pw[x];
+                    const bool invalid = !IsValidDepth(depth);
+                    pw[x] = invalid ? replacements[x] : depth;
+                    replacements[x] =
+                            invalid ? -replacements[x] : replacements[x];
+                }
+            }
+            for (int n = 0; n < network_size; n++) {
+                float *pa = window.data() + size_t(network[n][0]) * width;
+                float *pb = window.data() + size_t(network[n][1]) * width;
+                for (int x = 0; x < width; x++) {
+                    float a = pa[x];
+                    float b = pb[x];
+                    pa[x] = std::min(a, b);
+                    pb[x] = std::max(a, b);
+                }
+            }
+
+            const float *center = input.Row(y);
+            const float *median =
+                    window.data() + size_t(window_size / 2) * width;
+            float *po = output.Row(y);
+            for (int x = 0; x < width; x++) {
+                po[x] = IsValidDepth(center[x]) ? median[x] : 0.0f;
+            }
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<Image> MedianFilterDepthImage(const Image &input,
+                                              int kernel_size /* = 3*/) {
+    if (input.num_of_channels_ != 1 || input.bytes_per_channel_ != 4) {
+        utility::PrintWarning(
+                "[MedianFilterDepthImage] Unsupported image format.\n");
+        return std::make_shared<Image>();
+    }
+    auto output = CreatePooledImage(input.width_, input.height_, 1, 4, false);
+    if (!MedianFilterDepthImage(CreateImageView<float>(input),
+                                CreateImageView<float>(*output),
+                                kernel_size)) {
+        output->Clear();
+    }
+    return output;
+}
+
+bool FillDepthImageHoles(const ImageView<const float> &input,
+                         const ImageView<float> &output,
+                         double max_distance /* = 10.0*/) {
+    if (output.width_ != input.width_ || output.height_ != input.height_) {
+        utility::PrintWarning(
+                "[FillDepthImageHoles] Unsupported image size.\n");
+        return false;
+    }
+
+    // Exact nearest valid pixel, separably (Felzenszwalb and Huttenlocher,
+    // "Distance Transforms of Sampled Functions", 2012): first the nearest
+    // valid pixel of every column, then the lower envelope of the parabolas
+    // (x - x')^2 + dy(x')^2 along every row.
+    const int width = input.width_;
+    const int height = input.height_;
+    const double infinity = std::numeric_limits<double>::infinity();
+    std::vector<int> nearest_rows(size_t(width) * height, -1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int x = 0; x < width; x++) {
+        int *nearest = nearest_rows.data() + x;
+        int previous = -1;
+        for (int y = 0; y < height; y++) {
+            if (IsValidDepth(input(x, y))) {
+                previous = y;
+            }
+            nearest[size_t(y) * width] = previous;
+        }
+        int next = -1;
+        for (int y = height - 1; y >= 0; y--) {
+            if (IsValidDepth(input(x, y))) {
+                next = y;
+            }
+            int &best = nearest[size_t(y) * width];
+            if (next >= 0 && (best < 0 || next - y < y - best)) {
+                best = next;
+            }
+        }
+    }
+
+    const double max_distance2 = max_distance * max_distance;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> sites(width);
+        std::vector<double> boundaries(width + 1);
+        std::vector<double> heights(width);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int y = 0; y < height; y++) {
+            const int *nearest = nearest_rows.data() + size_t(y) * width;
+            int num_sites = 0;
+            for (int x = 0; x < width; x++) {
+                if (nearest[x] < 0) {
+                    continue;
+                }
+                double dy = nearest[x] - y;
+                heights[x] = dy * dy;
+                double s = -infinity;
+                while (num_sites > 0) {
+                    int q = sites[num_sites - 1];
+                    s = ((heights[x] + double(x) * x) -
+                         (heights[q] + double(q) * q)) /
+                        (2.0 * (x - q));
+                    if (s > boundaries[num_sites - 1]) {
+                        break;
+                    }
+                    num_sites--;
+                }
+                sites[num_sites] = x;
+                boundaries[num_sites] = num_sites > 0 ? s : -infinity;
+                boundaries[num_sites + 1] = infinity;
+                num_sites++;
+            }
+
+            const float *pi = input.Row(y);
+            float *po = output.Row(y);
+            int k = 0;
+            for (int x = 0; x < width; x++) {
+                if (IsValidDepth(pi[x])) {
+                    // Valid pixels are read by other rows, leave them alone
+                    // when filtering in place.
+                    if (po != pi) {
+                        po[x] = pi[x];
+                    }
+                    continue;
+                }
+                po[x] = 0.0f;
+                if (num_sites == 0) {
+                    continue;
+                }
+                while (boundaries[k + 1] < x) {
+                    k++;
+                }
+                int site = sites[k];
+                double dx = x - site;
+                if (dx * dx + heights[site] <= max_distance2) {
+                    po[x] = input(site, nearest[site]);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<Image> FillDepthImageHoles(const Image &input,
+                                           double max_distance /* = 10.0*/) {
+    if (input.num_of_channels_ != 1 || input.bytes_per_channel_ != 4) {
+        utility::PrintWarning(
+                "[FillDepthImageHoles] Unsupported image format.\n");
+        return std::make_shared<Image>();
+    }
+    auto output = CreatePooledImage(input.width_, input.height_, 1, 4, false);
+    FillDepthImageHoles(CreateImageView<float>(input),
+                        CreateImageView<float>(*output), max_distance);
+    return output;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -27,10 +27,12 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cstring>
 #include <memory>
 #include <vector>
 
 #include "Open3D/Geometry/Geometry2D.h"
+#include "Open3D/Geometry/ImageView.h"
 #include "Open3D/Utility/Console.h"
 
 namespace open3d {
@@ -56,6 +58,12 @@ public:
         Sobel3Dy
     };
 
+    enum class InterpolationType {
+        Nearest,
+        Bilinear,
+        Area,
+    };
+
 public:
     Image() : Geometry2D(Geometry::GeometryType::Image) {}
     ~Image() override {}
@@ -105,6 +113,10 @@ public:
     std::vector<uint8_t> data_;
 };
 
+/// The functions below returning a new Image take it from GetImagePool()
+/// (ImagePool.h): once released, it stays cached for reuse, up to 256 MB of
+/// images in total by default.
+
 /// Factory function to create a float image composed of multipliers that
 /// convert depth values into camera distances (ImageFactory.cpp)
 /// The multiplier function M(u,v) is defined as:
@@ -120,6 +132,46 @@ std::shared_ptr<Image> CreateFloatImageFromImage(
         Image::ColorToIntensityConversionType type =
                 Image::ColorToIntensityConversionType::Weighted);
 
+/// Function to view the pixels of \param image as C channels of type T,
+/// without copying. Returns an empty view if the format of the image does
+/// not match. The view is invalidated when the image is reallocated.
+template <typename T, int C = 1>
+ImageView<T, C> CreateImageView(Image &image) {
+    if (image.num_of_channels_ != C || image.bytes_per_channel_ != sizeof(T)) {
+        utility::PrintWarning("[CreateImageView] Unsupported image format.\n");
+        return ImageView<T, C>();
+    }
+    return ImageView<T, C>((T *)image.data_.data(), image.width_,
+                           image.height_, image.BytesPerLine());
+}
+
+template <typename T, int C = 1>
+ImageView<const T, C> CreateImageView(const Image &image) {
+    if (image.num_of_channels_ != C || image.bytes_per_channel_ != sizeof(T)) {
+        utility::PrintWarning("[CreateImageView] Unsupported image format.\n");
+        return ImageView<const T, C>();
+    }
+    return ImageView<const T, C>((const T *)image.data_.data(), image.width_,
+                                 image.height_, image.BytesPerLine());
+}
+
+/// Function to copy the pixels of \param view into a new Image
+template <typename T, int C>
+std::shared_ptr<Image> CreateImageFromImageView(const ImageView<T, C> &view) {
+    typedef typename std::remove_const<T>::type Pixel;
+    auto output = std::make_shared<Image>();
+    if (view.IsEmpty()) {
+        return output;
+    }
+    output->PrepareImage(view.width_, view.height_, C, sizeof(Pixel));
+    const size_t bytes_per_line = size_t(output->BytesPerLine());
+    for (int v = 0; v < view.height_; v++) {
+        memcpy(output->data_.data() + v * bytes_per_line, view.Row(v),
+               bytes_per_line);
+    }
+    return output;
+}
+
 /// Function to access the raw data of a single-channel Image
 template <typename T>
 T *PointerAt(const Image &image, int u, int v);
@@ -132,6 +184,36 @@ std::shared_ptr<Image> ConvertDepthToFloatImage(const Image &depth,
                                                 double depth_scale = 1000.0,
                                                 double depth_trunc = 3.0);
 
+/// Function to convert the uint16 depth image \param depth into meters in
+/// \param output of the same size: depths are divided by \param depth_scale,
+/// and set to 0 from \param depth_trunc on. The conversion goes through a
+/// table of the 65536 depth values, see GetDepthConversionTable.
+bool ConvertDepthToFloatImage(const ImageView<const uint16_t> &depth,
+                              const ImageView<float> &output,
+                              double depth_scale = 1000.0,
+                              double depth_trunc = 3.0);
+
+/// Same, with the \param table of GetDepthConversionTable, to convert an
+/// image piece by piece without looking the table up each time.
+bool ConvertDepthToFloatImage(const ImageView<const uint16_t> &depth,
+                              const ImageView<float> &output,
+                              const std::vector<float> &table);
+
+/// Function to get the table of the float depths of the 65536 uint16 depth
+/// values for \param depth_scale and \param depth_trunc. The last tables
+/// built are kept, since a sequence of frames uses the same parameters.
+std::shared_ptr<const std::vector<float>> GetDepthConversionTable(
+        double depth_scale, double depth_trunc);
+
+/// Function to convert the 8-bit RGB image \param color into the intensity
+/// image \param output of the same size, in [0, 1], as does
+/// CreateFloatImageFromImage.
+bool ConvertColorToIntensity(
+        const ImageView<const uint8_t, 3> &color,
+        const ImageView<float> &output,
+        Image::ColorToIntensityConversionType type =
+                Image::ColorToIntensityConversionType::Weighted);
+
 std::shared_ptr<Image> FlipImage(const Image &input);
 
 /// Function to filter image with pre-defined filtering type
@@ -145,9 +227,103 @@ std::shared_ptr<Image> FilterImage(const Image &input,
 std::shared_ptr<Image> FilterHorizontalImage(const Image &input,
                                              const std::vector<double> &kernel);
 
+/// Function to filter the float image \param input with pre-defined
+/// filtering type into \param output, which has the size of the input and
+/// may be the input itself.
+bool FilterImage(const ImageView<const float> &input,
+                 Image::FilterType type,
+                 const ImageView<float> &output);
+
+/// Function to filter the float image \param input with arbitrary dx, dy
+/// separable filters into \param output, which has the size of the input
+/// and may be the input itself.
+bool FilterImage(const ImageView<const float> &input,
+                 const std::vector<double> &dx,
+                 const std::vector<double> &dy,
+                 const ImageView<float> &output);
+
+/// Function to filter the rows of the float image \param input into
+/// \param output, which has the size of the input and may be the input
+/// itself.
+bool FilterHorizontalImage(const ImageView<const float> &input,
+                           const std::vector<double> &kernel,
+                           const ImageView<float> &output);
+
 /// Function to 2x image downsample using simple 2x2 averaging
 std::shared_ptr<Image> DownsampleImage(const Image &input);
 
+/// Function to 2x downsample the float image \param input into
+/// \param output, of half its size rounded down.
+bool DownsampleImage(const ImageView<const float> &input,
+                     const ImageView<float> &output);
+
+/// Function to filter the float image \param input with \param kernel in
+/// both directions and 2x downsample it into \param output, of half its size
+/// rounded down. Same result as FilterImage followed by DownsampleImage, but
+/// only the filtered pixels that are averaged are computed, and no
+/// intermediate image is stored.
+bool FilterAndDownsampleImage(const ImageView<const float> &input,
+                              const std::vector<double> &kernel,
+                              const ImageView<float> &output);
+
+/// Function to resize \param input into \param output, whose size is the
+/// target size (ImageResampling.cpp). Pixel centers are aligned as in
+/// OpenCV. Area interpolation averages the input pixels covered by each
+/// output pixel, and is the one to use for downsampling. Supported for
+/// uint8_t, uint16_t and float pixels with 1, 3 or 4 channels; for depth
+/// images, Nearest does not mix valid depths with holes.
+template <typename T, int C>
+bool ResizeImage(const ImageView<const T, C> &input,
+                 const ImageView<T, C> &output,
+                 Image::InterpolationType type =
+                         Image::InterpolationType::Bilinear);
+
+std::shared_ptr<Image> ResizeImage(const Image &input,
+                                   int width,
+                                   int height,
+                                   Image::InterpolationType type =
+                                           Image::InterpolationType::Bilinear);
+
+/// Function to resample \param input into \param output, of the size of
+/// \param map: output pixel (u, v) takes the value of the input at
+/// (map(u, v, 0), map(u, v, 1)), in pixels. Coordinates within half a pixel
+/// of the input take the value of its border, output pixels mapped further
+/// out are set to 0. Only Nearest and Bilinear interpolation are supported;
+/// formats are those of ResizeImage.
+template <typename T, int C>
+bool RemapImage(const ImageView<const T, C> &input,
+                const ImageView<const float, 2> &map,
+                const ImageView<T, C> &output,
+                Image::InterpolationType type =
+                        Image::InterpolationType::Bilinear);
+
+/// \param map is a 2-channel float image.
+std::shared_ptr<Image> RemapImage(const Image &input,
+                                  const Image &map,
+                                  Image::InterpolationType type =
+                                          Image::InterpolationType::Bilinear);
+
+/// Function to create the map that RemapImage takes to undistort the images
+/// of the camera \param intrinsic, with its distortion coefficients, into
+/// images of the ideal pinhole camera \param undistorted_intrinsic, whose
+/// size is the size of the map.
+std::shared_ptr<Image> CreateUndistortionMap(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const camera::PinholeCameraIntrinsic &undistorted_intrinsic);
+
+/// Same, with undistorted images of the intrinsic matrix and size of
+/// \param intrinsic.
+std::shared_ptr<Image> CreateUndistortionMap(
+        const camera::PinholeCameraIntrinsic &intrinsic);
+
+/// Function to undistort an image of the camera \param intrinsic. Creates
+/// the map on every call: to undistort a sequence, create it once with
+/// CreateUndistortionMap and call RemapImage.
+std::shared_ptr<Image> UndistortImage(
+        const Image &input,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        Image::InterpolationType type = Image::InterpolationType::Bilinear);
+
 /// Function to dilate 8bit mask map
 std::shared_ptr<Image> DilateImage(const Image &input,
                                    int half_kernel_size = 1);
@@ -181,11 +357,55 @@ ImagePyramid CreateImagePyramid(const Image &image,
                                 size_t num_of_levels,
                                 bool with_gaussian_filter = true);
 
+/// Function to create image pyramid from a float image view
+ImagePyramid CreateImagePyramid(const ImageView<const float> &image,
+                                size_t num_of_levels,
+                                bool with_gaussian_filter = true);
+
 /// Function to create a depthmap boundary mask from depth image
 std::shared_ptr<Image> CreateDepthBoundaryMask(
         const Image &depth_image_input,
         double depth_threshold_for_discontinuity_check = 0.1,
         int half_dilation_kernel_size_for_discontinuity_map = 3);
 
+/// Function to smooth the float depth image \param input with a bilateral
+/// filter of (2 \param half_kernel_size + 1)^2 pixels, spatial standard
+/// deviation \param sigma_space in pixels and range standard deviation
+/// \param sigma_depth in depth units, into \param output of the same size,
+/// which must not overlap the input. Pixels that are not positive finite
+/// depths are invalid: they are skipped, and stay 0.
+bool BilateralFilterDepthImage(const ImageView<const float> &input,
+                               const ImageView<float> &output,
+                               int half_kernel_size = 2,
+                               double sigma_space = 1.5,
+                               double sigma_depth = 0.03);
+
+std::shared_ptr<Image> BilateralFilterDepthImage(const Image &input,
+                                                 int half_kernel_size = 2,
+                                                 double sigma_space = 1.5,
+                                                 double sigma_depth = 0.03);
+
+/// Function to replace every valid pixel of the float depth image
+/// \param input by the median of the valid pixels of its \param kernel_size
+/// x \param kernel_size neighbourhood (3 or 5), into \param output of the
+/// same size, which must not overlap the input. Invalid pixels stay 0.
+bool MedianFilterDepthImage(const ImageView<const float> &input,
+                            const ImageView<float> &output,
+                            int kernel_size = 3);
+
+std::shared_ptr<Image> MedianFilterDepthImage(const Image &input,
+                                              int kernel_size = 3);
+
+/// Function to fill every invalid pixel of the float depth image
+/// \param input with its nearest valid pixel, if that one is at most
+/// \param max_distance pixels away, into \param output of the same size,
+/// which may be the input itself.
+bool FillDepthImageHoles(const ImageView<const float> &input,
+                         const ImageView<float> &output,
+                         double max_distance = 10.0);
+
+std::shared_ptr<Image> FillDepthImageHoles(const Image &input,
+                                           double max_distance = 10.0);
+
 }  // namespace geometry
 }  // namespace open3d
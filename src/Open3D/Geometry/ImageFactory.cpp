@@ -26,6 +26,7 @@
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/ImagePool.h"
 
 namespace open3d {
 namespace geometry {
@@ -63,11 +64,17 @@ std::shared_ptr<Image> CreateDepthToCameraDistanceMultiplierFloatImage(
 std::shared_ptr<Image> CreateFloatImageFromImage(
         const Image &image,
         Image::ColorToIntensityConversionType type /* = WEIGHTED*/) {
-    auto fimage = std::make_shared<Image>();
     if (image.IsEmpty()) {
+        return std::make_shared<Image>();
+    }
+    if (image.num_of_channels_ == 3 && image.bytes_per_channel_ == 1) {
+        auto fimage =
+                CreatePooledImage(image.width_, image.height_, 1, 4, false);
+        ConvertColorToIntensity(CreateImageView<uint8_t, 3>(image),
+                                CreateImageView<float>(*fimage), type);
         return fimage;
     }
-    fimage->PrepareImage(image.width_, image.height_, 1, 4);
+    auto fimage = CreatePooledImage(image.width_, image.height_, 1, 4);
     for (int i = 0; i < image.height_ * image.width_; i++) {
         float *p = (float *)(fimage->data_.data() + i * 4);
         const uint8_t *pi =
@@ -123,15 +130,14 @@ std::shared_ptr<Image> CreateFloatImageFromImage(
 
 template <typename T>
 std::shared_ptr<Image> CreateImageFromFloatImage(const Image &input) {
-    auto output = std::make_shared<Image>();
     if (input.num_of_channels_ != 1 || input.bytes_per_channel_ != 4) {
         utility::PrintDebug(
                 "[CreateImageFromFloatImage] Unsupported image format.\n");
-        return output;
+        return std::make_shared<Image>();
     }
 
-    output->PrepareImage(input.width_, input.height_, input.num_of_channels_,
-                         sizeof(T));
+    auto output = CreatePooledImage(input.width_, input.height_,
+                                    input.num_of_channels_, sizeof(T), false);
     const float *pi = (const float *)input.data_.data();
     T *p = (T *)output->data_.data();
     for (int i = 0; i < input.height_ * input.width_; i++, p++, pi++) {
@@ -149,31 +155,42 @@ template std::shared_ptr<Image> CreateImageFromFloatImage<uint16_t>(
 ImagePyramid CreateImagePyramid(const Image &input,
                                 size_t num_of_levels,
                                 bool with_gaussian_filter /*= true*/) {
-    std::vector<std::shared_ptr<Image>> pyramid_image;
-    pyramid_image.clear();
     if ((input.num_of_channels_ != 1) || (input.bytes_per_channel_ != 4)) {
         utility::PrintWarning(
                 "[CreateImagePyramid] Unsupported image format.\n");
+        return ImagePyramid();
+    }
+    return CreateImagePyramid(CreateImageView<float>(input), num_of_levels,
+                              with_gaussian_filter);
+}
+
+ImagePyramid CreateImagePyramid(const ImageView<const float> &input,
+                                size_t num_of_levels,
+                                bool with_gaussian_filter /*= true*/) {
+    std::vector<std::shared_ptr<Image>> pyramid_image;
+    if (num_of_levels == 0 || input.IsEmpty()) {
         return pyramid_image;
     }
+    auto base = CreatePooledImage(input.width_, input.height_, 1, 4, false);
+    const size_t row_bytes = input.width_ * sizeof(float);
+    for (int v = 0; v < input.height_; v++) {
+        memcpy(base->data_.data() + v * row_bytes, input.Row(v), row_bytes);
+    }
+    pyramid_image.push_back(base);
 
-    for (int i = 0; i < num_of_levels; i++) {
-        if (i == 0) {
-            std::shared_ptr<Image> input_copy_ptr = std::make_shared<Image>();
-            *input_copy_ptr = input;
-            pyramid_image.push_back(input_copy_ptr);
+    // https://en.wikipedia.org/wiki/Pyramid_(image_processing)
+    const std::vector<double> gaussian3 = {0.25, 0.5, 0.25};
+    for (size_t i = 1; i < num_of_levels; i++) {
+        auto previous = CreateImageView<float>(*pyramid_image[i - 1]);
+        auto level = CreatePooledImage(previous.width_ / 2,
+                                       previous.height_ / 2, 1, 4, false);
+        if (with_gaussian_filter) {
+            FilterAndDownsampleImage(previous, gaussian3,
+                                     CreateImageView<float>(*level));
         } else {
-            if (with_gaussian_filter) {
-                // https://en.wikipedia.org/wiki/Pyramid_(image_processing)
-                auto level_b = FilterImage(*pyramid_image[i - 1],
-                                           Image::FilterType::Gaussian3);
-                auto level_bd = DownsampleImage(*level_b);
-                pyramid_image.push_back(level_bd);
-            } else {
-                auto level_d = DownsampleImage(*pyramid_image[i - 1]);
-                pyramid_image.push_back(level_d);
-            }
+            DownsampleImage(previous, CreateImageView<float>(*level));
         }
+        pyramid_image.push_back(level);
     }
     return pyramid_image;
 }
@@ -0,0 +1,166 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/ImagePool.h"
+
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class ImagePool::Storage {
+public:
+    typedef std::tuple<int, int, int, int> Format;
+
+    static Format GetFormat(const Image &image) {
+        return std::make_tuple(image.width_, image.height_,
+                               image.num_of_channels_,
+                               image.bytes_per_channel_);
+    }
+
+    /// Function to take back \param image, or free it.
+    void Release(Image *image) {
+        std::unique_ptr<Image> owned(image);
+        if (!image->HasData()) {
+            return;
+        }
+        const size_t bytes = image->data_.size();
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (statistics_.cached_bytes_ + bytes > max_cached_bytes_) {
+            statistics_.num_of_discards_++;
+            return;
+        }
+        images_[GetFormat(*image)].push_back(std::move(owned));
+        statistics_.num_of_cached_images_++;
+        statistics_.cached_bytes_ += bytes;
+    }
+
+    void Trim() {
+        while (statistics_.cached_bytes_ > max_cached_bytes_) {
+            auto it = images_.begin();
+            while (it->second.empty()) {
+                it = images_.erase(it);
+            }
+            statistics_.cached_bytes_ -= it->second.back()->data_.size();
+            statistics_.num_of_cached_images_--;
+            it->second.pop_back();
+        }
+    }
+
+public:
+    mutable std::mutex mutex_;
+    std::map<Format, std::vector<std::unique_ptr<Image>>> images_;
+    size_t max_cached_bytes_ = 0;
+    ImagePoolStatistics statistics_;
+};
+
+ImagePool::ImagePool(size_t max_cached_bytes /* = 256 MB*/)
+    : storage_(std::make_shared<Storage>()) {
+    storage_->max_cached_bytes_ = max_cached_bytes;
+}
+
+ImagePool::~ImagePool() {}
+
+std::shared_ptr<Image> ImagePool::Acquire(int width,
+                                          int height,
+                                          int num_of_channels,
+                                          int bytes_per_channel,
+                                          bool clear_data /* = true*/) {
+    std::unique_ptr<Image> image;
+    {
+        std::lock_guard<std::mutex> lock(storage_->mutex_);
+        storage_->statistics_.num_of_requests_++;
+        auto it = storage_->images_.find(std::make_tuple(
+                width, height, num_of_channels, bytes_per_channel));
+        if (it != storage_->images_.end() && !it->second.empty()) {
+            image = std::move(it->second.back());
+            it->second.pop_back();
+            storage_->statistics_.num_of_hits_++;
+            storage_->statistics_.num_of_cached_images_--;
+            storage_->statistics_.cached_bytes_ -= image->data_.size();
+        }
+    }
+    if (image) {
+        if (clear_data) {
+            memset(image->data_.data(), 0, image->data_.size());
+        }
+    } else {
+        image.reset(new Image());
+        image->PrepareImage(width, height, num_of_channels, bytes_per_channel);
+    }
+    // The images outliving the pool are freed by their deleter.
+    std::weak_ptr<Storage> weak_storage = storage_;
+    return std::shared_ptr<Image>(image.release(), [weak_storage](Image *ptr) {
+        auto storage = weak_storage.lock();
+        if (storage) {
+            storage->Release(ptr);
+        } else {
+            delete ptr;
+        }
+    });
+}
+
+void ImagePool::Clear() {
+    std::lock_guard<std::mutex> lock(storage_->mutex_);
+    storage_->images_.clear();
+    storage_->statistics_.num_of_cached_images_ = 0;
+    storage_->statistics_.cached_bytes_ = 0;
+}
+
+void ImagePool::SetMaxCachedBytes(size_t max_cached_bytes) {
+    std::lock_guard<std::mutex> lock(storage_->mutex_);
+    storage_->max_cached_bytes_ = max_cached_bytes;
+    storage_->Trim();
+}
+
+size_t ImagePool::GetMaxCachedBytes() const {
+    std::lock_guard<std::mutex> lock(storage_->mutex_);
+    return storage_->max_cached_bytes_;
+}
+
+ImagePoolStatistics ImagePool::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(storage_->mutex_);
+    return storage_->statistics_;
+}
+
+void ImagePool::ResetStatistics() {
+    std::lock_guard<std::mutex> lock(storage_->mutex_);
+    storage_->statistics_.num_of_requests_ = 0;
+    storage_->statistics_.num_of_hits_ = 0;
+    storage_->statistics_.num_of_discards_ = 0;
+}
+
+ImagePool &GetImagePool() {
+    static ImagePool pool;
+    return pool;
+}
+
+}  // namespace geometry
+}  // namespace open3d
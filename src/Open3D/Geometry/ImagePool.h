@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "Open3D/Geometry/Image.h"
+
+namespace open3d {
+namespace geometry {
+
+/// Counters of an ImagePool.
+class ImagePoolStatistics {
+public:
+    /// Fraction of the requests served from the pool.
+    double GetHitRate() const {
+        return num_of_requests_ > 0
+                       ? double(num_of_hits_) / double(num_of_requests_)
+                       : 0.0;
+    }
+
+public:
+    size_t num_of_requests_ = 0;
+    size_t num_of_hits_ = 0;
+    /// Number of images given back to the pool but not kept because the
+    /// pool was full.
+    size_t num_of_discards_ = 0;
+    size_t num_of_cached_images_ = 0;
+    size_t cached_bytes_ = 0;
+};
+
+/// Pool of Images recycled by format (width, height, number of channels,
+/// bytes per channel).
+///
+/// Acquire returns an Image whose deleter gives it back to the pool when the
+/// last reference is dropped, so that images created frame after frame, for
+/// example by the filtering and pyramid functions, reuse the same buffers
+/// instead of going through the allocator. The pool keeps at most
+/// max_cached_bytes of idle images; images given back beyond that, or after
+/// the pool is destroyed, are freed. All member functions are thread-safe.
+class ImagePool {
+public:
+    explicit ImagePool(size_t max_cached_bytes = size_t(256) << 20);
+    ~ImagePool();
+    ImagePool(const ImagePool &) = delete;
+    ImagePool &operator=(const ImagePool &) = delete;
+
+public:
+    /// Function to get an image of the given format from the pool, or a new
+    /// one if none is idle. With \param clear_data, its pixels are zero,
+    /// otherwise they are left from its previous use.
+    std::shared_ptr<Image> Acquire(int width,
+                                   int height,
+                                   int num_of_channels,
+                                   int bytes_per_channel,
+                                   bool clear_data = true);
+
+    /// Function to free the idle images.
+    void Clear();
+
+    /// Function to set the maximum size of the idle images, 0 to disable
+    /// recycling.
+    void SetMaxCachedBytes(size_t max_cached_bytes);
+    size_t GetMaxCachedBytes() const;
+
+    ImagePoolStatistics GetStatistics() const;
+    void ResetStatistics();
+
+private:
+    class Storage;
+    std::shared_ptr<Storage> storage_;
+};
+
+/// Function to get the pool used by the image factory functions of the
+/// library. It keeps up to 256 MB of released images by default; call
+/// SetMaxCachedBytes to change that, 0 to disable recycling, and Clear to
+/// free the idle images.
+ImagePool &GetImagePool();
+
+/// Function to get an image from GetImagePool(), see ImagePool::Acquire.
+inline std::shared_ptr<Image> CreatePooledImage(int width,
+                                                int height,
+                                                int num_of_channels,
+                                                int bytes_per_channel,
+                                                bool clear_data = true) {
+    return GetImagePool().Acquire(width, height, num_of_channels,
+                                  bytes_per_channel, clear_data);
+}
+
+}  // namespace geometry
+}  // namespace open3d
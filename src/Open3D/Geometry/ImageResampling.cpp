@@ -0,0 +1,508 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/ImagePool.h"
+
+namespace {
+
+using open3d::geometry::Image;
+using open3d::geometry::ImageView;
+
+/// The output is processed in tiles distributed over the threads: the input
+/// pixels read by a tile span a compact region, which stays in cache while
+/// the tile is processed, even when the map of RemapImage bends the rows.
+const int kResamplingTileWidth = 128;
+const int kResamplingTileHeight = 32;
+
+/// Resampling weights along one axis: output sample i is the weighted sum of
+/// the input samples index_[k] with weights weight_[k], for k in
+/// [begin_[i], begin_[i + 1]). Indices increase with i.
+class ResamplingTaps {
+public:
+    ResamplingTaps(int input_size,
+                   int output_size,
+                   Image::InterpolationType type) {
+        begin_.reserve(output_size + 1);
+        begin_.push_back(0);
+        const double scale = double(input_size) / double(output_size);
+        for (int i = 0; i < output_size; i++) {
+            if (type == Image::InterpolationType::Nearest) {
+                Add(std::min(int(std::floor((i + 0.5) * scale)),
+                             input_size - 1),
+                    1.0);
+            } else if (type == Image::InterpolationType::Bilinear) {
+                const double x =
+                        std::min(std::max((i + 0.5) * scale - 0.5, 0.0),
+                                 double(input_size - 1));
+                const int j = int(x);
+                Add(j, 1.0 - (x - j));
+                Add(j + 1, x - j);
+            } else {
+                const double x0 = i * scale;
+                const double x1 = (i + 1) * scale;
+                for (int j = int(x0); j < input_size && j < x1; j++) {
+                    Add(j, (std::min(x1, j + 1.0) - std::max(x0, double(j))) /
+                                   scale);
+                }
+            }
+            begin_.push_back(int(index_.size()));
+        }
+    }
+
+private:
+    void Add(int index, double weight) {
+        // Taps without weight are dropped, so that they cannot propagate the
+        // NaNs of float images.
+        if (weight > 0.0) {
+            index_.push_back(index);
+            weight_.push_back(float(weight));
+        }
+    }
+
+public:
+    std::vector<int> begin_;
+    std::vector<int> index_;
+    std::vector<float> weight_;
+};
+
+template <typename T>
+inline T CastPixel(float value) {
+    return T(std::min(std::max(value + 0.5f, 0.0f),
+                      float(std::numeric_limits<T>::max())));
+}
+
+template <>
+inline float CastPixel<float>(float value) {
+    return value;
+}
+
+/// Function to call \param function(u0, v0, u1, v1, buffer) for the tiles
+/// [u0, u1) x [v0, v1) of a \param width x \param height output, in parallel,
+/// with a buffer that is private to each thread.
+template <typename Function>
+void ForEachTile(int width, int height, Function function) {
+    const int num_of_tiles_x =
+            (width + kResamplingTileWidth - 1) / kResamplingTileWidth;
+    const int num_of_tiles_y =
+            (height + kResamplingTileHeight - 1) / kResamplingTileHeight;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<float> buffer;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int t = 0; t < num_of_tiles_x * num_of_tiles_y; t++) {
+            const int u0 = (t % num_of_tiles_x) * kResamplingTileWidth;
+            const int v0 = (t / num_of_tiles_x) * kResamplingTileHeight;
+            function(u0, v0, std::min(u0 + kResamplingTileWidth, width),
+                     std::min(v0 + kResamplingTileHeight, height), buffer);
+        }
+    }
+}
+
+/// Separable resampling of a tile: for each output row, the input rows are
+/// first combined over the input columns read by the tile into a contiguous
+/// float row, which vectorises, then the columns of that row are combined.
+template <typename T, int C>
+void ResizeTile(const ImageView<const T, C> &input,
+                const ImageView<T, C> &output,
+                const ResamplingTaps &taps_x,
+                const ResamplingTaps &taps_y,
+                int u0,
+                int v0,
+                int u1,
+                int v1,
+                std::vector<float> &buffer) {
+    const int begin = taps_x.index_[taps_x.begin_[u0]];
+    const int end = taps_x.index_[taps_x.begin_[u1] - 1] + 1;
+    const int n = (end - begin) * C;
+    buffer.resize(n);
+    float *row = buffer.data();
+    for (int v = v0; v < v1; v++) {
+        for (int k = taps_y.begin_[v]; k < taps_y.begin_[v + 1]; k++) {
+            const T *p = input.Row(taps_y.index_[k]) + begin * C;
+            const float w = taps_y.weight_[k];
+            if (k == taps_y.begin_[v]) {
+                for (int i = 0; i < n; i++) {
+                    row[i] = w * float(p[i]);
+                }
+            } else {
+                for (int i = 0; i < n; i++) {
+                    row[i] += w * float(p[i]);
+                }
+            }
+        }
+        T *q = output.At(u0, v);
+        for (int u = u0; u < u1; u++, q += C) {
+            float sum[C] = {};
+            for (int k = taps_x.begin_[u]; k < taps_x.begin_[u + 1]; k++) {
+                const float *p = row + (taps_x.index_[k] - begin) * C;
+                const float w = taps_x.weight_[k];
+                for (int ch = 0; ch < C; ch++) {
+                    sum[ch] += w * p[ch];
+                }
+            }
+            for (int ch = 0; ch < C; ch++) {
+                q[ch] = CastPixel<T>(sum[ch]);
+            }
+        }
+    }
+}
+
+template <typename T, int C, bool Bilinear>
+void RemapTile(const ImageView<const T, C> &input,
+               const ImageView<const float, 2> &map,
+               const ImageView<T, C> &output,
+               int u0,
+               int v0,
+               int u1,
+               int v1) {
+    const float max_x = float(input.width_ - 1);
+    const float max_y = float(input.height_ - 1);
+    // The input covers [-0.5, size - 0.5] around its pixel centers.
+    const float limit_x = float(input.width_) - 0.5f;
+    const float limit_y = float(input.height_) - 0.5f;
+    // Offsets to the right and bottom neighbours, 0 for a single column or
+    // row
+    const int dx = std::min(1, input.width_ - 1) * C;
+    const int dy = std::min(1, input.height_ - 1);
+    for (int v = v0; v < v1; v++) {
+        const float *m = map.At(u0, v);
+        T *q = output.At(u0, v);
+        for (int u = u0; u < u1; u++, m += 2, q += C) {
+            // Also rejects NaN coordinates
+            if (!(m[0] >= -0.5f && m[0] <= limit_x && m[1] >= -0.5f &&
+                  m[1] <= limit_y)) {
+                for (int ch = 0; ch < C; ch++) {
+                    q[ch] = T(0);
+                }
+                continue;
+            }
+            // The border half pixels take the value of the edge, as in OpenCV
+            const float x = std::max(std::min(m[0], max_x), 0.0f);
+            const float y = std::max(std::min(m[1], max_y), 0.0f);
+            if (!Bilinear) {
+                const T *p = input.At(int(x + 0.5f), int(y + 0.5f));
+                for (int ch = 0; ch < C; ch++) {
+                    q[ch] = p[ch];
+                }
+                continue;
+            }
+            const int xi = std::max(std::min(int(x), input.width_ - 2), 0);
+            const int yi = std::max(std::min(int(y), input.height_ - 2), 0);
+            const float fx = x - xi, fy = y - yi;
+            const float w00 = (1.0f - fx) * (1.0f - fy), w01 = fx * (1.0f - fy);
+            const float w10 = (1.0f - fx) * fy, w11 = fx * fy;
+            const T *p0 = input.At(xi, yi);
+            const T *p1 = input.At(xi, yi + dy);
+            for (int ch = 0; ch < C; ch++) {
+                q[ch] = CastPixel<T>(w00 * p0[ch] + w01 * p0[ch + dx] +
+                                     w10 * p1[ch] + w11 * p1[ch + dx]);
+            }
+        }
+    }
+}
+
+/// Function to call \param op.Run<T, C>() for the pixel format of
+/// \param image.
+template <typename Op>
+bool DispatchPixelFormat(const Image &image, const Op &op) {
+    switch (image.bytes_per_channel_ * 10 + image.num_of_channels_) {
+        case 11:
+            return op.template Run<uint8_t, 1>();
+        case 13:
+            return op.template Run<uint8_t, 3>();
+        case 14:
+            return op.template Run<uint8_t, 4>();
+        case 21:
+            return op.template Run<uint16_t, 1>();
+        case 23:
+            return op.template Run<uint16_t, 3>();
+        case 24:
+            return op.template Run<uint16_t, 4>();
+        case 41:
+            return op.template Run<float, 1>();
+        case 43:
+            return op.template Run<float, 3>();
+        case 44:
+            return op.template Run<float, 4>();
+        default:
+            return false;
+    }
+}
+
+struct ResizeOp {
+    template <typename T, int C>
+    bool Run() const {
+        return open3d::geometry::ResizeImage<T, C>(
+                open3d::geometry::CreateImageView<T, C>(input_),
+                open3d::geometry::CreateImageView<T, C>(output_), type_);
+    }
+
+    const Image &input_;
+    Image &output_;
+    Image::InterpolationType type_;
+};
+
+struct RemapOp {
+    template <typename T, int C>
+    bool Run() const {
+        return open3d::geometry::RemapImage<T, C>(
+                open3d::geometry::CreateImageView<T, C>(input_),
+                open3d::geometry::CreateImageView<float, 2>(map_),
+                open3d::geometry::CreateImageView<T, C>(output_), type_);
+    }
+
+    const Image &input_;
+    const Image &map_;
+    Image &output_;
+    Image::InterpolationType type_;
+};
+
+}  // unnamed namespace
+
+namespace open3d {
+namespace geometry {
+
+template <typename T, int C>
+bool ResizeImage(const ImageView<const T, C> &input,
+                 const ImageView<T, C> &output,
+                 Image::InterpolationType type /* = Bilinear*/) {
+    if (input.IsEmpty() || output.IsEmpty()) {
+        utility::PrintWarning("[ResizeImage] Unsupported image size.\n");
+        return false;
+    }
+    const ResamplingTaps taps_x(input.width_, output.width_, type);
+    const ResamplingTaps taps_y(input.height_, output.height_, type);
+    ForEachTile(output.width_, output.height_,
+                [&](int u0, int v0, int u1, int v1,
+                    std::vector<float> &buffer) {
+                    ResizeTile(input, output, taps_x, taps_y, u0, v0, u1, v1,
+                               buffer);
+                });
+    return true;
+}
+
+std::shared_ptr<Image> ResizeImage(
+        const Image &input,
+        int width,
+        int height,
+        Image::InterpolationType type /* = Bilinear*/) {
+    if (input.IsEmpty() || width <= 0 || height <= 0) {
+        utility::PrintWarning("[ResizeImage] Unsupported image size.\n");
+        return std::make_shared<Image>();
+    }
+    auto output = CreatePooledImage(width, height, input.num_of_channels_,
+                                    input.bytes_per_channel_, false);
+    if (!DispatchPixelFormat(input, ResizeOp{input, *output, type})) {
+        utility::PrintWarning("[ResizeImage] Unsupported image format.\n");
+        return std::make_shared<Image>();
+    }
+    return output;
+}
+
+template <typename T, int C>
+bool RemapImage(const ImageView<const T, C> &input,
+                const ImageView<const float, 2> &map,
+                const ImageView<T, C> &output,
+                Image::InterpolationType type /* = Bilinear*/) {
+    if (input.IsEmpty() || map.IsEmpty() || output.width_ != map.width_ ||
+        output.height_ != map.height_) {
+        utility::PrintWarning("[RemapImage] Unsupported image size.\n");
+        return false;
+    }
+    if (type == Image::InterpolationType::Area) {
+        utility::PrintWarning(
+                "[RemapImage] Unsupported interpolation type.\n");
+        return false;
+    }
+    const bool bilinear = type == Image::InterpolationType::Bilinear;
+    ForEachTile(output.width_, output.height_,
+                [&](int u0, int v0, int u1, int v1, std::vector<float> &) {
+                    if (bilinear) {
+                        RemapTile<T, C, true>(input, map, output, u0, v0, u1,
+                                              v1);
+                    } else {
+                        RemapTile<T, C, false>(input, map, output, u0, v0,
+                                               u1, v1);
+                    }
+                });
+    return true;
+}
+
+std::shared_ptr<Image> RemapImage(
+        const Image &input,
+        const Image &map,
+        Image::InterpolationType type /* = Bilinear*/) {
+    if (input.IsEmpty() || map.IsEmpty()) {
+        utility::PrintWarning("[RemapImage] Unsupported image size.\n");
+        return std::make_shared<Image>();
+    }
+    if (map.num_of_channels_ != 2 || map.bytes_per_channel_ != 4) {
+        utility::PrintWarning("[RemapImage] Unsupported map format.\n");
+        return std::make_shared<Image>();
+    }
+    auto output =
+            CreatePooledImage(map.width_, map.height_, input.num_of_channels_,
+                              input.bytes_per_channel_, false);
+    if (!DispatchPixelFormat(input, RemapOp{input, map, *output, type})) {
+        utility::PrintWarning("[RemapImage] Unsupported image format.\n");
+        return std::make_shared<Image>();
+    }
+    return output;
+}
+
+std::shared_ptr<Image> CreateUndistortionMap(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const camera::PinholeCameraIntrinsic &undistorted_intrinsic) {
+    if (!intrinsic.IsValid() || !undistorted_intrinsic.IsValid()) {
+        utility::PrintWarning(
+                "[CreateUndistortionMap] Invalid camera intrinsic.\n");
+        return std::make_shared<Image>();
+    }
+    auto map = CreatePooledImage(undistorted_intrinsic.width_,
+                                 undistorted_intrinsic.height_, 2, 4, false);
+    const ImageView<float, 2> view = CreateImageView<float, 2>(*map);
+    const Eigen::Matrix3d &k = intrinsic.intrinsic_matrix_;
+    const Eigen::Matrix3d &k_undistorted =
+            undistorted_intrinsic.intrinsic_matrix_;
+    const double fx = k_undistorted(0, 0), fy = k_undistorted(1, 1);
+    const double cx = k_undistorted(0, 2), cy = k_undistorted(1, 2);
+    const double skew = k_undistorted(0, 1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < view.height_; v++) {
+        float *m = view.Row(v);
+        const double y = (v - cy) / fy;
+        for (int u = 0; u < view.width_; u++, m += 2) {
+            const Eigen::Vector2d p = intrinsic.DistortNormalizedPoint(
+                    Eigen::Vector2d((u - cx - skew * y) / fx, y));
+            m[0] = float(k(0, 0) * p(0) + k(0, 1) * p(1) + k(0, 2));
+            m[1] = float(k(1, 1) * p(1) + k(1, 2));
+        }
+    }
+    return map;
+}
+
+std::shared_ptr<Image> CreateUndistortionMap(
+        const camera::PinholeCameraIntrinsic &intrinsic) {
+    return CreateUndistortionMap(intrinsic, intrinsic);
+}
+
+std::shared_ptr<Image> UndistortImage(
+        const Image &input,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        Image::InterpolationType type /* = Bilinear*/) {
+    if (input.width_ != intrinsic.width_ ||
+        input.height_ != intrinsic.height_) {
+        utility::PrintWarning(
+                "[UndistortImage] Image size does not match camera "
+                "intrinsic.\n");
+        return std::make_shared<Image>();
+    }
+    if (!intrinsic.HasDistortion()) {
+        return std::make_shared<Image>(input);
+    }
+    return RemapImage(input, *CreateUndistortionMap(intrinsic), type);
+}
+
+template bool ResizeImage<uint8_t, 1>(const ImageView<const uint8_t, 1> &,
+                                      const ImageView<uint8_t, 1> &,
+                                      Image::InterpolationType);
+template bool ResizeImage<uint8_t, 3>(const ImageView<const uint8_t, 3> &,
+                                      const ImageView<uint8_t, 3> &,
+                                      Image::InterpolationType);
+template bool ResizeImage<uint8_t, 4>(const ImageView<const uint8_t, 4> &,
+                                      const ImageView<uint8_t, 4> &,
+                                      Image::InterpolationType);
+template bool ResizeImage<uint16_t, 1>(const ImageView<const uint16_t, 1> &,
+                                       const ImageView<uint16_t, 1> &,
+                                       Image::InterpolationType);
+template bool ResizeImage<uint16_t, 3>(const ImageView<const uint16_t, 3> &,
+                                       const ImageView<uint16_t, 3> &,
+                                       Image::InterpolationType);
+template bool ResizeImage<uint16_t, 4>(const ImageView<const uint16_t, 4> &,
+                                       const ImageView<uint16_t, 4> &,
+                                       Image::InterpolationType);
+template bool ResizeImage<float, 1>(const ImageView<const float, 1> &,
+                                    const ImageView<float, 1> &,
+                                    Image::InterpolationType);
+template bool ResizeImage<float, 3>(const ImageView<const float, 3> &,
+                                    const ImageView<float, 3> &,
+                                    Image::InterpolationType);
+template bool ResizeImage<float, 4>(const ImageView<const float, 4> &,
+                                    const ImageView<float, 4> &,
+                                    Image::InterpolationType);
+
+template bool RemapImage<uint8_t, 1>(const ImageView<const uint8_t, 1> &,
+                                     const ImageView<const float, 2> &,
+                                     const ImageView<uint8_t, 1> &,
+                                     Image::InterpolationType);
+template bool RemapImage<uint8_t, 3>(const ImageView<const uint8_t, 3> &,
+                                     const ImageView<const float, 2> &,
+                                     const ImageView<uint8_t, 3> &,
+                                     Image::InterpolationType);
+template bool RemapImage<uint8_t, 4>(const ImageView<const uint8_t, 4> &,
+                                     const ImageView<const float, 2> &,
+                                     const ImageView<uint8_t, 4> &,
+                                     Image::InterpolationType);
+template bool RemapImage<uint16_t, 1>(const ImageView<const uint16_t, 1> &,
+                                      const ImageView<const float, 2> &,
+                                      const ImageView<uint16_t, 1> &,
+                                      Image::InterpolationType);
+template bool RemapImage<uint16_t, 3>(const ImageView<const uint16_t, 3> &,
+                                      const ImageView<const float, 2> &,
+                                      const ImageView<uint16_t, 3> &,
+                                      Image::InterpolationType);
+template bool RemapImage<uint16_t, 4>(const ImageView<const uint16_t, 4> &,
+                                      const ImageView<const float, 2> &,
+                                      const ImageView<uint16_t, 4> &,
+                                      Image::InterpolationType);
+template bool RemapImage<float, 1>(const ImageView<const float, 1> &,
+                                   const ImageView<const float, 2> &,
+                                   const ImageView<float, 1> &,
+                                   Image::InterpolationType);
+template bool RemapImage<float, 3>(const ImageView<const float, 3> &,
+                                   const ImageView<const float, 2> &,
+                                   const ImageView<float, 3> &,
+                                   Image::InterpolationType);
+template bool RemapImage<float, 4>(const ImageView<const float, 4> &,
+                                   const ImageView<const float, 2> &,
+                                   const ImageView<float, 4> &,
+                                   Image::InterpolationType);
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace open3d {
+namespace geometry {
+
+/// Non-owning view of an image with C interleaved channels of type T.
+///
+/// Consecutive rows start stride_ bytes apart, so a view can describe an
+/// Image, a region of interest of a larger image, or a buffer owned by a
+/// camera driver or numpy, without copying any pixel. Views are cheap to
+/// copy; the owner of the memory must keep it alive while they are in use.
+/// A view of const T is read-only, and a view of T converts to it.
+template <typename T, int C = 1>
+class ImageView {
+public:
+    typedef typename std::
+            conditional<std::is_const<T>::value, const uint8_t, uint8_t>::type
+                    Byte;
+
+public:
+    ImageView() {}
+    /// \param stride is the distance between two rows in bytes, 0 for
+    /// contiguous rows.
+    ImageView(T *data, int width, int height, int stride = 0)
+        : data_(data),
+          width_(width),
+          height_(height),
+          stride_(stride > 0 ? stride : int(width * C * sizeof(T))) {}
+    template <typename U>
+    ImageView(const ImageView<U, C> &other,
+              typename std::enable_if<std::is_convertible<U *, T *>::value>::
+                      type * = nullptr)
+        : data_(other.data_),
+          width_(other.width_),
+          height_(other.height_),
+          stride_(other.stride_) {}
+
+public:
+    bool IsEmpty() const {
+        return data_ == nullptr || width_ <= 0 || height_ <= 0;
+    }
+
+    bool IsContiguous() const {
+        return stride_ == int(width_ * C * sizeof(T));
+    }
+
+    bool TestImageBoundary(double u,
+                           double v,
+                           double inner_margin = 0.0) const {
+        return (u >= inner_margin && u < width_ - inner_margin &&
+                v >= inner_margin && v < height_ - inner_margin);
+    }
+
+    /// Function to access the first pixel of row \param v.
+    T *Row(int v) const {
+        return reinterpret_cast<T *>(reinterpret_cast<Byte *>(data_) +
+                                     std::ptrdiff_t(v) * stride_);
+    }
+
+    /// Function to access the first channel of pixel (\param u, \param v).
+    T *At(int u, int v) const { return Row(v) + u * C; }
+
+    T &operator()(int u, int v, int ch = 0) const { return Row(v)[u * C + ch]; }
+
+    /// Function to view the \param width x \param height region whose top
+    /// left pixel is (\param u, \param v). The region must lie inside the
+    /// view.
+    ImageView Region(int u, int v, int width, int height) const {
+        return ImageView(At(u, v), width, height, stride_);
+    }
+
+public:
+    T *data_ = nullptr;
+    int width_ = 0;
+    int height_ = 0;
+    int stride_ = 0;
+};
+
+}  // namespace geometry
+}  // namespace open3d
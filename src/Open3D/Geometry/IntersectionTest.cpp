@@ -27,6 +27,9 @@
 #include "Open3D/Geometry/IntersectionTest.h"
 
 #include <tritriintersect/tri_tri_intersect.h>
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <cmath>
 
 namespace open3d {
 namespace geometry {
@@ -47,6 +50,79 @@ bool IntersectingAABBAABB(const Eigen::Vector3d& min0,
     return true;
 }
 
+int ClassifyAABBFrustum(const Eigen::Vector3d& min_bound,
+                        const Eigen::Vector3d& max_bound,
+                        const Eigen::Matrix4d& view_projection) {
+    int result = 1;
+    for (int i = 0; i < 6; ++i) {
+        // Planes w + x, w - x, w + y, w - y, w + z, w - z
+        Eigen::Vector4d plane = view_projection.row(3).transpose();
+        if (i % 2 == 0) {
+            plane += view_projection.row(i / 2).transpose();
+        } else {
+            plane -= view_projection.row(i / 2).transpose();
+        }
+        // Signed distances of the box corners closest to and farthest from
+        // the inner side of the plane
+        double near_dist = plane(3), far_dist = plane(3);
+        for (int j = 0; j < 3; ++j) {
+            double a = plane(j) * min_bound(j);
+            double b = plane(j) * max_bound(j);
+            near_dist += std::min(a, b);
+            far_dist += std::max(a, b);
+        }
+        if (far_dist < 0) {
+            return -1;
+        }
+        if (near_dist < 0) {
+            result = 0;
+        }
+    }
+    return result;
+}
+
+bool IntersectingTriangleAABB(const Eigen::Vector3d& p0,
+                              const Eigen::Vector3d& p1,
+                              const Eigen::Vector3d& p2,
+                              const Eigen::Vector3d& min_bound,
+                              const Eigen::Vector3d& max_bound) {
+    const Eigen::Vector3d center = (min_bound + max_bound) / 2;
+    const Eigen::Vector3d half = (max_bound - min_bound) / 2;
+    const Eigen::Vector3d v[3] = {p0 - center, p1 - center, p2 - center};
+
+    // Box face normals: overlap of the bounding intervals.
+    for (int i = 0; i < 3; ++i) {
+        double vmin = std::min(v[0](i), std::min(v[1](i), v[2](i)));
+        double vmax = std::max(v[0](i), std::max(v[1](i), v[2](i)));
+        if (vmin > half(i) || vmax < -half(i)) {
+            return false;
+        }
+    }
+
+    // Triangle normal.
+    const Eigen::Vector3d edges[3] = {v[1] - v[0], v[2] - v[1], v[0] - v[2]};
+    const Eigen::Vector3d normal = edges[0].cross(edges[1]);
+    if (std::abs(normal.dot(v[0])) > half.dot(normal.cwiseAbs())) {
+        return false;
+    }
+
+    // Cross products of the box axes with the triangle edges.
+    for (int i = 0; i < 3; ++i) {
+        for (const Eigen::Vector3d& edge : edges) {
+            Eigen::Vector3d axis = Eigen::Vector3d::Unit(i).cross(edge);
+            double d0 = axis.dot(v[0]);
+            double d1 = axis.dot(v[1]);
+            double d2 = axis.dot(v[2]);
+            double radius = half.dot(axis.cwiseAbs());
+            if (std::min(d0, std::min(d1, d2)) > radius ||
+                std::max(d0, std::max(d1, d2)) < -radius) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 bool IntersectingTriangleTriangle3d(const Eigen::Vector3d& p0,
                                     const Eigen::Vector3d& p1,
                                     const Eigen::Vector3d& p2,
@@ -36,6 +36,26 @@ bool IntersectingAABBAABB(const Eigen::Vector3d& min0,
                           const Eigen::Vector3d& min1,
                           const Eigen::Vector3d& max1);
 
+/// Classifies the axis aligned box [min_bound, max_bound] against the view
+/// frustum of an OpenGL style clip matrix, i.e. the points p with
+/// -w <= x, y, z <= w for (x, y, z, w) = view_projection * (p, 1).
+/// Returns -1 if the box is outside, 1 if it is inside and 0 otherwise. The
+/// test is conservative: boxes near the frustum edges may get 0 although they
+/// are outside.
+int ClassifyAABBFrustum(const Eigen::Vector3d& min_bound,
+                        const Eigen::Vector3d& max_bound,
+                        const Eigen::Matrix4d& view_projection);
+
+/// Exact overlap test of the triangle (p0, p1, p2) with the axis aligned box
+/// [min_bound, max_bound] using the separating axis theorem
+/// (Akenine-Moeller, "Fast 3D Triangle-Box Overlap Testing"). Touching
+/// counts as overlapping.
+bool IntersectingTriangleAABB(const Eigen::Vector3d& p0,
+                              const Eigen::Vector3d& p1,
+                              const Eigen::Vector3d& p2,
+                              const Eigen::Vector3d& min_bound,
+                              const Eigen::Vector3d& max_bound);
+
 bool IntersectingTriangleTriangle3d(const Eigen::Vector3d& p0,
                                     const Eigen::Vector3d& p1,
                                     const Eigen::Vector3d& p2,
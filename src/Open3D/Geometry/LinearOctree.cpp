@@ -0,0 +1,345 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/Geometry/LinearOctree.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Stable least significant digit radix sort of \param keys with the
+/// attached \param values, considering the lowest \param num_bits bits of the
+/// keys. Each pass computes per chunk digit histograms and scatters the
+/// chunks concurrently.
+void RadixSortByKey(std::vector<uint64_t>& keys,
+                    std::vector<int>& values,
+                    int num_bits) {
+    const int RADIX_BITS = 8;
+    const int RADIX = 1 << RADIX_BITS;
+    int64_t size = int64_t(keys.size());
+    int num_chunks = 1;
+#ifdef _OPENMP
+    num_chunks = omp_get_max_threads();
+#endif
+    std::vector<int64_t> bounds(num_chunks + 1);
+    for (int chunk = 0; chunk <= num_chunks; ++chunk) {
+        bounds[chunk] = size * chunk / num_chunks;
+    }
+
+    std::vector<uint64_t> keys_tmp(size);
+    std::vector<int> values_tmp(size);
+    std::vector<int64_t> offsets(num_chunks * RADIX);
+    for (int shift = 0; shift < num_bits; shift += RADIX_BITS) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
+            int64_t* histogram = &offsets[chunk * RADIX];
+            for (int64_t idx = bounds[chunk]; idx < bounds[chunk + 1]; ++idx) {
+                histogram[(keys[idx] >> shift) & (RADIX - 1)]++;
+            }
+        }
+
+        // exclusive prefix sum in (digit, chunk) order keeps the sort stable
+        int64_t sum = 0;
+        for (int digit = 0; digit < RADIX; ++digit) {
+            for (int chunk = 0; chunk < num_chunks; ++chunk) {
+                int64_t count = offsets[chunk * RADIX + digit];
+                offsets[chunk * RADIX + digit] = sum;
+                sum += count;
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
+            int64_t* offset = &offsets[chunk * RADIX];
+            for (int64_t idx = bounds[chunk]; idx < bounds[chunk + 1]; ++idx) {
+                int64_t dst = offset[(keys[idx] >> shift) & (RADIX - 1)]++;
+                keys_tmp[dst] = keys[idx];
+                values_tmp[dst] = values[idx];
+            }
+        }
+        keys.swap(keys_tmp);
+        values.swap(values_tmp);
+    }
+}
+
+/// Spreads the lowest 21 bits of \param a such that there are two zero bits
+/// between each of them.
+uint64_t SplitBy3(uint64_t a) {
+    uint64_t x = a & 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+
+/// Inverse of SplitBy3.
+uint64_t CompactBy3(uint64_t a) {
+    uint64_t x = a & 0x1249249249249249;
+    x = (x ^ (x >> 2)) & 0x10c30c30c30c30c3;
+    x = (x ^ (x >> 4)) & 0x100f00f00f00f00f;
+    x = (x ^ (x >> 8)) & 0x1f0000ff0000ff;
+    x = (x ^ (x >> 16)) & 0x1f00000000ffff;
+    x = (x ^ (x >> 32)) & 0x1fffff;
+    return x;
+}
+
+}  // unnamed namespace
+
+const size_t LinearOctree::MAX_DEPTH = 21;
+
+void LinearOctree::Clear() {
+    origin_.setZero();
+    size_ = 0;
+    leaf_codes_.clear();
+    leaf_colors_.clear();
+}
+
+bool LinearOctree::IsEmpty() const { return leaf_codes_.empty(); }
+
+uint64_t LinearOctree::EncodeMorton(const Eigen::Vector3i& grid_index) {
+    return SplitBy3(uint64_t(grid_index(0))) |
+           (SplitBy3(uint64_t(grid_index(1))) << 1) |
+           (SplitBy3(uint64_t(grid_index(2))) << 2);
+}
+
+Eigen::Vector3i LinearOctree::DecodeMorton(uint64_t code) {
+    return Eigen::Vector3i(int(CompactBy3(code)), int(CompactBy3(code >> 1)),
+                           int(CompactBy3(code >> 2)));
+}
+
+int64_t LinearOctree::ComputeLeafCode(const Eigen::Vector3d& point) const {
+    if (!Octree::IsPointInBound(point, origin_, size_)) {
+        return -1;
+    }
+    // Descend with the same arithmetic as Octree::InsertPoint, such that
+    // points on cell boundaries end up in the same leaves.
+    Eigen::Vector3d node_origin = origin_;
+    double node_size = size_;
+    uint64_t code = 0;
+    for (size_t depth = 0; depth < max_depth_; ++depth) {
+        double child_size = node_size / 2.0;
+        int x_index = point(0) < node_origin(0) + child_size ? 0 : 1;
+        int y_index = point(1) < node_origin(1) + child_size ? 0 : 1;
+        int z_index = point(2) < node_origin(2) + child_size ? 0 : 1;
+        code = (code << 3) | uint64_t(x_index + y_index * 2 + z_index * 4);
+        node_origin += Eigen::Vector3d(x_index * child_size,
+                                       y_index * child_size,
+                                       z_index * child_size);
+        node_size = child_size;
+    }
+    return int64_t(code);
+}
+
+void LinearOctree::ConvertFromPointCloud(const PointCloud& point_cloud,
+                                         double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        throw std::runtime_error("size_expand shall be between 0 and 1");
+    }
+    if (max_depth_ > MAX_DEPTH) {
+        throw std::runtime_error("max_depth shall be at most 21");
+    }
+
+    // Set bounds
+    Clear();
+    Eigen::Array3d min_bound = point_cloud.GetMinBound();
+    Eigen::Array3d max_bound = point_cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    Eigen::Array3d half_sizes = center - min_bound;
+    double max_half_size = half_sizes.maxCoeff();
+    origin_ = min_bound.min(center - max_half_size);
+    if (max_half_size == 0) {
+        size_ = size_expand;
+    } else {
+        size_ = max_half_size * 2 * (1 + size_expand);
+    }
+
+    // Compute leaf codes
+    int num_points = int(point_cloud.points_.size());
+    std::vector<int64_t> point_codes(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int idx = 0; idx < num_points; ++idx) {
+        point_codes[idx] = ComputeLeafCode(point_cloud.points_[idx]);
+    }
+    std::vector<uint64_t> codes;
+    std::vector<int> indices;
+    codes.reserve(num_points);
+    indices.reserve(num_points);
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (point_codes[idx] >= 0) {
+            codes.push_back(uint64_t(point_codes[idx]));
+            indices.push_back(idx);
+        }
+    }
+
+    // The sort is stable, the last point of a run of equal codes is the last
+    // inserted point of that leaf.
+    RadixSortByKey(codes, indices, int(3 * max_depth_));
+    bool has_colors = point_cloud.HasColors();
+    for (size_t idx = 0; idx < codes.size(); ++idx) {
+        if (idx + 1 < codes.size() && codes[idx] == codes[idx + 1]) {
+            continue;
+        }
+        leaf_codes_.push_back(codes[idx]);
+        leaf_colors_.push_back(has_colors
+                                       ? point_cloud.colors_[indices[idx]]
+                                       : Eigen::Vector3d::Zero().eval());
+    }
+}
+
+void LinearOctree::FromOctree(const Octree& octree) {
+    Clear();
+    origin_ = octree.origin_;
+    size_ = octree.size_;
+    max_depth_ = octree.max_depth_;
+    if (max_depth_ > MAX_DEPTH) {
+        throw std::runtime_error("max_depth shall be at most 21");
+    }
+
+    // The depth first traversal visits the leaves in Morton order
+    double leaf_size = size_ / double(uint64_t(1) << max_depth_);
+    auto f_collect_leaves =
+            [&](const std::shared_ptr<OctreeNode>& node,
+                const std::shared_ptr<OctreeNodeInfo>& node_info) -> void {
+        if (auto leaf_node = std::dynamic_pointer_cast<OctreeLeafNode>(node)) {
+            if (node_info->depth_ != max_depth_) {
+                utility::PrintWarning(
+                        "[LinearOctree] Ignore leaf node at depth %d.\n",
+                        int(node_info->depth_));
+                return;
+            }
+            Eigen::Vector3d grid_index =
+                    (node_info->origin_ - origin_) / leaf_size;
+            leaf_codes_.push_back(EncodeMorton(Eigen::Vector3i(
+                    int(std::round(grid_index(0))),
+                    int(std::round(grid_index(1))),
+                    int(std::round(grid_index(2))))));
+            auto color_leaf_node =
+                    std::dynamic_pointer_cast<OctreeColorLeafNode>(leaf_node);
+            leaf_colors_.push_back(color_leaf_node != nullptr
+                                           ? color_leaf_node->color_
+                                           : Eigen::Vector3d::Zero().eval());
+        }
+    };
+    octree.Traverse(f_collect_leaves);
+}
+
+std::shared_ptr<Octree> LinearOctree::ToOctree() const {
+    auto octree = std::make_shared<Octree>(max_depth_, origin_, size_);
+    if (IsEmpty()) {
+        return octree;
+    }
+    auto MakeLeaf = [&](size_t leaf_idx) {
+        auto leaf_node = std::make_shared<OctreeColorLeafNode>();
+        leaf_node->color_ = leaf_colors_[leaf_idx];
+        return leaf_node;
+    };
+    if (max_depth_ == 0) {
+        octree->root_node_ = MakeLeaf(0);
+        return octree;
+    }
+
+    // path[d] is the internal node at depth d of the previous leaf. As the
+    // leaves are sorted, only the nodes below the deepest common ancestor of
+    // consecutive leaves have to be created.
+    std::vector<std::shared_ptr<OctreeInternalNode>> path(max_depth_);
+    path[0] = std::make_shared<OctreeInternalNode>();
+    octree->root_node_ = path[0];
+    for (size_t leaf_idx = 0; leaf_idx < leaf_codes_.size(); ++leaf_idx) {
+        uint64_t code = leaf_codes_[leaf_idx];
+        size_t depth = 0;
+        if (leaf_idx > 0) {
+            uint64_t diff = code ^ leaf_codes_[leaf_idx - 1];
+            while ((diff >> (3 * (max_depth_ - 1 - depth))) == 0) {
+                depth++;
+            }
+        }
+        for (; depth + 1 < max_depth_; ++depth) {
+            int child_index =
+                    int((code >> (3 * (max_depth_ - 1 - depth))) & 7);
+            path[depth + 1] = std::make_shared<OctreeInternalNode>();
+            path[depth]->children_[child_index] = path[depth + 1];
+        }
+        path[max_depth_ - 1]->children_[code & 7] = MakeLeaf(leaf_idx);
+    }
+    return octree;
+}
+
+int LinearOctree::LocateLeaf(const Eigen::Vector3d& point) const {
+    int64_t code = ComputeLeafCode(point);
+    if (code < 0) {
+        return -1;
+    }
+    auto it = std::lower_bound(leaf_codes_.begin(), leaf_codes_.end(),
+                               uint64_t(code));
+    if (it == leaf_codes_.end() || *it != uint64_t(code)) {
+        return -1;
+    }
+    return int(it - leaf_codes_.begin());
+}
+
+std::pair<size_t, size_t> LinearOctree::GetLeafRange(uint64_t node_code,
+                                                     size_t depth) const {
+    int shift = int(3 * (max_depth_ - depth));
+    auto first = std::lower_bound(leaf_codes_.begin(), leaf_codes_.end(),
+                                  node_code << shift);
+    auto last = std::lower_bound(first, leaf_codes_.end(),
+                                 (node_code + 1) << shift);
+    return std::make_pair(size_t(first - leaf_codes_.begin()),
+                          size_t(last - leaf_codes_.begin()));
+}
+
+OctreeNodeInfo LinearOctree::GetNodeInfo(uint64_t node_code,
+                                         size_t depth) const {
+    double node_size = size_ / double(uint64_t(1) << depth);
+    Eigen::Vector3d node_origin =
+            origin_ + DecodeMorton(node_code).cast<double>() * node_size;
+    return OctreeNodeInfo(node_origin, node_size, depth,
+                          depth == 0 ? 0 : size_t(node_code & 7));
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/Octree.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+
+/// Pointerless octree that stores only the leaves at max_depth_, as sorted
+/// Morton codes with contiguous payload arrays. The node hierarchy is
+/// implicit: the ancestor of a leaf at depth d has the code
+/// leaf_code >> (3 * (max_depth_ - d)), and the leaves below a node form a
+/// contiguous range of leaf_codes_.
+///
+/// The 3 bits of a code per level follow the child index convention of
+/// OctreeInternalNode, i.e. child_index = x + 2 * y + 4 * z, such that the
+/// leaves are sorted in the same order as the depth first traversal of
+/// Octree.
+class LinearOctree {
+public:
+    LinearOctree() {}
+    LinearOctree(size_t max_depth) : max_depth_(max_depth) {}
+    LinearOctree(size_t max_depth, const Eigen::Vector3d& origin, double size)
+        : origin_(origin), size_(size), max_depth_(max_depth) {}
+    ~LinearOctree() {}
+
+public:
+    void Clear();
+    bool IsEmpty() const;
+    size_t NumberOfLeaves() const { return leaf_codes_.size(); }
+
+    /// Builds the octree from the point cloud with the same bounds as
+    /// Octree::ConvertFromPointCloud. The Morton codes of the points are
+    /// computed and radix sorted in parallel. If several points fall into
+    /// the same leaf, the color of the last point is kept.
+    void ConvertFromPointCloud(const PointCloud& point_cloud,
+                               double size_expand = 0.01);
+
+    /// Converts from an Octree, whose color leaves have to be at max_depth_.
+    void FromOctree(const Octree& octree);
+
+    /// Converts to an Octree with OctreeColorLeafNode leaves.
+    std::shared_ptr<Octree> ToOctree() const;
+
+    /// Returns the Morton code of the leaf cell that contains \param point,
+    /// -1 if the point is out of bound.
+    int64_t ComputeLeafCode(const Eigen::Vector3d& point) const;
+
+    /// Returns the index of the leaf that contains \param point, -1 if there
+    /// is no such leaf.
+    int LocateLeaf(const Eigen::Vector3d& point) const;
+
+    /// Returns the range [first, second) of the leaves below the node with
+    /// code \param node_code at depth \param depth.
+    std::pair<size_t, size_t> GetLeafRange(uint64_t node_code,
+                                           size_t depth) const;
+
+    /// Returns the origin, size and depth of the node with code
+    /// \param node_code at depth \param depth.
+    OctreeNodeInfo GetNodeInfo(uint64_t node_code, size_t depth) const;
+
+    /// Interleaves the bits of the grid index to a Morton code.
+    static uint64_t EncodeMorton(const Eigen::Vector3i& grid_index);
+
+    /// Inverse of EncodeMorton.
+    static Eigen::Vector3i DecodeMorton(uint64_t code);
+
+public:
+    /// Maximum supported depth, such that the codes fit into 63 bits.
+    static const size_t MAX_DEPTH;
+
+    /// Global min bound (include), see Octree::origin_.
+    Eigen::Vector3d origin_ = Eigen::Vector3d(0, 0, 0);
+
+    /// Outer bounding box edge size, see Octree::size_.
+    double size_ = 0;
+
+    /// Depth of the leaves.
+    size_t max_depth_ = 0;
+
+    /// Sorted, unique Morton codes of the leaves.
+    std::vector<uint64_t> leaf_codes_;
+
+    /// Color of each leaf.
+    std::vector<Eigen::Vector3d> leaf_colors_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
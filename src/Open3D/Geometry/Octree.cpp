@@ -48,6 +48,8 @@ std::shared_ptr<OctreeNode> OctreeNode::ConstructFromJsonValue(
             node = std::make_shared<OctreeInternalNode>();
         } else if (class_name == "OctreeColorLeafNode") {
             node = std::make_shared<OctreeColorLeafNode>();
+        } else if (class_name == "OctreePointColorLeafNode") {
+            node = std::make_shared<OctreePointColorLeafNode>();
         } else {
             utility::PrintWarning("Unhandled class name %s\n",
                                   class_name.c_str());
@@ -180,6 +182,91 @@ bool OctreeColorLeafNode::ConvertFromJsonValue(const Json::Value& value) {
     return EigenVector3dFromJsonArray(color_, value["color"]);
 }
 
+std::function<std::shared_ptr<OctreeLeafNode>()>
+OctreePointColorLeafNode::GetInitFunction() {
+    return []() -> std::shared_ptr<geometry::OctreeLeafNode> {
+        return std::make_shared<geometry::OctreePointColorLeafNode>();
+    };
+}
+
+std::function<void(std::shared_ptr<OctreeLeafNode>)>
+OctreePointColorLeafNode::GetUpdateFunction(size_t index,
+                                            const Eigen::Vector3d& point,
+                                            const Eigen::Vector3d& color) {
+    return [index, point,
+            color](std::shared_ptr<geometry::OctreeLeafNode> node) -> void {
+        if (auto point_leaf_node = std::dynamic_pointer_cast<
+                    geometry::OctreePointColorLeafNode>(node)) {
+            point_leaf_node->color_ = color;
+            point_leaf_node->indices_.push_back(index);
+            point_leaf_node->points_.push_back(point);
+        } else {
+            throw std::runtime_error(
+                    "Internal error: leaf node must be "
+                    "OctreePointColorLeafNode");
+        }
+    };
+}
+
+std::shared_ptr<OctreeLeafNode> OctreePointColorLeafNode::Clone() const {
+    auto cloned_node = std::make_shared<OctreePointColorLeafNode>();
+    cloned_node->color_ = color_;
+    cloned_node->indices_ = indices_;
+    cloned_node->points_ = points_;
+    return cloned_node;
+}
+
+bool OctreePointColorLeafNode::operator==(const OctreeLeafNode& that) const {
+    if (!OctreeColorLeafNode::operator==(that)) {
+        return false;
+    }
+    auto that_point_node = dynamic_cast<const OctreePointColorLeafNode*>(&that);
+    return that_point_node == nullptr ||
+           this->indices_ == that_point_node->indices_;
+}
+
+bool OctreePointColorLeafNode::ConvertToJsonValue(Json::Value& value) const {
+    value["class_name"] = "OctreePointColorLeafNode";
+    value["indices"] = Json::arrayValue;
+    value["points"] = Json::arrayValue;
+    bool rc = true;
+    for (size_t i = 0; i < indices_.size(); ++i) {
+        Json::Value point;
+        rc = rc && EigenVector3dToJsonArray(points_[i], point);
+        value["indices"].append(Json::UInt64(indices_[i]));
+        value["points"].append(point);
+    }
+    return rc && EigenVector3dToJsonArray(color_, value["color"]);
+}
+
+bool OctreePointColorLeafNode::ConvertFromJsonValue(const Json::Value& value) {
+    if (value.isObject() == false) {
+        utility::PrintWarning(
+                "OctreePointColorLeafNode read JSON failed: unsupported json "
+                "format.\n");
+        return false;
+    }
+    if (value.get("class_name", "") != "OctreePointColorLeafNode") {
+        return false;
+    }
+    const Json::Value& indices = value["indices"];
+    const Json::Value& points = value["points"];
+    if (indices.size() != points.size()) {
+        utility::PrintWarning(
+                "OctreePointColorLeafNode read JSON failed: indices and "
+                "points have different sizes.\n");
+        return false;
+    }
+    bool rc = true;
+    indices_.resize(indices.size());
+    points_.resize(points.size());
+    for (Json::ArrayIndex i = 0; i < indices.size(); ++i) {
+        indices_[i] = size_t(indices[i].asUInt64());
+        rc = rc && EigenVector3dFromJsonArray(points_[i], points[i]);
+    }
+    return rc && EigenVector3dFromJsonArray(color_, value["color"]);
+}
+
 Octree::Octree(const Octree& src_octree)
     : Geometry3D(Geometry::GeometryType::Octree),
       max_depth_(src_octree.max_depth_),
@@ -376,7 +463,8 @@ Octree& Octree::Rotate(const Eigen::Vector3d& rotation,
 }
 
 void Octree::ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
-                                   double size_expand) {
+                                   double size_expand,
+                                   bool store_points) {
     if (size_expand > 1 || size_expand < 0) {
         throw std::runtime_error("size_expand shall be between 0 and 1");
     }
@@ -396,11 +484,23 @@ void Octree::ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
     }
 
     // Insert points
+    bool has_colors = point_cloud.HasColors();
     for (size_t idx = 0; idx < point_cloud.points_.size(); idx++) {
-        InsertPoint(point_cloud.points_[idx],
-                    geometry::OctreeColorLeafNode::GetInitFunction(),
-                    geometry::OctreeColorLeafNode::GetUpdateFunction(
-                            point_cloud.colors_[idx]));
+        Eigen::Vector3d color(0, 0, 0);
+        if (has_colors) {
+            color = point_cloud.colors_[idx];
+        }
+        if (store_points) {
+            InsertPoint(point_cloud.points_[idx],
+                        geometry::OctreePointColorLeafNode::GetInitFunction(),
+                        geometry::OctreePointColorLeafNode::GetUpdateFunction(
+                                idx, point_cloud.points_[idx], color));
+        } else {
+            InsertPoint(point_cloud.points_[idx],
+                        geometry::OctreeColorLeafNode::GetInitFunction(),
+                        geometry::OctreeColorLeafNode::GetUpdateFunction(
+                                color));
+        }
     }
 }
 
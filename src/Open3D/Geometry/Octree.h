@@ -126,6 +126,27 @@ public:
     Eigen::Vector3d color_ = Eigen::Vector3d(0, 0, 0);
 };
 
+/// Color leaf node that additionally keeps the points falling into it, so that
+/// the Octree can answer nearest neighbor and range queries on its own.
+/// indices_ are the indices of the points in the source point cloud.
+class OctreePointColorLeafNode : public OctreeColorLeafNode {
+public:
+    /// Compares colors, and also indices if other is a point leaf node
+    bool operator==(const OctreeLeafNode& other) const override;
+    std::shared_ptr<OctreeLeafNode> Clone() const override;
+    static std::function<std::shared_ptr<OctreeLeafNode>()> GetInitFunction();
+    static std::function<void(std::shared_ptr<OctreeLeafNode>)>
+    GetUpdateFunction(size_t index,
+                      const Eigen::Vector3d& point,
+                      const Eigen::Vector3d& color);
+
+    bool ConvertToJsonValue(Json::Value& value) const override;
+    bool ConvertFromJsonValue(const Json::Value& value) override;
+
+    std::vector<size_t> indices_;
+    std::vector<Eigen::Vector3d> points_;
+};
+
 class Octree : public Geometry3D, public utility::IJsonConvertible {
 public:
     Octree() : Geometry3D(Geometry::GeometryType::Octree) {}
@@ -156,8 +177,12 @@ public:
     bool ConvertFromJsonValue(const Json::Value& value) override;
 
 public:
+    /// Builds the octree with OctreeColorLeafNode leaves, or with
+    /// OctreePointColorLeafNode leaves keeping the points and their indices
+    /// if \param store_points is set, as the spatial queries require.
     void ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
-                               double size_expand = 0.01);
+                               double size_expand = 0.01,
+                               bool store_points = false);
 
     /// Root of the octree
     std::shared_ptr<OctreeNode> root_node_ = nullptr;
@@ -213,6 +238,71 @@ public:
     /// Convert from voxel grid
     void FromVoxelGrid(const geometry::VoxelGrid& voxel_grid);
 
+    /// Spatial queries. The point queries below only see points stored in
+    /// OctreePointColorLeafNode leaves, i.e. octrees built with
+    /// ConvertFromPointCloud and store_points. Returned indices refer to the
+    /// source point
+    /// cloud. Like KDTreeFlann, they return the number of points found and
+    /// sort the results by ascending squared distance.
+
+    /// Find the knn nearest points to query, using a depth-first traversal
+    /// that visits the closest children first and prunes the nodes farther
+    /// than the current knn-th neighbor
+    int SearchKNN(const Eigen::Vector3d& query,
+                  int knn,
+                  std::vector<int>& indices,
+                  std::vector<double>& distance2) const;
+
+    /// Find all points within radius of query
+    int SearchRadius(const Eigen::Vector3d& query,
+                     double radius,
+                     std::vector<int>& indices,
+                     std::vector<double>& distance2) const;
+
+    /// Batched SearchKNN, queries are processed in parallel
+    void SearchKNN(const std::vector<Eigen::Vector3d>& queries,
+                   int knn,
+                   std::vector<std::vector<int>>& indices,
+                   std::vector<std::vector<double>>& distance2) const;
+
+    /// Batched SearchRadius, queries are processed in parallel
+    void SearchRadius(const std::vector<Eigen::Vector3d>& queries,
+                      double radius,
+                      std::vector<std::vector<int>>& indices,
+                      std::vector<std::vector<double>>& distance2) const;
+
+    /// Find all points inside the axis aligned box [min_bound, max_bound].
+    /// Indices are returned in depth-first leaf order.
+    int SearchBox(const Eigen::Vector3d& min_bound,
+                  const Eigen::Vector3d& max_bound,
+                  std::vector<int>& indices) const;
+
+    /// Find all points inside the view frustum of the OpenGL style clip
+    /// transformation view_projection (projection * view * model), i.e.
+    /// points p with -w <= x, y, z <= w for (x, y, z, w) = view_projection *
+    /// (p, 1). Indices are returned in depth-first leaf order.
+    int SearchFrustum(const Eigen::Matrix4d& view_projection,
+                      std::vector<int>& indices) const;
+
+    /// Collect the nodes whose bounds intersect the axis aligned box
+    /// [min_bound, max_bound] in depth-first order. If lod_depth >= 0, the
+    /// traversal stops at depth lod_depth and reports the internal nodes there
+    /// as a coarser level of detail, otherwise only leaf nodes are reported.
+    std::vector<std::pair<std::shared_ptr<OctreeNode>,
+                          std::shared_ptr<OctreeNodeInfo>>>
+    LocateNodesInBox(const Eigen::Vector3d& min_bound,
+                     const Eigen::Vector3d& max_bound,
+                     int lod_depth = -1) const;
+
+    /// Collect the nodes whose bounds intersect the view frustum of
+    /// view_projection, see SearchFrustum and LocateNodesInBox. Used for view
+    /// frustum culling, e.g. with the projection and view matrices of a
+    /// ViewControl.
+    std::vector<std::pair<std::shared_ptr<OctreeNode>,
+                          std::shared_ptr<OctreeNodeInfo>>>
+    LocateNodesInFrustum(const Eigen::Matrix4d& view_projection,
+                         int lod_depth = -1) const;
+
 private:
     static void TraverseRecurse(
             const std::shared_ptr<OctreeNode>& node,
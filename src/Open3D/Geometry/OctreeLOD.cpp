@@ -0,0 +1,279 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/OctreeLOD.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/IntersectionTest.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Appends the subtree of node to nodes in depth first order. Returns the
+/// index of the subtree's root, or -1 if the subtree contains no points.
+int ConvertFromOctreeRecurse(const std::shared_ptr<OctreeNode>& node,
+                             const Eigen::Vector3d& origin,
+                             double size,
+                             size_t depth,
+                             size_t resolution,
+                             std::vector<OctreeLODNode>& nodes) {
+    if (auto leaf_node =
+                std::dynamic_pointer_cast<OctreePointColorLeafNode>(node)) {
+        if (leaf_node->indices_.empty()) {
+            return -1;
+        }
+        nodes.emplace_back();
+        OctreeLODNode& lod_node = nodes.back();
+        lod_node.origin_ = origin;
+        lod_node.size_ = size;
+        lod_node.depth_ = depth;
+        lod_node.indices_ = leaf_node->indices_;
+        lod_node.points_ = leaf_node->points_;
+        return int(nodes.size()) - 1;
+    }
+    auto internal_node = std::dynamic_pointer_cast<OctreeInternalNode>(node);
+    if (internal_node == nullptr) {
+        return -1;
+    }
+
+    // nodes may be reallocated by the recursion, so refer to the node by
+    // index only
+    size_t index = nodes.size();
+    nodes.emplace_back();
+    nodes[index].origin_ = origin;
+    nodes[index].size_ = size;
+    nodes[index].depth_ = depth;
+    double child_size = size / 2.0;
+    for (size_t cid = 0; cid < 8; ++cid) {
+        Eigen::Vector3d child_offset(cid % 2, (cid / 2) % 2, (cid / 4) % 2);
+        Eigen::Vector3d child_origin = origin + child_offset * child_size;
+        int child_index = ConvertFromOctreeRecurse(
+                internal_node->children_[cid], child_origin, child_size,
+                depth + 1, resolution, nodes);
+        if (child_index >= 0) {
+            nodes[index].children_.push_back(size_t(child_index));
+        }
+    }
+    if (nodes[index].children_.empty()) {
+        nodes.pop_back();
+        return -1;
+    }
+
+    // Keep the point closest to the center of each grid cell
+    OctreeLODNode& lod_node = nodes[index];
+    double cell_size = size / double(resolution);
+    std::unordered_map<size_t, size_t> cell_to_sample;
+    std::vector<double> sample_distance2;
+    for (size_t child_index : lod_node.children_) {
+        const OctreeLODNode& child = nodes[child_index];
+        for (size_t i = 0; i < child.points_.size(); ++i) {
+            const Eigen::Vector3d& point = child.points_[i];
+            Eigen::Vector3i cell =
+                    ((point - origin) / cell_size)
+                            .array()
+                            .floor()
+                            .cast<int>()
+                            .max(0)
+                            .min(int(resolution) - 1)
+                            .matrix();
+            size_t key = size_t(cell(0)) +
+                         resolution * (size_t(cell(1)) +
+                                       resolution * size_t(cell(2)));
+            double distance2 =
+                    (point - origin -
+                     (cell.cast<double>().array() + 0.5).matrix() * cell_size)
+                            .squaredNorm();
+            auto it = cell_to_sample.find(key);
+            if (it == cell_to_sample.end()) {
+                cell_to_sample[key] = lod_node.indices_.size();
+                lod_node.indices_.push_back(child.indices_[i]);
+                lod_node.points_.push_back(point);
+                sample_distance2.push_back(distance2);
+            } else if (distance2 < sample_distance2[it->second]) {
+                lod_node.indices_[it->second] = child.indices_[i];
+                lod_node.points_[it->second] = point;
+                sample_distance2[it->second] = distance2;
+            }
+        }
+    }
+    return int(index);
+}
+
+/// Pinhole camera as an OpenGL style clip matrix for ClassifyAABBFrustum,
+/// with the near plane through the camera center and no far plane.
+Eigen::Matrix4d ComputeViewProjection(
+        const camera::PinholeCameraParameters& camera) {
+    const camera::PinholeCameraIntrinsic& intrinsic = camera.intrinsic_;
+    double fx, fy, cx, cy;
+    std::tie(fx, fy) = intrinsic.GetFocalLength();
+    std::tie(cx, cy) = intrinsic.GetPrincipalPoint();
+    Eigen::Matrix4d projection = Eigen::Matrix4d::Zero();
+    projection(0, 0) = 2.0 * fx / intrinsic.width_;
+    projection(0, 2) = 2.0 * cx / intrinsic.width_ - 1.0;
+    projection(1, 1) = 2.0 * fy / intrinsic.height_;
+    projection(1, 2) = 2.0 * cy / intrinsic.height_ - 1.0;
+    projection(2, 2) = 1.0;
+    projection(3, 2) = 1.0;
+    return projection * camera.extrinsic_;
+}
+
+double ComputeNodeScreenSpaceError(const OctreeLODNode& node,
+                                   size_t resolution,
+                                   const Eigen::Vector3d& camera_center,
+                                   double focal_length) {
+    if (node.IsLeaf()) {
+        return 0.0;
+    }
+    Eigen::Vector3d node_max =
+            node.origin_ + Eigen::Vector3d(node.size_, node.size_, node.size_);
+    double distance = (node.origin_ - camera_center)
+                              .cwiseMax(camera_center - node_max)
+                              .cwiseMax(0.0)
+                              .norm();
+    if (distance == 0.0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return node.size_ / double(resolution) * focal_length / distance;
+}
+
+Eigen::Vector3d ComputeCameraCenter(
+        const camera::PinholeCameraParameters& camera) {
+    Eigen::Matrix3d rotation = camera.extrinsic_.block<3, 3>(0, 0);
+    Eigen::Vector3d translation = camera.extrinsic_.block<3, 1>(0, 3);
+    return -rotation.transpose() * translation;
+}
+
+double ComputeFocalLength(const camera::PinholeCameraParameters& camera) {
+    std::pair<double, double> focal_length =
+            camera.intrinsic_.GetFocalLength();
+    return std::max(focal_length.first, focal_length.second);
+}
+
+}  // unnamed namespace
+
+void OctreeLOD::Clear() { nodes_.clear(); }
+
+bool OctreeLOD::IsEmpty() const { return nodes_.empty(); }
+
+bool OctreeLOD::ConvertFromOctree(const Octree& octree, size_t resolution) {
+    Clear();
+    resolution_ = std::max(resolution, size_t(1));
+    ConvertFromOctreeRecurse(octree.root_node_, octree.origin_, octree.size_,
+                             0, resolution_, nodes_);
+    if (IsEmpty()) {
+        utility::PrintWarning(
+                "[OctreeLOD::ConvertFromOctree] octree has no "
+                "OctreePointColorLeafNode with points.\n");
+        return false;
+    }
+    return true;
+}
+
+double OctreeLOD::ComputeScreenSpaceError(
+        size_t node_index,
+        const camera::PinholeCameraParameters& camera) const {
+    return ComputeNodeScreenSpaceError(nodes_[node_index], resolution_,
+                                       ComputeCameraCenter(camera),
+                                       ComputeFocalLength(camera));
+}
+
+std::vector<size_t> OctreeLOD::SelectNodes(
+        const camera::PinholeCameraParameters& camera,
+        double max_screen_space_error,
+        size_t max_points) const {
+    std::vector<size_t> selected_nodes;
+    if (IsEmpty()) {
+        return selected_nodes;
+    }
+    Eigen::Matrix4d view_projection = ComputeViewProjection(camera);
+    Eigen::Vector3d camera_center = ComputeCameraCenter(camera);
+    double focal_length = ComputeFocalLength(camera);
+    auto is_visible = [this, &view_projection](size_t node_index) {
+        const OctreeLODNode& node = nodes_[node_index];
+        Eigen::Vector3d node_max =
+                node.origin_ +
+                Eigen::Vector3d(node.size_, node.size_, node.size_);
+        return ClassifyAABBFrustum(node.origin_, node_max, view_projection) >=
+               0;
+    };
+    if (!is_visible(0)) {
+        return selected_nodes;
+    }
+
+    // Visible nodes that may be refined, largest error first
+    std::priority_queue<std::pair<double, size_t>> queue;
+    queue.push(std::make_pair(
+            ComputeNodeScreenSpaceError(nodes_[0], resolution_, camera_center,
+                                        focal_length),
+            0));
+    size_t num_points = nodes_[0].indices_.size();
+    std::vector<size_t> visible_children;
+    while (!queue.empty()) {
+        double error = queue.top().first;
+        size_t node_index = queue.top().second;
+        queue.pop();
+        const OctreeLODNode& node = nodes_[node_index];
+        if (error <= max_screen_space_error) {
+            selected_nodes.push_back(node_index);
+            continue;
+        }
+        visible_children.clear();
+        size_t num_child_points = 0;
+        for (size_t child_index : node.children_) {
+            if (is_visible(child_index)) {
+                visible_children.push_back(child_index);
+                num_child_points += nodes_[child_index].indices_.size();
+            }
+        }
+        if (num_points - node.indices_.size() + num_child_points >
+            max_points) {
+            selected_nodes.push_back(node_index);
+            continue;
+        }
+        num_points = num_points - node.indices_.size() + num_child_points;
+        for (size_t child_index : visible_children) {
+            queue.push(std::make_pair(
+                    ComputeNodeScreenSpaceError(nodes_[child_index],
+                                                resolution_, camera_center,
+                                                focal_length),
+                    child_index));
+        }
+    }
+    return selected_nodes;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/Octree.h"
+
+namespace open3d {
+
+namespace camera {
+class PinholeCameraParameters;
+}
+
+namespace geometry {
+
+/// Node of an OctreeLOD
+class OctreeLODNode {
+public:
+    /// Cube of the node, as in OctreeNodeInfo.
+    Eigen::Vector3d origin_ = Eigen::Vector3d(0, 0, 0);
+    double size_ = 0;
+    size_t depth_ = 0;
+
+    /// Indices of the existing children in OctreeLOD::nodes_, empty for leaves.
+    std::vector<size_t> children_;
+
+    /// All points of a leaf, or the representative subsample of an internal
+    /// node. indices_ refer to the source point cloud.
+    std::vector<size_t> indices_;
+    std::vector<Eigen::Vector3d> points_;
+
+public:
+    bool IsLeaf() const { return children_.empty(); }
+};
+
+/// Multi-resolution point hierarchy for rendering large point clouds. Every
+/// internal node holds a representative subsample of its points with at most
+/// one point per cell of a resolution_^3 grid over the node, so its point
+/// spacing is about size_ / resolution_. Leaves hold all their points.
+///
+/// SelectNodes picks the nodes to draw for a camera by their screen-space
+/// error, under a point budget that bounds the rendering cost regardless of
+/// the size of the point cloud.
+class OctreeLOD {
+public:
+    OctreeLOD() {}
+    ~OctreeLOD() {}
+
+public:
+    void Clear();
+    bool IsEmpty() const;
+
+    /// Builds the hierarchy from an octree created by
+    /// Octree::ConvertFromPointCloud with store_points, i.e. with
+    /// OctreePointColorLeafNode leaves. The subsample of an internal node
+    /// keeps, for each grid cell, the point of its children's samples closest
+    /// to the cell center.
+    /// Returns false if the octree has no point leaves.
+    bool ConvertFromOctree(const Octree& octree, size_t resolution = 32);
+
+    /// Returns the projected point spacing of the node in pixels. Leaves have
+    /// no error, nodes containing the camera center have infinite error.
+    double ComputeScreenSpaceError(
+            size_t node_index,
+            const camera::PinholeCameraParameters& camera) const;
+
+    /// Selects the nodes to draw for camera. Starting from the root, the
+    /// visible node with the largest screen-space error is replaced by its
+    /// visible children until all selected nodes have an error of at most
+    /// max_screen_space_error pixels, or refining would exceed max_points.
+    /// The parameters of a Visualizer's camera can be obtained with
+    /// ViewControl::ConvertToPinholeCameraParameters.
+    std::vector<size_t> SelectNodes(
+            const camera::PinholeCameraParameters& camera,
+            double max_screen_space_error = 1.0,
+            size_t max_points = 1000000) const;
+
+public:
+    /// Nodes in depth first order, nodes_[0] is the root.
+    std::vector<OctreeLODNode> nodes_;
+
+    /// Grid resolution of the internal node subsamples.
+    size_t resolution_ = 32;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,407 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/Octree.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <limits>
+
+#include "Open3D/Geometry/IntersectionTest.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Relation of a node's cube to a query volume
+enum class Overlap { Outside, Intersect, Inside };
+
+Eigen::Vector3d ComputeChildOrigin(const Eigen::Vector3d& origin,
+                                   double child_size,
+                                   size_t child_index) {
+    // Same arithmetic as Octree::TraverseRecurse
+    size_t x_index = child_index % 2;
+    size_t y_index = (child_index / 2) % 2;
+    size_t z_index = (child_index / 4) % 2;
+    return origin + Eigen::Vector3d(x_index, y_index, z_index) * child_size;
+}
+
+/// Squared distance from point to the cube [origin, origin + size]
+double ComputeSquaredDistanceToCube(const Eigen::Vector3d& point,
+                                    const Eigen::Vector3d& origin,
+                                    double size) {
+    double distance2 = 0;
+    for (int i = 0; i < 3; ++i) {
+        double d = std::max(
+                std::max(origin(i) - point(i), point(i) - origin(i) - size),
+                0.0);
+        distance2 += d * d;
+    }
+    return distance2;
+}
+
+class BoxVolume {
+public:
+    BoxVolume(const Eigen::Vector3d& min_bound,
+              const Eigen::Vector3d& max_bound)
+        : min_bound_(min_bound), max_bound_(max_bound) {}
+
+    Overlap Classify(const Eigen::Vector3d& origin, double size) const {
+        Eigen::Array3d node_min = origin.array();
+        Eigen::Array3d node_max = origin.array() + size;
+        if ((node_min > max_bound_.array()).any() ||
+            (node_max < min_bound_.array()).any()) {
+            return Overlap::Outside;
+        }
+        if ((node_min >= min_bound_.array()).all() &&
+            (node_max <= max_bound_.array()).all()) {
+            return Overlap::Inside;
+        }
+        return Overlap::Intersect;
+    }
+
+    bool Contains(const Eigen::Vector3d& point) const {
+        return (point.array() >= min_bound_.array()).all() &&
+               (point.array() <= max_bound_.array()).all();
+    }
+
+private:
+    Eigen::Vector3d min_bound_;
+    Eigen::Vector3d max_bound_;
+};
+
+/// Frustum of an OpenGL style clip matrix
+class FrustumVolume {
+public:
+    explicit FrustumVolume(const Eigen::Matrix4d& view_projection)
+        : view_projection_(view_projection) {}
+
+    /// Conservative test: cubes near the frustum edges may be classified as
+    /// Intersect although they are outside.
+    Overlap Classify(const Eigen::Vector3d& origin, double size) const {
+        int result = ClassifyAABBFrustum(
+                origin, origin + Eigen::Vector3d(size, size, size),
+                view_projection_);
+        return result < 0 ? Overlap::Outside
+                          : (result > 0 ? Overlap::Inside : Overlap::Intersect);
+    }
+
+    bool Contains(const Eigen::Vector3d& point) const {
+        Eigen::Vector4d clip = view_projection_ * point.homogeneous();
+        return (clip.head<3>().array().abs() <= clip(3)).all();
+    }
+
+private:
+    Eigen::Matrix4d view_projection_;
+};
+
+/// Depth-first traversal of the nodes overlapping volume. visit(node, origin,
+/// size, depth, child_index, inside) is called for the leaves and for the
+/// internal nodes at stop_depth; nodes below are not visited. Once a node is
+/// inside the volume its descendants are not classified anymore.
+template <typename Volume, typename VisitFunc>
+void CullRecurse(const std::shared_ptr<OctreeNode>& node,
+                 const Eigen::Vector3d& origin,
+                 double size,
+                 size_t depth,
+                 size_t child_index,
+                 bool inside,
+                 size_t stop_depth,
+                 const Volume& volume,
+                 const VisitFunc& visit) {
+    if (node == nullptr) {
+        return;
+    }
+    if (!inside) {
+        Overlap overlap = volume.Classify(origin, size);
+        if (overlap == Overlap::Outside) {
+            return;
+        }
+        inside = overlap == Overlap::Inside;
+    }
+    auto internal_node = dynamic_cast<const OctreeInternalNode*>(node.get());
+    if (internal_node == nullptr || depth == stop_depth) {
+        visit(node, origin, size, depth, child_index, inside);
+        return;
+    }
+    double child_size = size / 2.0;
+    for (size_t cid = 0; cid < 8; ++cid) {
+        CullRecurse(internal_node->children_[cid],
+                    ComputeChildOrigin(origin, child_size, cid), child_size,
+                    depth + 1, cid, inside, stop_depth, volume, visit);
+    }
+}
+
+template <typename Volume>
+int SearchVolume(const Octree& octree,
+                 const Volume& volume,
+                 std::vector<int>& indices) {
+    indices.clear();
+    auto f_collect = [&indices, &volume](
+                             const std::shared_ptr<OctreeNode>& node,
+                             const Eigen::Vector3d& /*origin*/,
+                             double /*size*/, size_t /*depth*/,
+                             size_t /*child_index*/, bool inside) {
+        auto leaf_node =
+                dynamic_cast<const OctreePointColorLeafNode*>(node.get());
+        if (leaf_node == nullptr) {
+            return;
+        }
+        for (size_t i = 0; i < leaf_node->indices_.size(); ++i) {
+            if (inside || volume.Contains(leaf_node->points_[i])) {
+                indices.push_back(int(leaf_node->indices_[i]));
+            }
+        }
+    };
+    CullRecurse(octree.root_node_, octree.origin_, octree.size_, 0, 0, false,
+                std::numeric_limits<size_t>::max(), volume, f_collect);
+    return int(indices.size());
+}
+
+template <typename Volume>
+std::vector<std::pair<std::shared_ptr<OctreeNode>,
+                      std::shared_ptr<OctreeNodeInfo>>>
+LocateNodesInVolume(const Octree& octree, const Volume& volume, int lod_depth) {
+    std::vector<std::pair<std::shared_ptr<OctreeNode>,
+                          std::shared_ptr<OctreeNodeInfo>>>
+            nodes;
+    auto f_collect = [&nodes](const std::shared_ptr<OctreeNode>& node,
+                              const Eigen::Vector3d& origin, double size,
+                              size_t depth, size_t child_index,
+                              bool /*inside*/) {
+        nodes.push_back(std::make_pair(
+                node, std::make_shared<OctreeNodeInfo>(origin, size, depth,
+                                                       child_index)));
+    };
+    size_t stop_depth = lod_depth < 0 ? std::numeric_limits<size_t>::max()
+                                      : size_t(lod_depth);
+    CullRecurse(octree.root_node_, octree.origin_, octree.size_, 0, 0, false,
+                stop_depth, volume, f_collect);
+    return nodes;
+}
+
+/// Depth-first k nearest neighbor search visiting the children closest to
+/// the query first. results is a max-heap of the knn closest points so far.
+void SearchKNNRecurse(const OctreeNode* node,
+                      const Eigen::Vector3d& origin,
+                      double size,
+                      const Eigen::Vector3d& query,
+                      size_t knn,
+                      std::vector<std::pair<double, int>>& results) {
+    if (auto internal_node = dynamic_cast<const OctreeInternalNode*>(node)) {
+        double child_size = size / 2.0;
+        // Children sorted by their distance to the query
+        std::pair<double, size_t> children[8];
+        size_t num_children = 0;
+        for (size_t cid = 0; cid < 8; ++cid) {
+            if (internal_node->children_[cid] == nullptr) {
+                continue;
+            }
+            double child_distance2 = ComputeSquaredDistanceToCube(
+                    query, ComputeChildOrigin(origin, child_size, cid),
+                    child_size);
+            size_t pos = num_children++;
+            for (; pos > 0 && children[pos - 1].first > child_distance2;
+                 --pos) {
+                children[pos] = children[pos - 1];
+            }
+            children[pos] = std::make_pair(child_distance2, cid);
+        }
+        for (size_t i = 0; i < num_children; ++i) {
+            if (results.size() == knn &&
+                children[i].first > results.front().first) {
+                break;
+            }
+            size_t cid = children[i].second;
+            SearchKNNRecurse(internal_node->children_[cid].get(),
+                             ComputeChildOrigin(origin, child_size, cid),
+                             child_size, query, knn, results);
+        }
+    } else if (auto leaf_node =
+                       dynamic_cast<const OctreePointColorLeafNode*>(node)) {
+        for (size_t i = 0; i < leaf_node->indices_.size(); ++i) {
+            std::pair<double, int> candidate(
+                    (leaf_node->points_[i] - query).squaredNorm(),
+                    int(leaf_node->indices_[i]));
+            if (results.size() < knn) {
+                results.push_back(candidate);
+                std::push_heap(results.begin(), results.end());
+            } else if (candidate < results.front()) {
+                std::pop_heap(results.begin(), results.end());
+                results.back() = candidate;
+                std::push_heap(results.begin(), results.end());
+            }
+        }
+    }
+}
+
+/// Sorts (distance2, index) pairs and splits them into the output vectors
+void FillSortedResults(std::vector<std::pair<double, int>>& results,
+                       std::vector<int>& indices,
+                       std::vector<double>& distance2) {
+    std::sort(results.begin(), results.end());
+    indices.resize(results.size());
+    distance2.resize(results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+        distance2[i] = results[i].first;
+        indices[i] = results[i].second;
+    }
+}
+
+}  // unnamed namespace
+
+int Octree::SearchKNN(const Eigen::Vector3d& query,
+                      int knn,
+                      std::vector<int>& indices,
+                      std::vector<double>& distance2) const {
+    indices.clear();
+    distance2.clear();
+    if (root_node_ == nullptr || knn < 0) {
+        return -1;
+    }
+    std::vector<std::pair<double, int>> results;
+    results.reserve(knn);
+    if (knn > 0) {
+        SearchKNNRecurse(root_node_.get(), origin_, size_, query, size_t(knn),
+                         results);
+    }
+    FillSortedResults(results, indices, distance2);
+    return int(results.size());
+}
+
+int Octree::SearchRadius(const Eigen::Vector3d& query,
+                         double radius,
+                         std::vector<int>& indices,
+                         std::vector<double>& distance2) const {
+    indices.clear();
+    distance2.clear();
+    if (root_node_ == nullptr || radius < 0) {
+        return -1;
+    }
+    double radius2 = radius * radius;
+    std::vector<std::pair<double, int>> results;
+
+    struct StackEntry {
+        const OctreeNode* node_;
+        Eigen::Vector3d origin_;
+        double size_;
+    };
+    std::vector<StackEntry> stack;
+    stack.push_back({root_node_.get(), origin_, size_});
+    while (!stack.empty()) {
+        StackEntry entry = stack.back();
+        stack.pop_back();
+        if (ComputeSquaredDistanceToCube(query, entry.origin_, entry.size_) >
+            radius2) {
+            continue;
+        }
+        if (auto internal_node =
+                    dynamic_cast<const OctreeInternalNode*>(entry.node_)) {
+            double child_size = entry.size_ / 2.0;
+            for (size_t cid = 0; cid < 8; ++cid) {
+                const OctreeNode* child = internal_node->children_[cid].get();
+                if (child != nullptr) {
+                    stack.push_back(
+                            {child,
+                             ComputeChildOrigin(entry.origin_, child_size, cid),
+                             child_size});
+                }
+            }
+        } else if (auto leaf_node =
+                           dynamic_cast<const OctreePointColorLeafNode*>(
+                                   entry.node_)) {
+            for (size_t i = 0; i < leaf_node->indices_.size(); ++i) {
+                double d2 = (leaf_node->points_[i] - query).squaredNorm();
+                if (d2 <= radius2) {
+                    results.push_back(
+                            std::make_pair(d2, int(leaf_node->indices_[i])));
+                }
+            }
+        }
+    }
+    FillSortedResults(results, indices, distance2);
+    return int(results.size());
+}
+
+void Octree::SearchKNN(const std::vector<Eigen::Vector3d>& queries,
+                       int knn,
+                       std::vector<std::vector<int>>& indices,
+                       std::vector<std::vector<double>>& distance2) const {
+    indices.resize(queries.size());
+    distance2.resize(queries.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(queries.size()); ++i) {
+        SearchKNN(queries[i], knn, indices[i], distance2[i]);
+    }
+}
+
+void Octree::SearchRadius(const std::vector<Eigen::Vector3d>& queries,
+                          double radius,
+                          std::vector<std::vector<int>>& indices,
+                          std::vector<std::vector<double>>& distance2) const {
+    indices.resize(queries.size());
+    distance2.resize(queries.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(queries.size()); ++i) {
+        SearchRadius(queries[i], radius, indices[i], distance2[i]);
+    }
+}
+
+int Octree::SearchBox(const Eigen::Vector3d& min_bound,
+                      const Eigen::Vector3d& max_bound,
+                      std::vector<int>& indices) const {
+    return SearchVolume(*this, BoxVolume(min_bound, max_bound), indices);
+}
+
+int Octree::SearchFrustum(const Eigen::Matrix4d& view_projection,
+                          std::vector<int>& indices) const {
+    return SearchVolume(*this, FrustumVolume(view_projection), indices);
+}
+
+std::vector<std::pair<std::shared_ptr<OctreeNode>,
+                      std::shared_ptr<OctreeNodeInfo>>>
+Octree::LocateNodesInBox(const Eigen::Vector3d& min_bound,
+                         const Eigen::Vector3d& max_bound,
+                         int lod_depth) const {
+    return LocateNodesInVolume(*this, BoxVolume(min_bound, max_bound),
+                               lod_depth);
+}
+
+std::vector<std::pair<std::shared_ptr<OctreeNode>,
+                      std::shared_ptr<OctreeNodeInfo>>>
+Octree::LocateNodesInFrustum(const Eigen::Matrix4d& view_projection,
+                             int lod_depth) const {
+    return LocateNodesInVolume(*this, FrustumVolume(view_projection),
+                               lod_depth);
+}
+
+}  // namespace geometry
+}  // namespace open3d
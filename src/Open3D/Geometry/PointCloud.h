@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <limits>
 #include <memory>
 #include <tuple>
 #include <vector>
@@ -104,6 +105,9 @@ public:
 /// the latter case, the depth is scaled by 1 / depth_scale, and truncated at
 /// depth_trunc distance. The depth image is also sampled with stride, in order
 /// to support (fast) coarse point cloud extraction.
+/// With \param project_valid_depth_only, the pixels without a positive depth
+/// are skipped. Otherwise the pointcloud is organised: it has one point per
+/// sampled pixel in row-major order, NaN for the invalid depths.
 /// Return an empty pointcloud if the conversion fails.
 std::shared_ptr<PointCloud> CreatePointCloudFromDepthImage(
         const Image &depth,
@@ -111,15 +115,19 @@ std::shared_ptr<PointCloud> CreatePointCloudFromDepthImage(
         const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
         double depth_scale = 1000.0,
         double depth_trunc = 1000.0,
-        int stride = 1);
+        int stride = 1,
+        bool project_valid_depth_only = true);
 
 /// Factory function to create a pointcloud from an RGB-D image and a camera
 /// model (PointCloudFactory.cpp)
+/// See CreatePointCloudFromDepthImage for \param project_valid_depth_only;
+/// the points of invalid depths keep the color of their pixel.
 /// Return an empty pointcloud if the conversion fails.
 std::shared_ptr<PointCloud> CreatePointCloudFromRGBDImage(
         const RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity());
+        const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
+        bool project_valid_depth_only = true);
 
 /// Function to select points from \param input pointcloud into
 /// \return output pointcloud
@@ -179,6 +187,28 @@ bool EstimateNormals(
         PointCloud &cloud,
         const KDTreeSearchParam &search_param = KDTreeSearchParamKNN());
 
+/// Function to compute the normals of an organised point cloud, such as
+/// created by CreatePointCloudFromDepthImage without project_valid_depth_only,
+/// from image neighbourhoods instead of a KDTree.
+/// \param cloud is the input point cloud of \param width x \param height
+/// points in row-major order, NaN where invalid. It also stores the output
+/// normals, NaN for invalid points. Normals are oriented with respect to the
+/// input point cloud if normals exist in the input, and towards
+/// \param camera_location otherwise.
+/// The normal of a point is fit, through integral images, to the valid points
+/// of the window of half size \param half_window_size around its pixel. The
+/// window shrinks not to cross depth discontinuities, where neighbouring
+/// points are further apart than \param max_depth_change_factor times their
+/// distance to \param camera_location. Next to discontinuities, normals are
+/// computed from the neighbouring points on the same surface.
+bool EstimateNormalsOrganised(
+        PointCloud &cloud,
+        int width,
+        int height,
+        int half_window_size = 3,
+        double max_depth_change_factor = 0.02,
+        const Eigen::Vector3d &camera_location = Eigen::Vector3d::Zero());
+
 /// Function to orient the normals of a point cloud
 /// \param cloud is the input point cloud. It must have normals.
 /// Normals are oriented with respect to \param orientation_reference
@@ -223,5 +253,68 @@ std::vector<double> ComputePointCloudNearestNeighborDistance(
 std::shared_ptr<TriangleMesh> ComputePointCloudConvexHull(
         const PointCloud &input);
 
+/// Function to cluster the points of \param input with DBSCAN (Ester et al.,
+/// "A Density-Based Algorithm for Discovering Clusters in Large Spatial
+/// Databases with Noise", 1996). Points with at least \param min_points
+/// points, themselves included, within \param eps are core points; core
+/// points within eps of each other share a cluster, other points join the
+/// cluster of their nearest core point within eps or are noise.
+/// \return the cluster label of every point, -1 for noise, and the number of
+/// points of every cluster. Clusters are numbered in the order of their
+/// first point.
+std::tuple<std::vector<int>, std::vector<size_t>> ClusterDBSCAN(
+        const PointCloud &input, double eps, size_t min_points);
+
+/// Function to extract the connected components of the points of
+/// \param input closer than \param tolerance to each other (Euclidean
+/// cluster extraction). Points of components with fewer than
+/// \param min_cluster_size or more than \param max_cluster_size points are
+/// labeled -1.
+/// \return the cluster label of every point and the number of points of
+/// every cluster, see ClusterDBSCAN.
+std::tuple<std::vector<int>, std::vector<size_t>> ClusterEuclidean(
+        const PointCloud &input,
+        double tolerance,
+        size_t min_cluster_size = 1,
+        size_t max_cluster_size = std::numeric_limits<size_t>::max());
+
+/// Function to segment the dominant plane of \param input with RANSAC.
+/// Hypotheses are scored by their number of points within
+/// \param distance_threshold of the plane. Sampling stops after
+/// \param max_iterations hypotheses, or earlier once the best plane is found
+/// with \param probability. With \param refine, the plane is refitted to its
+/// inliers by least squares while the number of inliers grows.
+/// \return the plane (a, b, c, d) with ax + by + cz + d = 0 and a unit
+/// normal, and the indices of its inliers. The result does not depend on the
+/// number of threads.
+std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
+        const PointCloud &input,
+        double distance_threshold,
+        int max_iterations = 1000,
+        double probability = 0.9999,
+        bool refine = true);
+
+/// Function to segment the dominant sphere of \param input with RANSAC, see
+/// SegmentPlane.
+/// \return the sphere (cx, cy, cz, r) and the indices of its inliers.
+std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentSphere(
+        const PointCloud &input,
+        double distance_threshold,
+        int max_iterations = 1000,
+        double probability = 0.9999,
+        bool refine = true);
+
+/// Function to segment the dominant cylinder of \param input with RANSAC,
+/// see SegmentPlane. Hypotheses are fitted to pairs of points with their
+/// normals, \param input must have normals.
+/// \return the cylinder (px, py, pz, dx, dy, dz, r), with p a point of the
+/// axis and d its unit direction, and the indices of its inliers.
+std::tuple<Eigen::Matrix<double, 7, 1>, std::vector<size_t>> SegmentCylinder(
+        const PointCloud &input,
+        double distance_threshold,
+        int max_iterations = 1000,
+        double probability = 0.9999,
+        bool refine = true);
+
 }  // namespace geometry
 }  // namespace open3d
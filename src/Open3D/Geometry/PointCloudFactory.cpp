@@ -25,6 +25,9 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <limits>
+#include <memory>
+#include <mutex>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/Image.h"
@@ -37,43 +40,179 @@ namespace open3d {
 namespace {
 using namespace geometry;
 
-int CountValidDepthPixels(const Image &depth, int stride) {
-    int num_valid_pixels = 0;
-    for (int i = 0; i < depth.height_; i += stride) {
-        for (int j = 0; j < depth.width_; j += stride) {
-            const float *p = PointerAt<float>(depth, j, i);
-            if (*p > 0) num_valid_pixels += 1;
+/// Normalized image coordinates of the sampled columns and rows of a depth
+/// image.
+class RayTable {
+public:
+    int width_;
+    int height_;
+    int stride_;
+    Eigen::Matrix3d intrinsic_matrix_;
+    std::vector<double> x_;
+    std::vector<double> y_;
+};
+
+const size_t kMaxNumOfRayTables = 4;
+
+/// Function to get the ray table of the depth images of size \param width x
+/// \param height of the camera \param intrinsic, sampled with
+/// \param stride. The last tables built are kept, since a sequence of frames
+/// uses the same camera.
+std::shared_ptr<const RayTable> GetRayTable(
+        int width,
+        int height,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        int stride) {
+    static std::mutex mutex;
+    static std::vector<std::shared_ptr<const RayTable>> tables;
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto &table : tables) {
+        if (table->width_ == width && table->height_ == height &&
+            table->stride_ == stride &&
+            table->intrinsic_matrix_ == intrinsic.intrinsic_matrix_) {
+            return table;
         }
     }
-    return num_valid_pixels;
+    auto table = std::make_shared<RayTable>();
+    table->width_ = width;
+    table->height_ = height;
+    table->stride_ = stride;
+    table->intrinsic_matrix_ = intrinsic.intrinsic_matrix_;
+    const auto focal_length = intrinsic.GetFocalLength();
+    const auto principal_point = intrinsic.GetPrincipalPoint();
+    const int cols = (width + stride - 1) / stride;
+    const int rows = (height + stride - 1) / stride;
+    table->x_.resize(cols);
+    for (int c = 0; c < cols; c++) {
+        table->x_[c] =
+                (c * stride - principal_point.first) / focal_length.first;
+    }
+    table->y_.resize(rows);
+    for (int r = 0; r < rows; r++) {
+        table->y_[r] =
+                (r * stride - principal_point.second) / focal_length.second;
+    }
+    if (tables.size() == kMaxNumOfRayTables) {
+        tables.erase(tables.begin());
+    }
+    tables.push_back(table);
+    return table;
 }
 
+/// Back-projection of the pixels of a depth image sampled with a stride.
+///
+/// The normalized image coordinates of the sampled columns and rows are
+/// tabulated, so that the world coordinates of pixel (u, v) at depth z are
+/// z * (x_[u] * R.col(0) + y_[v] * R.col(1) + R.col(2)) + t, with (R, t) the
+/// camera pose. The table is separable and thus costs O(width + height); it
+/// is cached per camera, see GetRayTable.
+class DepthUnprojector {
+public:
+    DepthUnprojector(const Image &depth,
+                     const camera::PinholeCameraIntrinsic &intrinsic,
+                     const Eigen::Matrix4d &extrinsic,
+                     int stride)
+        : stride_(stride),
+          cols_((depth.width_ + stride - 1) / stride),
+          rows_((depth.height_ + stride - 1) / stride),
+          table_(GetRayTable(depth.width_, depth.height_, intrinsic, stride)),
+          x_(table_->x_),
+          y_(table_->y_) {
+        const Eigen::Matrix4d camera_pose = extrinsic.inverse();
+        rotation_ = camera_pose.block<3, 3>(0, 0);
+        translation_ = camera_pose.block<3, 1>(0, 3);
+    }
+
+    /// Function to compute the index of the first point of each sampled row
+    /// of \param depth, followed by the number of points. Rows are laid out
+    /// back to back, keeping only the valid depths if \param compact.
+    std::vector<size_t> ComputeRowOffsets(const Image &depth,
+                                          bool compact) const {
+        std::vector<size_t> offsets(rows_ + 1, 0);
+        if (!compact) {
+            for (int r = 0; r <= rows_; r++) {
+                offsets[r] = size_t(r) * size_t(cols_);
+            }
+            return offsets;
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int r = 0; r < rows_; r++) {
+            const float *p = PointerAt<float>(depth, 0, r * stride_);
+            size_t num_valid_pixels = 0;
+            for (int c = 0; c < cols_; c++) {
+                num_valid_pixels += p[c * stride_] > 0 ? 1 : 0;
+            }
+            offsets[r + 1] = num_valid_pixels;
+        }
+        for (int r = 0; r < rows_; r++) {
+            offsets[r + 1] += offsets[r];
+        }
+        return offsets;
+    }
+
+    /// Function to back-project the sampled pixels of \param depth into
+    /// \param points, laid out as given by \param offsets. Invalid depths
+    /// are skipped if \param compact, and become NaN points otherwise.
+    /// \param on_point(index, u, v) is called for each point written.
+    template <typename OnPoint>
+    void Unproject(const Image &depth,
+                   const std::vector<size_t> &offsets,
+                   bool compact,
+                   std::vector<Eigen::Vector3d> &points,
+                   const OnPoint &on_point) const {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int r = 0; r < rows_; r++) {
+            const int v = r * stride_;
+            const float *p = PointerAt<float>(depth, 0, v);
+            const Eigen::Vector3d row_ray =
+                    y_[r] * rotation_.col(1) + rotation_.col(2);
+            size_t index = offsets[r];
+            for (int c = 0; c < cols_; c++) {
+                const int u = c * stride_;
+                if (p[u] > 0) {
+                    const double z = (double)p[u];
+                    points[index] =
+                            z * (row_ray + x_[c] * rotation_.col(0)) +
+                            translation_;
+                } else if (compact) {
+                    continue;
+                } else {
+                    points[index] = Eigen::Vector3d(nan, nan, nan);
+                }
+                on_point(index++, u, v);
+            }
+        }
+    }
+
+private:
+    int stride_;
+    int cols_;
+    int rows_;
+    std::shared_ptr<const RayTable> table_;
+    const std::vector<double> &x_;
+    const std::vector<double> &y_;
+    Eigen::Matrix3d rotation_;
+    Eigen::Vector3d translation_;
+};
+
 std::shared_ptr<PointCloud> CreatePointCloudFromFloatDepthImage(
         const Image &depth,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic,
-        int stride) {
+        int stride,
+        bool project_valid_depth_only) {
     auto pointcloud = std::make_shared<PointCloud>();
-    Eigen::Matrix4d camera_pose = extrinsic.inverse();
-    auto focal_length = intrinsic.GetFocalLength();
-    auto principal_point = intrinsic.GetPrincipalPoint();
-    int num_valid_pixels = CountValidDepthPixels(depth, stride);
-    pointcloud->points_.resize(num_valid_pixels);
-    int cnt = 0;
-    for (int i = 0; i < depth.height_; i += stride) {
-        for (int j = 0; j < depth.width_; j += stride) {
-            const float *p = PointerAt<float>(depth, j, i);
-            if (*p > 0) {
-                double z = (double)(*p);
-                double x = (j - principal_point.first) * z / focal_length.first;
-                double y =
-                        (i - principal_point.second) * z / focal_length.second;
-                Eigen::Vector4d point =
-                        camera_pose * Eigen::Vector4d(x, y, z, 1.0);
-                pointcloud->points_[cnt++] = point.block<3, 1>(0, 0);
-            }
-        }
-    }
+    DepthUnprojector unprojector(depth, intrinsic, extrinsic, stride);
+    auto offsets =
+            unprojector.ComputeRowOffsets(depth, project_valid_depth_only);
+    pointcloud->points_.resize(offsets.back());
+    unprojector.Unproject(depth, offsets, project_valid_depth_only,
+                          pointcloud->points_, [](size_t, int, int) {});
     return pointcloud;
 }
 
@@ -81,36 +220,25 @@ template <typename TC, int NC>
 std::shared_ptr<PointCloud> CreatePointCloudFromRGBDImageT(
         const RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic) {
+        const Eigen::Matrix4d &extrinsic,
+        bool project_valid_depth_only) {
     auto pointcloud = std::make_shared<PointCloud>();
-    Eigen::Matrix4d camera_pose = extrinsic.inverse();
-    auto focal_length = intrinsic.GetFocalLength();
-    auto principal_point = intrinsic.GetPrincipalPoint();
     double scale = (sizeof(TC) == 1) ? 255.0 : 1.0;
-    int num_valid_pixels = CountValidDepthPixels(image.depth_, 1);
-    pointcloud->points_.resize(num_valid_pixels);
-    pointcloud->colors_.resize(num_valid_pixels);
-    int cnt = 0;
-    for (int i = 0; i < image.depth_.height_; i++) {
-        float *p = (float *)(image.depth_.data_.data() +
-                             i * image.depth_.BytesPerLine());
-        TC *pc = (TC *)(image.color_.data_.data() +
-                        i * image.color_.BytesPerLine());
-        for (int j = 0; j < image.depth_.width_; j++, p++, pc += NC) {
-            if (*p > 0) {
-                double z = (double)(*p);
-                double x = (j - principal_point.first) * z / focal_length.first;
-                double y =
-                        (i - principal_point.second) * z / focal_length.second;
-                Eigen::Vector4d point =
-                        camera_pose * Eigen::Vector4d(x, y, z, 1.0);
-                pointcloud->points_[cnt] = point.block<3, 1>(0, 0);
-                pointcloud->colors_[cnt++] =
-                        Eigen::Vector3d(pc[0], pc[(NC - 1) / 2], pc[NC - 1]) /
-                        scale;
-            }
-        }
-    }
+    DepthUnprojector unprojector(image.depth_, intrinsic, extrinsic, 1);
+    auto offsets = unprojector.ComputeRowOffsets(image.depth_,
+                                                 project_valid_depth_only);
+    pointcloud->points_.resize(offsets.back());
+    pointcloud->colors_.resize(offsets.back());
+    auto &colors = pointcloud->colors_;
+    const Image &color = image.color_;
+    unprojector.Unproject(
+            image.depth_, offsets, project_valid_depth_only,
+            pointcloud->points_, [&](size_t index, int u, int v) {
+                const TC *pc = PointerAt<TC>(color, u, v, 0);
+                colors[index] = Eigen::Vector3d(pc[0], pc[(NC - 1) / 2],
+                                                pc[NC - 1]) /
+                                scale;
+            });
     return pointcloud;
 }
 
@@ -123,16 +251,19 @@ std::shared_ptr<PointCloud> CreatePointCloudFromDepthImage(
         const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
         double depth_scale /* = 1000.0*/,
         double depth_trunc /* = 1000.0*/,
-        int stride /* = 1*/) {
+        int stride /* = 1*/,
+        bool project_valid_depth_only /* = true*/) {
     if (depth.num_of_channels_ == 1) {
         if (depth.bytes_per_channel_ == 2) {
             auto float_depth =
                     ConvertDepthToFloatImage(depth, depth_scale, depth_trunc);
-            return CreatePointCloudFromFloatDepthImage(*float_depth, intrinsic,
-                                                       extrinsic, stride);
+            return CreatePointCloudFromFloatDepthImage(
+                    *float_depth, intrinsic, extrinsic, stride,
+                    project_valid_depth_only);
         } else if (depth.bytes_per_channel_ == 4) {
-            return CreatePointCloudFromFloatDepthImage(depth, intrinsic,
-                                                       extrinsic, stride);
+            return CreatePointCloudFromFloatDepthImage(
+                    depth, intrinsic, extrinsic, stride,
+                    project_valid_depth_only);
         }
     }
     utility::PrintDebug(
@@ -143,17 +274,18 @@ std::shared_ptr<PointCloud> CreatePointCloudFromDepthImage(
 std::shared_ptr<PointCloud> CreatePointCloudFromRGBDImage(
         const RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/) {
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
+        bool project_valid_depth_only /* = true*/) {
     if (image.depth_.num_of_channels_ == 1 &&
         image.depth_.bytes_per_channel_ == 4) {
         if (image.color_.bytes_per_channel_ == 1 &&
             image.color_.num_of_channels_ == 3) {
-            return CreatePointCloudFromRGBDImageT<uint8_t, 3>(image, intrinsic,
-                                                              extrinsic);
+            return CreatePointCloudFromRGBDImageT<uint8_t, 3>(
+                    image, intrinsic, extrinsic, project_valid_depth_only);
         } else if (image.color_.bytes_per_channel_ == 4 &&
                    image.color_.num_of_channels_ == 1) {
-            return CreatePointCloudFromRGBDImageT<float, 1>(image, intrinsic,
-                                                            extrinsic);
+            return CreatePointCloudFromRGBDImageT<float, 1>(
+                    image, intrinsic, extrinsic, project_valid_depth_only);
         }
     }
     utility::PrintDebug(
@@ -24,9 +24,19 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+
 #include "Open3D/Geometry/RGBDImage.h"
 
 namespace open3d {
+
+namespace {
+
+/// Number of rows converted at once by CreateRGBDImageFromColorAndDepth.
+const int kRGBDConversionBandHeight = 16;
+
+}  // unnamed namespace
+
 namespace geometry {
 
 std::shared_ptr<RGBDImage> CreateRGBDImageFromColorAndDepth(
@@ -42,6 +52,55 @@ std::shared_ptr<RGBDImage> CreateRGBDImageFromColorAndDepth(
                 "format.\n");
         return rgbd_image;
     }
+    const bool convert_depth = !depth.IsEmpty() &&
+                               depth.num_of_channels_ == 1 &&
+                               depth.bytes_per_channel_ == 2;
+    const bool convert_color = convert_rgb_to_intensity && !color.IsEmpty() &&
+                               color.num_of_channels_ == 3 &&
+                               color.bytes_per_channel_ == 1;
+    if (convert_depth && (convert_color || !convert_rgb_to_intensity)) {
+        // Both conversions write straight into the RGBD image, band after
+        // band of rows in a single parallel pass over the frame.
+        rgbd_image->depth_.PrepareImage(depth.width_, depth.height_, 1, 4);
+        if (convert_color) {
+            rgbd_image->color_.PrepareImage(color.width_, color.height_, 1, 4);
+        } else {
+            rgbd_image->color_ = color;
+        }
+        const auto depth_view = CreateImageView<uint16_t>(depth);
+        const auto output_depth_view =
+                CreateImageView<float>(rgbd_image->depth_);
+        // The color views are only needed, and valid, for the conversion.
+        ImageView<const uint8_t, 3> color_view;
+        ImageView<float> output_color_view;
+        if (convert_color) {
+            color_view = CreateImageView<uint8_t, 3>(color);
+            output_color_view = CreateImageView<float>(rgbd_image->color_);
+        }
+        const auto depth_table =
+                GetDepthConversionTable(depth_scale, depth_trunc);
+        const int num_of_bands =
+                (depth.height_ + kRGBDConversionBandHeight - 1) /
+                kRGBDConversionBandHeight;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int band = 0; band < num_of_bands; band++) {
+            const int v = band * kRGBDConversionBandHeight;
+            const int height =
+                    std::min(kRGBDConversionBandHeight, depth.height_ - v);
+            ConvertDepthToFloatImage(
+                    depth_view.Region(0, v, depth.width_, height),
+                    output_depth_view.Region(0, v, depth.width_, height),
+                    *depth_table);
+            if (convert_color) {
+                ConvertColorToIntensity(
+                        color_view.Region(0, v, color.width_, height),
+                        output_color_view.Region(0, v, color.width_, height));
+            }
+        }
+        return rgbd_image;
+    }
     rgbd_image->depth_ =
             *ConvertDepthToFloatImage(depth, depth_scale, depth_trunc);
     rgbd_image->color_ = convert_rgb_to_intensity
@@ -0,0 +1,406 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
+
+namespace open3d {
+
+namespace {
+using namespace geometry;
+
+/// Number of hypotheses evaluated between two checks of the termination
+/// criterion. It does not depend on the number of threads, so neither does
+/// the result.
+const int kRANSACBatchSize = 64;
+
+/// Maximum number of least squares refinements of the best model.
+const int kRANSACMaxRefinements = 10;
+
+/// Structure-of-arrays copy of the points, so that the distances of all
+/// points to a model are computed with packet (SIMD) arithmetic.
+class PointArrays {
+public:
+    explicit PointArrays(const PointCloud &input)
+        : x_(input.points_.size()),
+          y_(input.points_.size()),
+          z_(input.points_.size()) {
+        for (size_t i = 0; i < input.points_.size(); i++) {
+            x_(i) = input.points_[i](0);
+            y_(i) = input.points_[i](1);
+            z_(i) = input.points_[i](2);
+        }
+    }
+
+public:
+    Eigen::ArrayXd x_;
+    Eigen::ArrayXd y_;
+    Eigen::ArrayXd z_;
+};
+
+Eigen::Vector3d ComputeCentroid(const PointCloud &input,
+                                const std::vector<size_t> &indices) {
+    Eigen::Vector3d centroid = Eigen::Vector3d::Zero();
+    for (size_t i : indices) {
+        centroid += input.points_[i];
+    }
+    return centroid / double(indices.size());
+}
+
+class PlaneModel {
+public:
+    typedef Eigen::Vector4d Parameters;
+
+    PlaneModel(const PointCloud &input) : input_(input), arrays_(input) {}
+
+    int SampleSize() const { return 3; }
+
+    bool Fit(const std::vector<size_t> &indices, Parameters &plane) const {
+        Eigen::Vector3d centroid = ComputeCentroid(input_, indices);
+        Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+        for (size_t i : indices) {
+            Eigen::Vector3d p = input_.points_[i] - centroid;
+            covariance += p * p.transpose();
+        }
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(covariance);
+        const Eigen::Vector3d &eigenvalues = solver.eigenvalues();
+        // Collinear points.
+        if (eigenvalues(1) <= 1e-12 * eigenvalues(2)) {
+            return false;
+        }
+        Eigen::Vector3d normal = solver.eigenvectors().col(0);
+        plane << normal, -normal.dot(centroid);
+        return true;
+    }
+
+    void ComputeDistances(const Parameters &plane,
+                          Eigen::ArrayXd &distances) const {
+        distances = (arrays_.x_ * plane(0) + arrays_.y_ * plane(1) +
+                     arrays_.z_ * plane(2) + plane(3))
+                            .abs();
+    }
+
+private:
+    const PointCloud &input_;
+    PointArrays arrays_;
+};
+
+class SphereModel {
+public:
+    typedef Eigen::Vector4d Parameters;
+
+    SphereModel(const PointCloud &input) : input_(input), arrays_(input) {}
+
+    int SampleSize() const { return 4; }
+
+    bool Fit(const std::vector<size_t> &indices, Parameters &sphere) const {
+        // Algebraic fit, linear in (c, r^2 - |c|^2):
+        // |p|^2 = 2 c.p + r^2 - |c|^2.
+        Eigen::Vector3d centroid = ComputeCentroid(input_, indices);
+        Eigen::Matrix4d AtA = Eigen::Matrix4d::Zero();
+        Eigen::Vector4d Atb = Eigen::Vector4d::Zero();
+        for (size_t i : indices) {
+            Eigen::Vector3d p = input_.points_[i] - centroid;
+            Eigen::Vector4d a(2.0 * p(0), 2.0 * p(1), 2.0 * p(2), 1.0);
+            AtA += a * a.transpose();
+            Atb += a * p.squaredNorm();
+        }
+        Eigen::FullPivLU<Eigen::Matrix4d> lu(AtA);
+        // Coplanar points.
+        if (lu.rank() < 4) {
+            return false;
+        }
+        Eigen::Vector4d x = lu.solve(Atb);
+        double radius2 = x(3) + x.head<3>().squaredNorm();
+        if (radius2 <= 0.0) {
+            return false;
+        }
+        sphere << centroid + x.head<3>(), std::sqrt(radius2);
+        return true;
+    }
+
+    void ComputeDistances(const Parameters &sphere,
+                          Eigen::ArrayXd &distances) const {
+        distances = ((arrays_.x_ - sphere(0)).square() +
+                     (arrays_.y_ - sphere(1)).square() +
+                     (arrays_.z_ - sphere(2)).square())
+                            .sqrt();
+        distances = (distances - sphere(3)).abs();
+    }
+
+private:
+    const PointCloud &input_;
+    PointArrays arrays_;
+};
+
+class CylinderModel {
+public:
+    typedef Eigen::Matrix<double, 7, 1> Parameters;
+
+    CylinderModel(const PointCloud &input) : input_(input), arrays_(input) {}
+
+    int SampleSize() const { return 2; }
+
+    bool Fit(const std::vector<size_t> &indices, Parameters &cylinder) const {
+        // The axis is the direction most orthogonal to the normals.
+        Eigen::Matrix3d normal_moment = Eigen::Matrix3d::Zero();
+        for (size_t i : indices) {
+            const Eigen::Vector3d &n = input_.normals_[i];
+            normal_moment += n * n.transpose();
+        }
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(normal_moment);
+        const Eigen::Vector3d &eigenvalues = solver.eigenvalues();
+        // Parallel normals do not define an axis.
+        if (eigenvalues(1) <= 1e-3 * eigenvalues(2)) {
+            return false;
+        }
+        Eigen::Vector3d axis = solver.eigenvectors().col(0);
+
+        // The axis point is the least squares intersection of the normal
+        // lines, projected orthogonally to the axis.
+        Eigen::Vector3d centroid = ComputeCentroid(input_, indices);
+        Eigen::Matrix3d A = Eigen::Matrix3d::Zero();
+        Eigen::Vector3d b = Eigen::Vector3d::Zero();
+        for (size_t i : indices) {
+            Eigen::Vector3d n = input_.normals_[i] -
+                                input_.normals_[i].dot(axis) * axis;
+            double norm = n.norm();
+            if (norm == 0.0) {
+                continue;
+            }
+            n /= norm;
+            Eigen::Matrix3d projection =
+                    Eigen::Matrix3d::Identity() - n * n.transpose();
+            A += projection;
+            b += projection * (input_.points_[i] - centroid);
+        }
+        Eigen::Vector3d point = centroid + A.ldlt().solve(b);
+
+        double radius = 0.0;
+        for (size_t i : indices) {
+            Eigen::Vector3d v = input_.points_[i] - point;
+            radius += (v - v.dot(axis) * axis).norm();
+        }
+        radius /= double(indices.size());
+        if (!std::isfinite(radius) || radius <= 0.0) {
+            return false;
+        }
+        cylinder << point, axis, radius;
+        return true;
+    }
+
+    void ComputeDistances(const Parameters &cylinder,
+                          Eigen::ArrayXd &distances) const {
+        // Distance to the axis from the axial coordinate of the points.
+        distances = (arrays_.x_ - cylinder(0)) * cylinder(3) +
+                    (arrays_.y_ - cylinder(1)) * cylinder(4) +
+                    (arrays_.z_ - cylinder(2)) * cylinder(5);
+        distances = ((arrays_.x_ - cylinder(0)).square() +
+                     (arrays_.y_ - cylinder(1)).square() +
+                     (arrays_.z_ - cylinder(2)).square() - distances.square())
+                            .max(0.0)
+                            .sqrt();
+        distances = (distances - cylinder(6)).abs();
+    }
+
+private:
+    const PointCloud &input_;
+    PointArrays arrays_;
+};
+
+/// Number of hypotheses needed to draw an all-inlier sample with
+/// \param probability, for an inlier ratio \param inlier_ratio.
+double ComputeRequiredIterations(double inlier_ratio,
+                                 int sample_size,
+                                 double probability) {
+    double p_good = std::pow(inlier_ratio, sample_size);
+    if (p_good <= 0.0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    if (p_good >= 1.0 || probability <= 0.0) {
+        return 0.0;
+    }
+    return std::log1p(-std::min(probability, 1.0 - 1e-12)) /
+           std::log1p(-p_good);
+}
+
+template <class Model>
+std::tuple<typename Model::Parameters, std::vector<size_t>> SegmentRANSAC(
+        const Model &model,
+        size_t num_points,
+        double distance_threshold,
+        int max_iterations,
+        double probability,
+        bool refine) {
+    typedef typename Model::Parameters Parameters;
+    const int sample_size = model.SampleSize();
+    Parameters best_model = Parameters::Zero();
+    if (num_points < size_t(sample_size)) {
+        utility::PrintWarning(
+                "[SegmentRANSAC] Not enough points to fit a model.\n");
+        return std::make_tuple(best_model, std::vector<size_t>());
+    }
+
+    // Each hypothesis draws its sample from its own generator, seeded with
+    // its iteration, and ties go to the earliest hypothesis, so the result is
+    // deterministic.
+    int best_count = 0;
+    int iteration = 0;
+    double required_iterations = std::numeric_limits<double>::infinity();
+    while (iteration < max_iterations && iteration < required_iterations) {
+        int batch_size = std::min(kRANSACBatchSize, max_iterations - iteration);
+        std::vector<Parameters, Eigen::aligned_allocator<Parameters>> models(
+                batch_size);
+        std::vector<int> counts(batch_size, -1);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            Eigen::ArrayXd distances(num_points);
+            std::vector<size_t> sample(sample_size);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (int k = 0; k < batch_size; k++) {
+                std::mt19937 rng(iteration + k);
+                std::uniform_int_distribution<size_t> dist(0, num_points - 1);
+                for (int s = 0; s < sample_size; s++) {
+                    do {
+                        sample[s] = dist(rng);
+                    } while (std::find(sample.begin(), sample.begin() + s,
+                                       sample[s]) != sample.begin() + s);
+                }
+                if (!model.Fit(sample, models[k])) {
+                    continue;
+                }
+                model.ComputeDistances(models[k], distances);
+                counts[k] = int((distances < distance_threshold).count());
+            }
+        }
+        for (int k = 0; k < batch_size; k++) {
+            if (counts[k] > best_count) {
+                best_count = counts[k];
+                best_model = models[k];
+            }
+        }
+        iteration += batch_size;
+        required_iterations = ComputeRequiredIterations(
+                double(best_count) / double(num_points), sample_size,
+                probability);
+    }
+    utility::PrintDebug(
+            "[SegmentRANSAC] %d hypotheses evaluated, %d inliers.\n",
+            iteration, best_count);
+
+    Eigen::ArrayXd distances(num_points);
+    std::vector<size_t> inliers;
+    auto collect_inliers = [&](const Parameters &params) {
+        model.ComputeDistances(params, distances);
+        inliers.clear();
+        for (size_t i = 0; i < num_points; i++) {
+            if (distances(i) < distance_threshold) {
+                inliers.push_back(i);
+            }
+        }
+    };
+    if (best_count == 0) {
+        return std::make_tuple(best_model, inliers);
+    }
+    collect_inliers(best_model);
+    if (refine) {
+        for (int r = 0; r < kRANSACMaxRefinements; r++) {
+            Parameters refined_model;
+            if (!model.Fit(inliers, refined_model)) {
+                break;
+            }
+            model.ComputeDistances(refined_model, distances);
+            int count = int((distances < distance_threshold).count());
+            if (count < best_count) {
+                break;
+            }
+            best_model = refined_model;
+            collect_inliers(best_model);
+            if (count == best_count) {
+                break;
+            }
+            best_count = count;
+        }
+    }
+    return std::make_tuple(best_model, inliers);
+}
+
+}  // unnamed namespace
+
+namespace geometry {
+
+std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
+        const PointCloud &input,
+        double distance_threshold,
+        int max_iterations /* = 1000*/,
+        double probability /* = 0.9999*/,
+        bool refine /* = true*/) {
+    PlaneModel model(input);
+    return SegmentRANSAC(model, input.points_.size(), distance_threshold,
+                         max_iterations, probability, refine);
+}
+
+std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentSphere(
+        const PointCloud &input,
+        double distance_threshold,
+        int max_iterations /* = 1000*/,
+        double probability /* = 0.9999*/,
+        bool refine /* = true*/) {
+    SphereModel model(input);
+    return SegmentRANSAC(model, input.points_.size(), distance_threshold,
+                         max_iterations, probability, refine);
+}
+
+std::tuple<Eigen::Matrix<double, 7, 1>, std::vector<size_t>> SegmentCylinder(
+        const PointCloud &input,
+        double distance_threshold,
+        int max_iterations /* = 1000*/,
+        double probability /* = 0.9999*/,
+        bool refine /* = true*/) {
+    if (!input.HasNormals()) {
+        utility::PrintWarning(
+                "[SegmentCylinder] The point cloud has no normals.\n");
+        return std::make_tuple(Eigen::Matrix<double, 7, 1>::Zero().eval(),
+                               std::vector<size_t>());
+    }
+    CylinderModel model(input);
+    return SegmentRANSAC(model, input.points_.size(), distance_threshold,
+                         max_iterations, probability, refine);
+}
+
+}  // namespace geometry
+}  // namespace open3d
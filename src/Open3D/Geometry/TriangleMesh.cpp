@@ -266,12 +266,13 @@ std::shared_ptr<PointCloud> SamplePointsUniformly(
                 triangle_areas[tidx] / surface_area + triangle_areas[tidx - 1];
     }
 
-    // sample point cloud
+    // sample point cloud, triangle tidx receives the points in
+    // [round(cdf[tidx - 1] * n), round(cdf[tidx] * n)), thus the triangles
+    // can be sampled independently of each other
     bool has_vert_normal = input.HasVertexNormals();
     bool has_vert_color = input.HasVertexColors();
     std::random_device rd;
-    std::mt19937 mt(rd());
-    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    unsigned int seed = rd();
     auto pcd = std::make_shared<PointCloud>();
     pcd->points_.resize(number_of_points);
     if (has_vert_normal) {
@@ -280,36 +281,58 @@ std::shared_ptr<PointCloud> SamplePointsUniformly(
     if (has_vert_color) {
         pcd->colors_.resize(number_of_points);
     }
-    size_t point_idx = 0;
-    for (size_t tidx = 0; tidx < input.triangles_.size(); ++tidx) {
-        size_t n = std::round(triangle_areas[tidx] * number_of_points);
-        while (point_idx < n) {
-            double r1 = dist(mt);
-            double r2 = dist(mt);
-            double a = (1 - std::sqrt(r1));
-            double b = std::sqrt(r1) * (1 - r2);
-            double c = std::sqrt(r1) * r2;
-
+    int triangle_num = int(input.triangles_.size());
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        int thread_num = 0;
+#ifdef _OPENMP
+        thread_num = omp_get_thread_num();
+#endif
+        std::mt19937 mt(seed + thread_num);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int tidx = 0; tidx < triangle_num; ++tidx) {
+            size_t point_idx =
+                    tidx == 0 ? 0
+                              : size_t(std::round(triangle_areas[tidx - 1] *
+                                                  number_of_points));
+            size_t n = std::min(
+                    size_t(std::round(triangle_areas[tidx] * number_of_points)),
+                    number_of_points);
             const Eigen::Vector3i &triangle = input.triangles_[tidx];
-            pcd->points_[point_idx] = a * input.vertices_[triangle(0)] +
-                                      b * input.vertices_[triangle(1)] +
-                                      c * input.vertices_[triangle(2)];
-            if (has_vert_normal) {
-                pcd->normals_[point_idx] =
-                        a * input.vertex_normals_[triangle(0)] +
-                        b * input.vertex_normals_[triangle(1)] +
-                        c * input.vertex_normals_[triangle(2)];
-            }
-            if (has_vert_color) {
-                pcd->colors_[point_idx] =
-                        a * input.vertex_colors_[triangle(0)] +
-                        b * input.vertex_colors_[triangle(1)] +
-                        c * input.vertex_colors_[triangle(2)];
-            }
+            while (point_idx < n) {
+                double r1 = dist(mt);
+                double r2 = dist(mt);
+                double a = (1 - std::sqrt(r1));
+                double b = std::sqrt(r1) * (1 - r2);
+                double c = std::sqrt(r1) * r2;
+
+                pcd->points_[point_idx] = a * input.vertices_[triangle(0)] +
+                                          b * input.vertices_[triangle(1)] +
+                                          c * input.vertices_[triangle(2)];
+                if (has_vert_normal) {
+                    pcd->normals_[point_idx] =
+                            a * input.vertex_normals_[triangle(0)] +
+                            b * input.vertex_normals_[triangle(1)] +
+                            c * input.vertex_normals_[triangle(2)];
+                }
+                if (has_vert_color) {
+                    pcd->colors_[point_idx] =
+                            a * input.vertex_colors_[triangle(0)] +
+                            b * input.vertex_colors_[triangle(1)] +
+                            c * input.vertex_colors_[triangle(2)];
+                }
 
-            point_idx++;
+                point_idx++;
+            }
         }
+#ifdef _OPENMP
     }
+#endif
 
     return pcd;
 }
@@ -519,38 +542,43 @@ std::shared_ptr<PointCloud> SamplePointsUniformly(const TriangleMesh &input,
                                  surface_area);
 }
 
-std::shared_ptr<PointCloud> SamplePointsPoissonDisk(
+namespace {
+
+/// Validates the arguments of the Poisson disk sampling functions and returns
+/// the initial (oversampled) point cloud, nullptr if the arguments are invalid.
+std::shared_ptr<PointCloud> PoissonDiskInitialSamples(
         const TriangleMesh &input,
         size_t number_of_points,
-        double init_factor /* = 5 */,
-        const std::shared_ptr<PointCloud> pcl_init /* = nullptr */) {
+        double init_factor,
+        const std::shared_ptr<PointCloud> pcl_init,
+        double &surface_area) {
     if (number_of_points <= 0) {
         utility::PrintWarning("[SamplePointsUniformly] number_of_points <= 0");
-        return std::make_shared<PointCloud>();
+        return nullptr;
     }
     if (input.triangles_.size() == 0) {
         utility::PrintWarning(
                 "[SamplePointsUniformly] input mesh has no triangles");
-        return std::make_shared<PointCloud>();
+        return nullptr;
     }
     if (pcl_init == nullptr && init_factor < 1) {
         utility::PrintWarning(
                 "[SamplePointsUniformly] either pass pcl_init with #points "
                 "> "
                 "number_of_points or init_factor > 1");
-        return std::make_shared<PointCloud>();
+        return nullptr;
     }
     if (pcl_init != nullptr && pcl_init->points_.size() < number_of_points) {
         utility::PrintWarning(
                 "[SamplePointsUniformly] either pass pcl_init with #points "
                 "> "
                 "number_of_points, or init_factor > 1");
-        return std::make_shared<PointCloud>();
+        return nullptr;
     }
 
     // Compute area of each triangle and sum surface area
     std::vector<double> triangle_areas;
-    double surface_area = input.GetSurfaceArea(triangle_areas);
+    surface_area = input.GetSurfaceArea(triangle_areas);
 
     // Compute init points using uniform sampling
     std::shared_ptr<PointCloud> pcl;
@@ -563,6 +591,49 @@ std::shared_ptr<PointCloud> SamplePointsPoissonDisk(
         pcl->normals_ = pcl_init->normals_;
         pcl->colors_ = pcl_init->colors_;
     }
+    return pcl;
+}
+
+/// Removes the points flagged in \param deleted from \param pcl.
+template <typename DeletedFlags>
+void PoissonDiskRemoveDeleted(PointCloud &pcl, const DeletedFlags &deleted) {
+    bool has_vert_normal = pcl.HasNormals();
+    bool has_vert_color = pcl.HasColors();
+    int next_free = 0;
+    for (size_t idx = 0; idx < pcl.points_.size(); ++idx) {
+        if (!deleted[idx]) {
+            pcl.points_[next_free] = pcl.points_[idx];
+            if (has_vert_normal) {
+                pcl.normals_[next_free] = pcl.normals_[idx];
+            }
+            if (has_vert_color) {
+                pcl.colors_[next_free] = pcl.colors_[idx];
+            }
+            next_free++;
+        }
+    }
+    pcl.points_.resize(next_free);
+    if (has_vert_normal) {
+        pcl.normals_.resize(next_free);
+    }
+    if (has_vert_color) {
+        pcl.colors_.resize(next_free);
+    }
+}
+
+}  // unnamed namespace
+
+std::shared_ptr<PointCloud> SamplePointsPoissonDisk(
+        const TriangleMesh &input,
+        size_t number_of_points,
+        double init_factor /* = 5 */,
+        const std::shared_ptr<PointCloud> pcl_init /* = nullptr */) {
+    double surface_area;
+    std::shared_ptr<PointCloud> pcl = PoissonDiskInitialSamples(
+            input, number_of_points, init_factor, pcl_init, surface_area);
+    if (pcl == nullptr) {
+        return std::make_shared<PointCloud>();
+    }
 
     // Set-up sample elimination
     double alpha = 8;    // constant defined in paper
@@ -643,72 +714,347 @@ std::shared_ptr<PointCloud> SamplePointsPoissonDisk(
     }
 
     // update pcl
-    bool has_vert_normal = pcl->HasNormals();
-    bool has_vert_color = pcl->HasColors();
-    int next_free = 0;
-    for (size_t idx = 0; idx < pcl->points_.size(); ++idx) {
-        if (!deleted[idx]) {
-            pcl->points_[next_free] = pcl->points_[idx];
-            if (has_vert_normal) {
-                pcl->normals_[next_free] = pcl->normals_[idx];
-            }
-            if (has_vert_color) {
-                pcl->colors_[next_free] = pcl->colors_[idx];
+    PoissonDiskRemoveDeleted(*pcl, deleted);
+
+    return pcl;
+}
+
+std::shared_ptr<PointCloud> SamplePointsPoissonDiskParallel(
+        const TriangleMesh &input,
+        size_t number_of_points,
+        double init_factor /* = 5 */,
+        const std::shared_ptr<PointCloud> pcl_init /* = nullptr */) {
+    double surface_area;
+    std::shared_ptr<PointCloud> pcl = PoissonDiskInitialSamples(
+            input, number_of_points, init_factor, pcl_init, surface_area);
+    if (pcl == nullptr) {
+        return std::make_shared<PointCloud>();
+    }
+
+    // Set-up sample elimination
+    double alpha = 8;    // constant defined in paper
+    double beta = 0.5;   // constant defined in paper
+    double gamma = 1.5;  // constant defined in paper
+    int init_number_of_points = int(pcl->points_.size());
+    double ratio = double(number_of_points) / double(init_number_of_points);
+    double r_max = 2 * std::sqrt((surface_area / number_of_points) /
+                                 (2 * std::sqrt(3.)));
+    double r_min = r_max * beta * (1 - std::pow(ratio, gamma));
+    double r_max2 = r_max * r_max;
+
+    auto WeightFcn = [&](double d2) {
+        double d = std::sqrt(d2);
+        if (d < r_min) {
+            d = r_min;
+        }
+        return std::pow(1 - d / r_max, alpha);
+    };
+
+    // Bin the samples into a grid with cell size r_max, such that all
+    // neighbours of a sample lie in the 27 surrounding cells. The samples are
+    // sorted by cell, each cell owns a contiguous range of sorted_points.
+    Eigen::Vector3d min_bound = pcl->GetMinBound();
+    std::vector<Eigen::Vector3i> point_cells(init_number_of_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int pidx = 0; pidx < init_number_of_points; ++pidx) {
+        Eigen::Vector3d ref_coord = (pcl->points_[pidx] - min_bound) / r_max;
+        point_cells[pidx] = Eigen::Vector3i(int(floor(ref_coord(0))),
+                                            int(floor(ref_coord(1))),
+                                            int(floor(ref_coord(2))));
+    }
+    std::vector<int> sorted_points(init_number_of_points);
+    std::iota(sorted_points.begin(), sorted_points.end(), 0);
+    utility::ParallelSort(
+            sorted_points.begin(), sorted_points.end(), [&](int a, int b) {
+                const Eigen::Vector3i &ca = point_cells[a];
+                const Eigen::Vector3i &cb = point_cells[b];
+                if (ca(0) != cb(0)) return ca(0) < cb(0);
+                if (ca(1) != cb(1)) return ca(1) < cb(1);
+                if (ca(2) != cb(2)) return ca(2) < cb(2);
+                return a < b;
+            });
+    std::vector<Eigen::Vector3i> cells;
+    std::vector<int> cell_begin;
+    std::unordered_map<Eigen::Vector3i, int,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            cell_to_index;
+    for (int sidx = 0; sidx < init_number_of_points; ++sidx) {
+        const Eigen::Vector3i &cell = point_cells[sorted_points[sidx]];
+        if (sidx == 0 || cell != cells.back()) {
+            cell_to_index[cell] = int(cells.size());
+            cells.push_back(cell);
+            cell_begin.push_back(sidx);
+        }
+    }
+    cell_begin.push_back(init_number_of_points);
+    int cell_num = int(cells.size());
+
+    std::vector<int> point_to_cell(init_number_of_points);
+    std::vector<std::vector<int>> cell_neighbours(cell_num);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int cidx = 0; cidx < cell_num; ++cidx) {
+        for (int sidx = cell_begin[cidx]; sidx < cell_begin[cidx + 1];
+             ++sidx) {
+            point_to_cell[sorted_points[sidx]] = cidx;
+        }
+        for (int dx = -1; dx <= 1; ++dx) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dz = -1; dz <= 1; ++dz) {
+                    auto it = cell_to_index.find(cells[cidx] +
+                                                 Eigen::Vector3i(dx, dy, dz));
+                    if (it != cell_to_index.end()) {
+                        cell_neighbours[cidx].push_back(it->second);
+                    }
+                }
             }
-            next_free++;
         }
     }
-    pcl->points_.resize(next_free);
-    if (has_vert_normal) {
-        pcl->normals_.resize(next_free);
+
+    // deleted_round is -1 for samples that are still alive, otherwise the
+    // elimination round in which the sample was deleted
+    std::vector<int> deleted_round(init_number_of_points, -1);
+    std::vector<double> weights(init_number_of_points);
+
+    auto ComputePointWeight = [&](int pidx0) {
+        double weight = 0;
+        for (int nb_cell : cell_neighbours[point_to_cell[pidx0]]) {
+            for (int sidx = cell_begin[nb_cell]; sidx < cell_begin[nb_cell + 1];
+                 ++sidx) {
+                int pidx1 = sorted_points[sidx];
+                // only count weights if not the same point if not deleted
+                if (pidx0 == pidx1 || deleted_round[pidx1] >= 0) {
+                    continue;
+                }
+                double d2 = (pcl->points_[pidx0] - pcl->points_[pidx1])
+                                    .squaredNorm();
+                if (d2 < r_max2) {
+                    weight += WeightFcn(d2);
+                }
+            }
+        }
+        weights[pidx0] = weight;
+    };
+
+    // A sample is eliminated in the current round if its weight is the
+    // largest within its neighbourhood, i.e., the eliminated samples of a
+    // round form an independent set and do not affect each other's weights.
+    auto IsLocalMaximum = [&](int pidx0) {
+        for (int nb_cell : cell_neighbours[point_to_cell[pidx0]]) {
+            for (int sidx = cell_begin[nb_cell]; sidx < cell_begin[nb_cell + 1];
+                 ++sidx) {
+                int pidx1 = sorted_points[sidx];
+                if (pidx0 == pidx1 || deleted_round[pidx1] >= 0 ||
+                    (pcl->points_[pidx0] - pcl->points_[pidx1])
+                                    .squaredNorm() >= r_max2) {
+                    continue;
+                }
+                if (weights[pidx1] > weights[pidx0] ||
+                    (weights[pidx1] == weights[pidx0] && pidx1 < pidx0)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    auto HasDeletedNeighbour = [&](int pidx0, int round) {
+        for (int nb_cell : cell_neighbours[point_to_cell[pidx0]]) {
+            for (int sidx = cell_begin[nb_cell]; sidx < cell_begin[nb_cell + 1];
+                 ++sidx) {
+                int pidx1 = sorted_points[sidx];
+                if (deleted_round[pidx1] == round &&
+                    (pcl->points_[pidx0] - pcl->points_[pidx1])
+                                    .squaredNorm() < r_max2) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int pidx = 0; pidx < init_number_of_points; ++pidx) {
+        ComputePointWeight(pidx);
+    }
+
+    // sample elimination in rounds of independent local maxima
+    typedef std::tuple<double, int> Candidate;
+    int current_number_of_points = init_number_of_points;
+    for (int round = 0; current_number_of_points > int(number_of_points);
+         ++round) {
+        std::vector<Candidate> candidates;
+#ifdef _OPENMP
+#pragma omp parallel
+        {
+#endif
+            std::vector<Candidate> candidates_private;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+            for (int pidx = 0; pidx < init_number_of_points; ++pidx) {
+                if (deleted_round[pidx] < 0 && IsLocalMaximum(pidx)) {
+                    candidates_private.push_back(
+                            Candidate(-weights[pidx], pidx));
+                }
+            }
+#ifdef _OPENMP
+#pragma omp critical
+            {
+#endif
+                candidates.insert(candidates.end(), candidates_private.begin(),
+                                  candidates_private.end());
+#ifdef _OPENMP
+            }
+        }
+#endif
+
+        // only delete the heaviest samples if there are more candidates than
+        // samples left to eliminate
+        size_t number_to_eliminate =
+                size_t(current_number_of_points) - number_of_points;
+        if (candidates.size() > number_to_eliminate) {
+            std::nth_element(candidates.begin(),
+                             candidates.begin() + number_to_eliminate,
+                             candidates.end());
+            candidates.resize(number_to_eliminate);
+        }
+        for (const Candidate &candidate : candidates) {
+            deleted_round[std::get<1>(candidate)] = round;
+        }
+        current_number_of_points -= int(candidates.size());
+
+        // update weights
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int pidx = 0; pidx < init_number_of_points; ++pidx) {
+            if (deleted_round[pidx] < 0 && HasDeletedNeighbour(pidx, round)) {
+                ComputePointWeight(pidx);
+            }
+        }
     }
-    if (has_vert_color) {
-        pcl->colors_.resize(next_free);
+    std::vector<bool> deleted(init_number_of_points);
+    for (int pidx = 0; pidx < init_number_of_points; ++pidx) {
+        deleted[pidx] = deleted_round[pidx] >= 0;
     }
 
+    // update pcl
+    PoissonDiskRemoveDeleted(*pcl, deleted);
+
     return pcl;
 }
 
-void TriangleMesh::RemoveDuplicatedVertices() {
-    typedef std::tuple<double, double, double> Coordinate3;
-    std::unordered_map<Coordinate3, size_t,
-                       utility::hash_tuple::hash<Coordinate3>>
-            point_to_old_index;
-    std::vector<int> index_old_to_new(vertices_.size());
+void TriangleMesh::RemoveDuplicatedVertices(double eps /* = 0.0 */) {
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
-    size_t old_vertex_num = vertices_.size();
-    size_t k = 0;                                  // new index
-    for (size_t i = 0; i < old_vertex_num; i++) {  // old index
-        Coordinate3 coord = std::make_tuple(vertices_[i](0), vertices_[i](1),
-                                            vertices_[i](2));
-        if (point_to_old_index.find(coord) == point_to_old_index.end()) {
-            point_to_old_index[coord] = i;
-            vertices_[k] = vertices_[i];
-            if (has_vert_normal) vertex_normals_[k] = vertex_normals_[i];
-            if (has_vert_color) vertex_colors_[k] = vertex_colors_[i];
-            index_old_to_new[i] = (int)k;
-            k++;
-        } else {
-            index_old_to_new[i] = index_old_to_new[point_to_old_index[coord]];
+    bool has_adjacency_list = HasAdjacencyList();
+    int old_vertex_num = int(vertices_.size());
+
+    // For eps > 0 vertices are compared by the grid cell they fall into
+    std::vector<Eigen::Vector3d> quantized;
+    if (eps > 0) {
+        quantized.resize(old_vertex_num);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < old_vertex_num; i++) {
+            quantized[i] = (vertices_[i] / eps).array().floor();
+        }
+    }
+    const std::vector<Eigen::Vector3d> &keys = eps > 0 ? quantized : vertices_;
+
+    // Sort the vertex indices by coordinates, such that duplicated vertices
+    // form consecutive runs. Ties are broken by the index, thus each run
+    // starts with the first occurrence of the vertex. Vertices with NaN
+    // coordinates are never merged.
+    std::vector<int> order;
+    order.reserve(old_vertex_num);
+    for (int i = 0; i < old_vertex_num; i++) {
+        if (!keys[i].hasNaN()) {
+            order.push_back(i);
+        }
+    }
+    utility::ParallelSort(order.begin(), order.end(), [&](int a, int b) {
+        const Eigen::Vector3d &ka = keys[a];
+        const Eigen::Vector3d &kb = keys[b];
+        if (ka(0) != kb(0)) return ka(0) < kb(0);
+        if (ka(1) != kb(1)) return ka(1) < kb(1);
+        if (ka(2) != kb(2)) return ka(2) < kb(2);
+        return a < b;
+    });
+
+    // Every vertex points to the first vertex of its run
+    std::vector<int> representative(old_vertex_num);
+    std::iota(representative.begin(), representative.end(), 0);
+    int order_size = int(order.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int p = 0; p < order_size; p++) {
+        if (p > 0 && keys[order[p]] == keys[order[p - 1]]) {
+            continue;
+        }
+        for (int q = p + 1;
+             q < order_size && keys[order[q]] == keys[order[p]]; q++) {
+            representative[order[q]] = order[p];
+        }
+    }
+
+    std::vector<int> index_old_to_new(old_vertex_num);
+    int k = 0;  // new index
+    for (int i = 0; i < old_vertex_num; i++) {
+        if (representative[i] == i) {
+            index_old_to_new[i] = k++;
         }
     }
-    vertices_.resize(k);
-    if (has_vert_normal) vertex_normals_.resize(k);
-    if (has_vert_color) vertex_colors_.resize(k);
     if (k < old_vertex_num) {
-        for (auto &triangle : triangles_) {
+        std::vector<Eigen::Vector3d> vertices(k);
+        std::vector<Eigen::Vector3d> vertex_normals(has_vert_normal ? k : 0);
+        std::vector<Eigen::Vector3d> vertex_colors(has_vert_color ? k : 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < old_vertex_num; i++) {
+            if (representative[i] == i) {
+                int new_idx = index_old_to_new[i];
+                vertices[new_idx] = vertices_[i];
+                if (has_vert_normal) {
+                    vertex_normals[new_idx] = vertex_normals_[i];
+                }
+                if (has_vert_color) {
+                    vertex_colors[new_idx] = vertex_colors_[i];
+                }
+            } else {
+                index_old_to_new[i] = index_old_to_new[representative[i]];
+            }
+        }
+        vertices_.swap(vertices);
+        if (has_vert_normal) vertex_normals_.swap(vertex_normals);
+        if (has_vert_color) vertex_colors_.swap(vertex_colors);
+
+        int triangle_num = int(triangles_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < triangle_num; i++) {
+            Eigen::Vector3i &triangle = triangles_[i];
             triangle(0) = index_old_to_new[triangle(0)];
             triangle(1) = index_old_to_new[triangle(1)];
             triangle(2) = index_old_to_new[triangle(2)];
         }
-        if (HasAdjacencyList()) {
+        if (has_adjacency_list) {
             ComputeAdjacencyList();
         }
     }
     utility::PrintDebug(
             "[RemoveDuplicatedVertices] %d vertices have been removed.\n",
-            (int)(old_vertex_num - k));
+            old_vertex_num - k);
 }
 
 void TriangleMesh::RemoveDuplicatedTriangles() {
@@ -895,121 +1241,105 @@ void TriangleMesh::RemoveNonManifoldEdges() {
     }
 }
 
-template <typename F>
+/// Computes a consistent orientation of the triangles by a breadth-first
+/// traversal over the sorted half-edges. flip is set to 1 for the triangles
+/// that have to be flipped. Returns false if the mesh is not orientable.
 bool OrientTriangleHelper(const std::vector<Eigen::Vector3i> &triangles,
-                          F &swap) {
-    std::unordered_map<Eigen::Vector2i, Eigen::Vector2i,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            edge_to_orientation;
-    std::unordered_set<int> unvisited_triangles;
-    std::unordered_map<Eigen::Vector2i, std::unordered_set<int>,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            adjacent_triangles;
-    std::queue<int> triangle_queue;
-
-    auto CreateOrderedEdge = [](int vidx0, int vidx1) {
-        return Eigen::Vector2i(std::min(vidx0, vidx1), std::max(vidx0, vidx1));
-    };
-    auto VerifyAndAdd = [&](int vidx0, int vidx1) {
-        Eigen::Vector2i key = CreateOrderedEdge(vidx0, vidx1);
-        if (edge_to_orientation.count(key) > 0) {
-            if (edge_to_orientation.at(key)(0) == vidx0) {
-                return false;
-            }
-        } else {
-            edge_to_orientation[key] = Eigen::Vector2i(vidx0, vidx1);
+                          const std::vector<Eigen::Vector3i> &sorted_half_edges,
+                          std::vector<char> &flip) {
+    int half_edge_num = int(sorted_half_edges.size());
+
+    // position of each half-edge in sorted_half_edges and the range of its
+    // edge
+    std::vector<int> sorted_index(half_edge_num);
+    std::vector<int> edge_begin(half_edge_num);
+    std::vector<int> edge_end(half_edge_num);
+    for (int sidx = 0; sidx < half_edge_num;) {
+        int send = sidx + 1;
+        while (send < half_edge_num &&
+               sorted_half_edges[send].head<2>() ==
+                       sorted_half_edges[sidx].head<2>()) {
+            send++;
         }
-        return true;
-    };
-    auto AddTriangleNbsToQueue = [&](const Eigen::Vector2i &edge) {
-        for (int nb_tidx : adjacent_triangles[edge]) {
-            triangle_queue.push(nb_tidx);
+        // an edge with more than two triangles cannot be oriented
+        if (send - sidx > 2) {
+            return false;
         }
+        for (int idx = sidx; idx < send; ++idx) {
+            sorted_index[sorted_half_edges[idx](2)] = idx;
+            edge_begin[idx] = sidx;
+            edge_end[idx] = send;
+        }
+        sidx = send;
+    }
+
+    // a half-edge points forward if it goes from the smaller to the larger
+    // vertex index, after flipping its triangle it points backward
+    auto IsForward = [&](int hidx) {
+        const Eigen::Vector3i &triangle = triangles[hidx / 3];
+        bool forward = triangle(hidx % 3) < triangle((hidx % 3 + 1) % 3);
+        return forward != (flip[hidx / 3] != 0);
     };
 
-    for (size_t tidx = 0; tidx < triangles.size(); ++tidx) {
-        unvisited_triangles.insert(tidx);
-        const auto &triangle = triangles[tidx];
-        int vidx0 = triangle(0);
-        int vidx1 = triangle(1);
-        int vidx2 = triangle(2);
-        adjacent_triangles[CreateOrderedEdge(vidx0, vidx1)].insert(tidx);
-        adjacent_triangles[CreateOrderedEdge(vidx1, vidx2)].insert(tidx);
-        adjacent_triangles[CreateOrderedEdge(vidx2, vidx0)].insert(tidx);
-    }
-
-    while (!unvisited_triangles.empty()) {
-        int tidx;
-        if (triangle_queue.empty()) {
-            tidx = *unvisited_triangles.begin();
-        } else {
-            tidx = triangle_queue.front();
-            triangle_queue.pop();
-        }
-        if (unvisited_triangles.count(tidx) > 0) {
-            unvisited_triangles.erase(tidx);
-        } else {
+    int triangle_num = int(triangles.size());
+    std::vector<bool> visited(triangle_num, false);
+    flip.assign(triangle_num, 0);
+    std::queue<int> triangle_queue;
+    for (int seed = 0; seed < triangle_num; ++seed) {
+        if (visited[seed]) {
             continue;
         }
-
-        const auto &triangle = triangles[tidx];
-        int vidx0 = triangle(0);
-        int vidx1 = triangle(1);
-        int vidx2 = triangle(2);
-        Eigen::Vector2i key01 = CreateOrderedEdge(vidx0, vidx1);
-        Eigen::Vector2i key12 = CreateOrderedEdge(vidx1, vidx2);
-        Eigen::Vector2i key20 = CreateOrderedEdge(vidx2, vidx0);
-        bool exist01 = edge_to_orientation.count(key01) > 0;
-        bool exist12 = edge_to_orientation.count(key12) > 0;
-        bool exist20 = edge_to_orientation.count(key20) > 0;
-
-        if (!(exist01 || exist12 || exist20)) {
-            edge_to_orientation[key01] = Eigen::Vector2i(vidx0, vidx1);
-            edge_to_orientation[key12] = Eigen::Vector2i(vidx1, vidx2);
-            edge_to_orientation[key20] = Eigen::Vector2i(vidx2, vidx0);
-        } else {
-            // one flip is allowed
-            if (exist01 && edge_to_orientation.at(key01)(0) == vidx0) {
-                std::swap(vidx0, vidx1);
-                swap(tidx, 0, 1);
-            } else if (exist12 && edge_to_orientation.at(key12)(0) == vidx1) {
-                std::swap(vidx1, vidx2);
-                swap(tidx, 1, 2);
-            } else if (exist20 && edge_to_orientation.at(key20)(0) == vidx2) {
-                std::swap(vidx2, vidx0);
-                swap(tidx, 2, 0);
-            }
-
-            // check if each edge looks in different direction compared to
-            // existing ones if not existend, add the edge to map
-            if (!VerifyAndAdd(vidx0, vidx1)) {
-                return false;
-            }
-            if (!VerifyAndAdd(vidx1, vidx2)) {
-                return false;
-            }
-            if (!VerifyAndAdd(vidx2, vidx0)) {
-                return false;
+        visited[seed] = true;
+        triangle_queue.push(seed);
+        while (!triangle_queue.empty()) {
+            int tidx = triangle_queue.front();
+            triangle_queue.pop();
+            for (int k = 0; k < 3; ++k) {
+                int hidx = 3 * tidx + k;
+                int sidx = sorted_index[hidx];
+                for (int idx = edge_begin[sidx]; idx < edge_end[sidx]; ++idx) {
+                    int nb_hidx = sorted_half_edges[idx](2);
+                    int nb_tidx = nb_hidx / 3;
+                    if (nb_hidx == hidx) {
+                        continue;
+                    }
+                    // adjacent triangles have to traverse the shared edge in
+                    // opposite directions
+                    if (!visited[nb_tidx]) {
+                        visited[nb_tidx] = true;
+                        if (IsForward(nb_hidx) == IsForward(hidx)) {
+                            flip[nb_tidx] = 1;
+                        }
+                        triangle_queue.push(nb_tidx);
+                    } else if (IsForward(nb_hidx) == IsForward(hidx)) {
+                        return false;
+                    }
+                }
             }
         }
-
-        AddTriangleNbsToQueue(key01);
-        AddTriangleNbsToQueue(key12);
-        AddTriangleNbsToQueue(key20);
     }
     return true;
 }
 
 bool TriangleMesh::IsOrientable() const {
-    auto NoOp = [](int, int, int) {};
-    return OrientTriangleHelper(triangles_, NoOp);
+    std::vector<char> flip;
+    return OrientTriangleHelper(triangles_, GetSortedHalfEdges(), flip);
 }
 
 bool TriangleMesh::OrientTriangles() {
-    auto SwapTriangleOrder = [&](int tidx, int idx0, int idx1) {
-        std::swap(triangles_[tidx](idx0), triangles_[tidx](idx1));
-    };
-    return OrientTriangleHelper(triangles_, SwapTriangleOrder);
+    std::vector<char> flip;
+    if (!OrientTriangleHelper(triangles_, GetSortedHalfEdges(), flip)) {
+        return false;
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
+        if (flip[tidx]) {
+            std::swap(triangles_[tidx](1), triangles_[tidx](2));
+        }
+    }
+    return true;
 }
 
 std::unordered_map<Eigen::Vector2i,
@@ -1034,6 +1364,31 @@ TriangleMesh::GetEdgeToTrianglesMap() const {
     return trias_per_edge;
 }
 
+std::vector<Eigen::Vector3i> TriangleMesh::GetSortedHalfEdges() const {
+    int triangle_num = int(triangles_.size());
+    std::vector<Eigen::Vector3i> half_edges(3 * triangle_num);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < triangle_num; ++tidx) {
+        const auto &triangle = triangles_[tidx];
+        for (int k = 0; k < 3; ++k) {
+            int vidx0 = triangle(k);
+            int vidx1 = triangle((k + 1) % 3);
+            half_edges[3 * tidx + k] =
+                    Eigen::Vector3i(std::min(vidx0, vidx1),
+                                    std::max(vidx0, vidx1), 3 * tidx + k);
+        }
+    }
+    utility::ParallelSort(half_edges.begin(), half_edges.end(),
+                          [](const Eigen::Vector3i &a,
+                             const Eigen::Vector3i &b) {
+                              return std::make_tuple(a(0), a(1), a(2)) <
+                                     std::make_tuple(b(0), b(1), b(2));
+                          });
+    return half_edges;
+}
+
 double ComputeTriangleArea(const Eigen::Vector3d &p0,
                            const Eigen::Vector3d &p1,
                            const Eigen::Vector3d &p2) {
@@ -1096,24 +1451,14 @@ Eigen::Vector4d TriangleMesh::GetTrianglePlane(size_t triangle_idx) const {
 }
 
 int TriangleMesh::EulerPoincareCharacteristic() const {
-    std::unordered_set<Eigen::Vector2i,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            edges;
-    for (auto triangle : triangles_) {
-        int min0 = std::min(triangle(0), triangle(1));
-        int max0 = std::max(triangle(0), triangle(1));
-        edges.emplace(Eigen::Vector2i(min0, max0));
-
-        int min1 = std::min(triangle(0), triangle(2));
-        int max1 = std::max(triangle(0), triangle(2));
-        edges.emplace(Eigen::Vector2i(min1, max1));
-
-        int min2 = std::min(triangle(1), triangle(2));
-        int max2 = std::max(triangle(1), triangle(2));
-        edges.emplace(Eigen::Vector2i(min2, max2));
+    std::vector<Eigen::Vector3i> half_edges = GetSortedHalfEdges();
+    int E = 0;
+    for (size_t idx = 0; idx < half_edges.size(); ++idx) {
+        if (idx == 0 ||
+            half_edges[idx].head<2>() != half_edges[idx - 1].head<2>()) {
+            E++;
+        }
     }
-
-    int E = edges.size();
     int V = vertices_.size();
     int F = triangles_.size();
     return V + F - E;
@@ -1121,29 +1466,27 @@ int TriangleMesh::EulerPoincareCharacteristic() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
+    std::vector<Eigen::Vector3i> half_edges = GetSortedHalfEdges();
     std::vector<Eigen::Vector2i> non_manifold_edges;
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
-            non_manifold_edges.push_back(kv.first);
+    for (size_t sidx = 0; sidx < half_edges.size();) {
+        size_t send = sidx + 1;
+        while (send < half_edges.size() &&
+               half_edges[send].head<2>() == half_edges[sidx].head<2>()) {
+            send++;
+        }
+        size_t n_triangles = send - sidx;
+        if ((allow_boundary_edges && n_triangles > 2) ||
+            (!allow_boundary_edges && n_triangles != 2)) {
+            non_manifold_edges.push_back(half_edges[sidx].head<2>());
         }
+        sidx = send;
     }
     return non_manifold_edges;
 }
 
 bool TriangleMesh::IsEdgeManifold(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
-            return false;
-        }
-    }
-    return true;
+    return GetNonManifoldEdges(allow_boundary_edges).empty();
 }
 
 std::vector<int> TriangleMesh::GetNonManifoldVertices() const {
@@ -28,6 +28,7 @@
 
 #include <Eigen/Core>
 #include <memory>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -88,8 +89,10 @@ public:
     void ComputeAdjacencyList();
 
     /// Function that removes duplicated verties, i.e., vertices that have
-    /// identical coordinates.
-    virtual void RemoveDuplicatedVertices();
+    /// identical coordinates. If \param eps is larger than zero, vertices
+    /// that fall into the same cell of a grid with spacing eps are merged.
+    /// The first occurrence of each vertex is kept.
+    virtual void RemoveDuplicatedVertices(double eps = 0.0);
 
     /// Function that removes duplicated triangles, i.e., removes triangles
     /// that reference the same three vertices, independent of their order.
@@ -264,6 +267,13 @@ public:
                        utility::hash_eigen::hash<Eigen::Vector2i>>
     GetEdgeToTrianglesMap() const;
 
+    /// Function that returns the half-edges of the mesh sorted by their
+    /// undirected edge, such that the half-edges of the same edge are
+    /// contiguous. Each entry is (min vertex, max vertex, half-edge index),
+    /// where half-edge index 3 * t + k points from vertex triangles_[t](k) to
+    /// triangles_[t]((k + 1) % 3). Ties are sorted by half-edge index.
+    std::vector<Eigen::Vector3i> GetSortedHalfEdges() const;
+
     /// Function that computes the area of a mesh triangle identified by the
     /// triangle index
     double GetTriangleArea(size_t triangle_idx) const;
@@ -304,6 +314,14 @@ Eigen::Vector4d ComputeTrianglePlane(const Eigen::Vector3d &p0,
 /// Function that computes the convex hull of the triangle mesh using qhull
 std::shared_ptr<TriangleMesh> ComputeMeshConvexHull(const TriangleMesh &mesh);
 
+/// Function to label the connected components of the triangles of \param mesh,
+/// two triangles being connected if they share an edge.
+/// \return the component label of every triangle and the number of triangles
+/// of every component. Components are numbered in the order of their first
+/// triangle.
+std::tuple<std::vector<int>, std::vector<size_t>> ClusterConnectedTriangles(
+        const TriangleMesh &mesh);
+
 /// Function to sample \param number_of_points points uniformly from the mesh
 std::shared_ptr<PointCloud> SamplePointsUniformly(const TriangleMesh &input,
                                                   size_t number_of_points);
@@ -320,6 +338,18 @@ std::shared_ptr<PointCloud> SamplePointsPoissonDisk(
         double init_factor = 5,
         const std::shared_ptr<PointCloud> pcl_init = nullptr);
 
+/// Function to sample \param number_of_points points (blue noise) like
+/// SamplePointsPoissonDisk, but with the sample elimination run in parallel.
+/// The samples are binned into a grid with cell size equal to the
+/// elimination radius. In every round, all samples whose weight is the largest
+/// within their neighbourhood are eliminated concurrently, and only the
+/// weights of their neighbours are updated.
+std::shared_ptr<PointCloud> SamplePointsPoissonDiskParallel(
+        const TriangleMesh &input,
+        size_t number_of_points,
+        double init_factor = 5,
+        const std::shared_ptr<PointCloud> pcl_init = nullptr);
+
 /// Function to subdivide triangle mesh using the simple midpoint algorithm.
 /// Each triangle is subdivided into four triangles per iteration and the
 /// new vertices lie on the midpoint of the triangle edges.
@@ -340,6 +370,77 @@ std::shared_ptr<TriangleMesh> SimplifyVertexClustering(
         TriangleMesh::SimplificationContraction contraction =
                 TriangleMesh::SimplificationContraction::Average);
 
+/// Class that performs vertex clustering simplification incrementally, i.e.,
+/// vertices and triangles are fed one at a time and only the per-voxel
+/// aggregates are kept in memory. This allows to simplify meshes that are
+/// streamed from disk and do not fit into memory as a whole. Memory usage is
+/// proportional to the number of occupied voxels, i.e., to the output mesh.
+/// All vertices have to be added before the triangles that reference them.
+class VertexClusteringSimplifier {
+public:
+    /// \param voxel_size is the edge length of the voxels the vertices are
+    /// pooled in, \param origin is the corner of the voxel with index
+    /// (0, 0, 0). If \param has_vertex_normals or \param has_vertex_colors is
+    /// set, the normals and colors passed to AddVertex are averaged as well.
+    VertexClusteringSimplifier(
+            double voxel_size,
+            const Eigen::Vector3d &origin = Eigen::Vector3d::Zero(),
+            TriangleMesh::SimplificationContraction contraction =
+                    TriangleMesh::SimplificationContraction::Average,
+            bool has_vertex_normals = false,
+            bool has_vertex_colors = false);
+
+public:
+    /// Adds a vertex and returns the index of the output vertex (cluster)
+    /// it is merged into.
+    int AddVertex(const Eigen::Vector3d &vertex,
+                  const Eigen::Vector3d &normal = Eigen::Vector3d::Zero(),
+                  const Eigen::Vector3d &color = Eigen::Vector3d::Zero());
+
+    /// Adds a triangle given the cluster indices returned by AddVertex for
+    /// its three vertices, and the vertex positions \param vertex0,
+    /// \param vertex1, \param vertex2 (used for the Quadric contraction).
+    void AddTriangle(const Eigen::Vector3i &clusters,
+                     const Eigen::Vector3d &vertex0,
+                     const Eigen::Vector3d &vertex1,
+                     const Eigen::Vector3d &vertex2);
+
+    /// Number of clusters, i.e. vertices of the simplified mesh.
+    size_t NumberOfClusters() const { return clusters_.size(); }
+
+    /// Computes the simplified mesh from the accumulated data.
+    std::shared_ptr<TriangleMesh> GetSimplifiedMesh() const;
+
+protected:
+    Eigen::Vector3i GetVoxelIndex(const Eigen::Vector3d &vertex) const;
+
+protected:
+    /// Aggregated data of all vertices that fall into a single voxel.
+    struct Cluster {
+        Eigen::Vector3d vertex_sum_ = Eigen::Vector3d::Zero();
+        Eigen::Vector3d normal_sum_ = Eigen::Vector3d::Zero();
+        Eigen::Vector3d color_sum_ = Eigen::Vector3d::Zero();
+        size_t num_vertices_ = 0;
+        /// Accumulated error quadric (A, b) of the adjacent triangle planes.
+        Eigen::Matrix3d quadric_A_ = Eigen::Matrix3d::Zero();
+        Eigen::Vector3d quadric_b_ = Eigen::Vector3d::Zero();
+    };
+
+    double voxel_size_;
+    Eigen::Vector3d origin_;
+    TriangleMesh::SimplificationContraction contraction_;
+    bool has_vertex_normals_;
+    bool has_vertex_colors_;
+    std::unordered_map<Eigen::Vector3i,
+                       int,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            voxel_to_cluster_;
+    std::vector<Cluster> clusters_;
+    std::unordered_set<Eigen::Vector3i,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            triangles_;
+};
+
 /// Function to simplify mesh using Quadric Error Metric Decimation by
 /// Garland and Heckbert.
 std::shared_ptr<TriangleMesh> SimplifyQuadricDecimation(
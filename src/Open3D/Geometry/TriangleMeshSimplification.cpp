@@ -89,175 +89,174 @@ public:
     double c_;
 };
 
-std::shared_ptr<TriangleMesh> SimplifyVertexClustering(
-        const TriangleMesh& input,
+VertexClusteringSimplifier::VertexClusteringSimplifier(
         double voxel_size,
+        const Eigen::Vector3d& origin /* = Eigen::Vector3d::Zero() */,
         TriangleMesh::SimplificationContraction
-                contraction /* = SimplificationContraction::Average */) {
-    auto mesh = std::make_shared<TriangleMesh>();
-    if (voxel_size <= 0.0) {
-        utility::PrintWarning("[VoxelGridFromPointCloud] voxel_size <= 0.\n");
-        return mesh;
-    }
+                contraction /* = SimplificationContraction::Average */,
+        bool has_vertex_normals /* = false */,
+        bool has_vertex_colors /* = false */)
+    : voxel_size_(voxel_size),
+      origin_(origin),
+      contraction_(contraction),
+      has_vertex_normals_(has_vertex_normals),
+      has_vertex_colors_(has_vertex_colors) {}
+
+Eigen::Vector3i VertexClusteringSimplifier::GetVoxelIndex(
+        const Eigen::Vector3d& vertex) const {
+    Eigen::Vector3d ref_coord = (vertex - origin_) / voxel_size_;
+    return Eigen::Vector3i(int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+                           int(floor(ref_coord(2))));
+}
 
-    Eigen::Vector3d voxel_size3 =
-            Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
-    Eigen::Vector3d voxel_min_bound = input.GetMinBound() - voxel_size3 * 0.5;
-    Eigen::Vector3d voxel_max_bound = input.GetMaxBound() + voxel_size3 * 0.5;
-    if (voxel_size * std::numeric_limits<int>::max() <
-        (voxel_max_bound - voxel_min_bound).maxCoeff()) {
-        utility::PrintWarning(
-                "[VoxelGridFromPointCloud] voxel_size is too small.\n");
-        return mesh;
+int VertexClusteringSimplifier::AddVertex(
+        const Eigen::Vector3d& vertex,
+        const Eigen::Vector3d& normal /* = Eigen::Vector3d::Zero() */,
+        const Eigen::Vector3d& color /* = Eigen::Vector3d::Zero() */) {
+    auto inserted = voxel_to_cluster_.emplace(GetVoxelIndex(vertex),
+                                              int(clusters_.size()));
+    if (inserted.second) {
+        clusters_.emplace_back();
     }
+    int cidx = inserted.first->second;
+    Cluster& cluster = clusters_[cidx];
+    cluster.vertex_sum_ += vertex;
+    if (has_vertex_normals_) {
+        cluster.normal_sum_ += normal;
+    }
+    if (has_vertex_colors_) {
+        cluster.color_sum_ += color;
+    }
+    cluster.num_vertices_++;
+    return cidx;
+}
 
-    auto GetVoxelIdx = [&](const Eigen::Vector3d& vert) {
-        Eigen::Vector3d ref_coord = (vert - voxel_min_bound) / voxel_size;
-        Eigen::Vector3i idx(int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                            int(floor(ref_coord(2))));
-        return idx;
-    };
-
-    std::unordered_map<Eigen::Vector3i, std::unordered_set<int>,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxel_vertices;
-    std::unordered_map<Eigen::Vector3i, int,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxel_vert_ind;
-    int new_vidx = 0;
-    for (size_t vidx = 0; vidx < input.vertices_.size(); ++vidx) {
-        const Eigen::Vector3i vox_idx = GetVoxelIdx(input.vertices_[vidx]);
-        voxel_vertices[vox_idx].insert(vidx);
-
-        if (voxel_vert_ind.count(vox_idx) == 0) {
-            voxel_vert_ind[vox_idx] = new_vidx;
-            new_vidx++;
+void VertexClusteringSimplifier::AddTriangle(const Eigen::Vector3i& clusters,
+                                             const Eigen::Vector3d& vertex0,
+                                             const Eigen::Vector3d& vertex1,
+                                             const Eigen::Vector3d& vertex2) {
+    if (contraction_ == TriangleMesh::SimplificationContraction::Quadric) {
+        Quadric q(ComputeTrianglePlane(vertex0, vertex1, vertex2),
+                  ComputeTriangleArea(vertex0, vertex1, vertex2));
+        for (int i = 0; i < 3; ++i) {
+            clusters_[clusters(i)].quadric_A_ += q.A_;
+            clusters_[clusters(i)].quadric_b_ += q.b_;
         }
     }
 
-    // aggregate vertex info
-    bool has_vert_normal = input.HasVertexNormals();
-    bool has_vert_color = input.HasVertexColors();
-    mesh->vertices_.resize(voxel_vertices.size());
-    if (has_vert_normal) {
-        mesh->vertex_normals_.resize(voxel_vertices.size());
-    }
-    if (has_vert_color) {
-        mesh->vertex_colors_.resize(voxel_vertices.size());
+    int vidx0 = clusters(0);
+    int vidx1 = clusters(1);
+    int vidx2 = clusters(2);
+
+    // only connect if in different voxels
+    if (vidx0 == vidx1 || vidx0 == vidx2 || vidx1 == vidx2) {
+        return;
     }
 
-    auto AvgVertex = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += input.vertices_[vidx];
-        }
-        aggr /= ind.size();
-        return aggr;
-    };
-    auto AvgNormal = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += input.vertex_normals_[vidx];
-        }
-        aggr /= ind.size();
-        return aggr;
-    };
-    auto AvgColor = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += input.vertex_colors_[vidx];
-        }
-        aggr /= ind.size();
-        return aggr;
-    };
+    // Note: there can be still double faces with different orientation
+    // The user has to clean up manually
+    if (vidx1 < vidx0 && vidx1 < vidx2) {
+        int tmp = vidx0;
+        vidx0 = vidx1;
+        vidx1 = vidx2;
+        vidx2 = tmp;
+    } else if (vidx2 < vidx0 && vidx2 < vidx1) {
+        int tmp = vidx1;
+        vidx1 = vidx0;
+        vidx0 = vidx2;
+        vidx2 = tmp;
+    }
 
-    if (contraction == TriangleMesh::SimplificationContraction::Average) {
-        for (const auto& voxel : voxel_vertices) {
-            int vox_vidx = voxel_vert_ind[voxel.first];
-            mesh->vertices_[vox_vidx] = AvgVertex(voxel.second);
-            if (has_vert_normal) {
-                mesh->vertex_normals_[vox_vidx] = AvgNormal(voxel.second);
-            }
-            if (has_vert_color) {
-                mesh->vertex_colors_[vox_vidx] = AvgColor(voxel.second);
-            }
-        }
-    } else if (contraction ==
-               TriangleMesh::SimplificationContraction::Quadric) {
-        // Map triangles
-        std::unordered_map<int, std::unordered_set<int>> vert_to_triangles;
-        int next_tidx = 0;
-        for (size_t tidx = 0; tidx < input.triangles_.size(); ++tidx) {
-            vert_to_triangles[input.triangles_[tidx](0)].emplace(tidx);
-            vert_to_triangles[input.triangles_[tidx](1)].emplace(tidx);
-            vert_to_triangles[input.triangles_[tidx](2)].emplace(tidx);
-        }
+    triangles_.emplace(Eigen::Vector3i(vidx0, vidx1, vidx2));
+}
 
-        for (const auto& voxel : voxel_vertices) {
-            int vox_vidx = voxel_vert_ind[voxel.first];
+std::shared_ptr<TriangleMesh> VertexClusteringSimplifier::GetSimplifiedMesh()
+        const {
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_.resize(clusters_.size());
+    if (has_vertex_normals_) {
+        mesh->vertex_normals_.resize(clusters_.size());
+    }
+    if (has_vertex_colors_) {
+        mesh->vertex_colors_.resize(clusters_.size());
+    }
 
+    for (size_t cidx = 0; cidx < clusters_.size(); ++cidx) {
+        const Cluster& cluster = clusters_[cidx];
+        double num_vertices = double(cluster.num_vertices_);
+        mesh->vertices_[cidx] = cluster.vertex_sum_ / num_vertices;
+        if (contraction_ == TriangleMesh::SimplificationContraction::Quadric) {
             Quadric q;
-            for (int vidx : voxel.second) {
-                for (int tidx : vert_to_triangles[vidx]) {
-                    Eigen::Vector4d p = input.GetTrianglePlane(tidx);
-                    double area = input.GetTriangleArea(tidx);
-                    q += Quadric(p, area);
-                }
-            }
+            q.A_ = cluster.quadric_A_;
+            q.b_ = cluster.quadric_b_;
             if (q.IsInvertible()) {
-                Eigen::Vector3d v = q.Minimum();
-                mesh->vertices_[vox_vidx] = v;
-            } else {
-                mesh->vertices_[vox_vidx] = AvgVertex(voxel.second);
-            }
-
-            if (has_vert_normal) {
-                mesh->vertex_normals_[vox_vidx] = AvgNormal(voxel.second);
-            }
-            if (has_vert_color) {
-                mesh->vertex_colors_[vox_vidx] = AvgColor(voxel.second);
+                mesh->vertices_[cidx] = q.Minimum();
             }
         }
-    }
-
-    //  connect vertices
-    std::unordered_set<Eigen::Vector3i,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            triangles;
-    for (const auto& triangle : input.triangles_) {
-        int vidx0 = voxel_vert_ind[GetVoxelIdx(input.vertices_[triangle(0)])];
-        int vidx1 = voxel_vert_ind[GetVoxelIdx(input.vertices_[triangle(1)])];
-        int vidx2 = voxel_vert_ind[GetVoxelIdx(input.vertices_[triangle(2)])];
-
-        // only connect if in different voxels
-        if (vidx0 == vidx1 || vidx0 == vidx2 || vidx1 == vidx2) {
-            continue;
+        if (has_vertex_normals_) {
+            mesh->vertex_normals_[cidx] = cluster.normal_sum_ / num_vertices;
         }
-
-        // Note: there can be still double faces with different orientation
-        // The user has to clean up manually
-        if (vidx1 < vidx0 && vidx1 < vidx2) {
-            int tmp = vidx0;
-            vidx0 = vidx1;
-            vidx1 = vidx2;
-            vidx2 = tmp;
-        } else if (vidx2 < vidx0 && vidx2 < vidx1) {
-            int tmp = vidx1;
-            vidx1 = vidx0;
-            vidx0 = vidx2;
-            vidx2 = tmp;
+        if (has_vertex_colors_) {
+            mesh->vertex_colors_[cidx] = cluster.color_sum_ / num_vertices;
         }
-
-        triangles.emplace(Eigen::Vector3i(vidx0, vidx1, vidx2));
     }
 
-    mesh->triangles_.resize(triangles.size());
+    mesh->triangles_.resize(triangles_.size());
     int tidx = 0;
-    for (const Eigen::Vector3i& triangle : triangles) {
+    for (const Eigen::Vector3i& triangle : triangles_) {
         mesh->triangles_[tidx] = triangle;
         tidx++;
     }
 
+    return mesh;
+}
+
+std::shared_ptr<TriangleMesh> SimplifyVertexClustering(
+        const TriangleMesh& input,
+        double voxel_size,
+        TriangleMesh::SimplificationContraction
+                contraction /* = SimplificationContraction::Average */) {
+    if (voxel_size <= 0.0) {
+        utility::PrintWarning("[VoxelGridFromPointCloud] voxel_size <= 0.\n");
+        return std::make_shared<TriangleMesh>();
+    }
+
+    Eigen::Vector3d voxel_size3 =
+            Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
+    Eigen::Vector3d voxel_min_bound = input.GetMinBound() - voxel_size3 * 0.5;
+    Eigen::Vector3d voxel_max_bound = input.GetMaxBound() + voxel_size3 * 0.5;
+    if (voxel_size * std::numeric_limits<int>::max() <
+        (voxel_max_bound - voxel_min_bound).maxCoeff()) {
+        utility::PrintWarning(
+                "[VoxelGridFromPointCloud] voxel_size is too small.\n");
+        return std::make_shared<TriangleMesh>();
+    }
+
+    bool has_vert_normal = input.HasVertexNormals();
+    bool has_vert_color = input.HasVertexColors();
+    VertexClusteringSimplifier simplifier(voxel_size, voxel_min_bound,
+                                          contraction, has_vert_normal,
+                                          has_vert_color);
+
+    std::vector<int> vertex_to_cluster(input.vertices_.size());
+    for (size_t vidx = 0; vidx < input.vertices_.size(); ++vidx) {
+        vertex_to_cluster[vidx] = simplifier.AddVertex(
+                input.vertices_[vidx],
+                has_vert_normal ? input.vertex_normals_[vidx]
+                                : Eigen::Vector3d::Zero(),
+                has_vert_color ? input.vertex_colors_[vidx]
+                               : Eigen::Vector3d::Zero());
+    }
+    for (const auto& triangle : input.triangles_) {
+        simplifier.AddTriangle(Eigen::Vector3i(vertex_to_cluster[triangle(0)],
+                                               vertex_to_cluster[triangle(1)],
+                                               vertex_to_cluster[triangle(2)]),
+                               input.vertices_[triangle(0)],
+                               input.vertices_[triangle(1)],
+                               input.vertices_[triangle(2)]);
+    }
+
+    auto mesh = simplifier.GetSimplifiedMesh();
     if (input.HasTriangleNormals()) {
         mesh->ComputeTriangleNormals();
     }
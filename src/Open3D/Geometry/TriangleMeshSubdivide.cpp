@@ -27,14 +27,152 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
-#include <queue>
-#include <tuple>
 
 #include "Open3D/Utility/Console.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Edge-indexed representation of a triangle mesh that replaces per-edge hash
+/// map lookups with flat arrays. Edge ids are assigned in the order in which
+/// the edges are first encountered when traversing the triangles, i.e., edge
+/// (triangles_[0](0), triangles_[0](1)) has id 0.
+class EdgeIndexedMesh {
+public:
+    explicit EdgeIndexedMesh(const TriangleMesh& mesh) {
+        int triangle_num = int(mesh.triangles_.size());
+        int half_edge_num = 3 * triangle_num;
+
+        // the half-edges sorted by their undirected edge, ties are sorted by
+        // the half-edge index, such that the first half-edge of a run is the
+        // first occurrence of the edge.
+        std::vector<Eigen::Vector3i> keys = mesh.GetSortedHalfEdges();
+
+        // runs of equal edges in the sorted half-edges
+        std::vector<int> run_begin;
+        for (int sidx = 0; sidx < half_edge_num; ++sidx) {
+            if (sidx == 0 || keys[sidx].head<2>() != keys[sidx - 1].head<2>()) {
+                run_begin.push_back(sidx);
+            }
+        }
+        int edge_num = int(run_begin.size());
+        run_begin.push_back(half_edge_num);
+
+        // rank the runs by their first half-edge
+        std::vector<int> edge_ids(half_edge_num, -1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int ridx = 0; ridx < edge_num; ++ridx) {
+            edge_ids[keys[run_begin[ridx]](2)] = ridx;
+        }
+        std::vector<int> run_to_edge(edge_num);
+        for (int hidx = 0, eidx = 0; hidx < half_edge_num; ++hidx) {
+            if (edge_ids[hidx] >= 0) {
+                run_to_edge[edge_ids[hidx]] = eidx++;
+            }
+        }
+
+        edges_.resize(edge_num);
+        edge_triangles_begin_.resize(edge_num + 1);
+        for (int ridx = 0; ridx < edge_num; ++ridx) {
+            edge_triangles_begin_[run_to_edge[ridx] + 1] =
+                    run_begin[ridx + 1] - run_begin[ridx];
+        }
+        edge_triangles_begin_[0] = 0;
+        for (int eidx = 0; eidx < edge_num; ++eidx) {
+            edge_triangles_begin_[eidx + 1] += edge_triangles_begin_[eidx];
+        }
+
+        triangle_edges_.resize(triangle_num);
+        edge_triangles_.resize(half_edge_num);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int ridx = 0; ridx < edge_num; ++ridx) {
+            int eidx = run_to_edge[ridx];
+            edges_[eidx] = keys[run_begin[ridx]].head<2>();
+            int offset = edge_triangles_begin_[eidx];
+            for (int sidx = run_begin[ridx]; sidx < run_begin[ridx + 1];
+                 ++sidx) {
+                int hidx = keys[sidx](2);
+                triangle_edges_[hidx / 3](hidx % 3) = eidx;
+                edge_triangles_[offset++] = hidx / 3;
+            }
+        }
+    }
+
+    /// Computes for every vertex the ids of its incident edges.
+    void ComputeVertexEdges(int vertex_num) {
+        int edge_num = int(edges_.size());
+        vertex_edges_begin_.assign(vertex_num + 1, 0);
+        for (const Eigen::Vector2i& edge : edges_) {
+            vertex_edges_begin_[edge(0) + 1]++;
+            vertex_edges_begin_[edge(1) + 1]++;
+        }
+        for (int vidx = 0; vidx < vertex_num; ++vidx) {
+            vertex_edges_begin_[vidx + 1] += vertex_edges_begin_[vidx];
+        }
+        vertex_edges_.resize(2 * edge_num);
+        std::vector<int> offsets(vertex_edges_begin_.begin(),
+                                 vertex_edges_begin_.end() - 1);
+        for (int eidx = 0; eidx < edge_num; ++eidx) {
+            vertex_edges_[offsets[edges_[eidx](0)]++] = eidx;
+            vertex_edges_[offsets[edges_[eidx](1)]++] = eidx;
+        }
+    }
+
+    int NumberOfEdges() const { return int(edges_.size()); }
+    int NumberOfEdgeTriangles(int eidx) const {
+        return edge_triangles_begin_[eidx + 1] - edge_triangles_begin_[eidx];
+    }
+
+public:
+    /// Vertex indices (min, max) of each edge.
+    std::vector<Eigen::Vector2i> edges_;
+    /// Edge ids of the edges (v0, v1), (v1, v2), (v2, v0) of each triangle.
+    std::vector<Eigen::Vector3i> triangle_edges_;
+    /// Triangles adjacent to edge e are
+    /// edge_triangles_[edge_triangles_begin_[e]:edge_triangles_begin_[e+1]].
+    std::vector<int> edge_triangles_begin_;
+    std::vector<int> edge_triangles_;
+    /// Edges incident to vertex v are
+    /// vertex_edges_[vertex_edges_begin_[v]:vertex_edges_begin_[v+1]], only
+    /// available after ComputeVertexEdges.
+    std::vector<int> vertex_edges_begin_;
+    std::vector<int> vertex_edges_;
+};
+
+/// Splits each triangle into four triangles, the vertex of edge e is
+/// n_vertices + e.
+void SubdivideTriangles(const std::vector<Eigen::Vector3i>& triangles,
+                        const EdgeIndexedMesh& edge_mesh,
+                        int n_vertices,
+                        std::vector<Eigen::Vector3i>& new_triangles) {
+    int triangle_num = int(triangles.size());
+    new_triangles.resize(4 * triangle_num);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < triangle_num; ++tidx) {
+        const auto& triangle = triangles[tidx];
+        int vidx0 = triangle(0);
+        int vidx1 = triangle(1);
+        int vidx2 = triangle(2);
+        int vidx01 = n_vertices + edge_mesh.triangle_edges_[tidx](0);
+        int vidx12 = n_vertices + edge_mesh.triangle_edges_[tidx](1);
+        int vidx20 = n_vertices + edge_mesh.triangle_edges_[tidx](2);
+        new_triangles[tidx * 4 + 0] = Eigen::Vector3i(vidx0, vidx01, vidx20);
+        new_triangles[tidx * 4 + 1] = Eigen::Vector3i(vidx01, vidx1, vidx12);
+        new_triangles[tidx * 4 + 2] = Eigen::Vector3i(vidx12, vidx2, vidx20);
+        new_triangles[tidx * 4 + 3] = Eigen::Vector3i(vidx01, vidx12, vidx20);
+    }
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<TriangleMesh> SubdivideMidpoint(const TriangleMesh& input,
                                                 int number_of_iterations) {
     auto mesh = std::make_shared<TriangleMesh>();
@@ -45,61 +183,45 @@ std::shared_ptr<TriangleMesh> SubdivideMidpoint(const TriangleMesh& input,
 
     bool has_vert_normal = input.HasVertexNormals();
     bool has_vert_color = input.HasVertexColors();
-    bool has_tria_normal = input.HasTriangleNormals();
-
-    // Compute and return midpoint.
-    // Also adds edge - new vertex refrence to new_verts map.
-    auto SubdivideEdge =
-            [&](std::unordered_map<Eigen::Vector2i, int,
-                                   utility::hash_eigen::hash<Eigen::Vector2i>>&
-                        new_verts,
-                int vidx0, int vidx1) {
-                int min = std::min(vidx0, vidx1);
-                int max = std::max(vidx0, vidx1);
-                Eigen::Vector2i edge(min, max);
-                if (new_verts.count(edge) == 0) {
-                    mesh->vertices_.push_back(0.5 * (mesh->vertices_[min] +
-                                                     mesh->vertices_[max]));
-                    if (has_vert_normal) {
-                        mesh->vertex_normals_.push_back(
-                                0.5 * (mesh->vertex_normals_[min] +
-                                       mesh->vertex_normals_[max]));
-                    }
-                    if (has_vert_color) {
-                        mesh->vertex_colors_.push_back(
-                                0.5 * (mesh->vertex_colors_[min] +
-                                       mesh->vertex_colors_[max]));
-                    }
-                    int vidx01 = mesh->vertices_.size() - 1;
-                    new_verts[edge] = vidx01;
-                    return vidx01;
-                } else {
-                    return new_verts[edge];
-                }
-            };
+
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        std::unordered_map<Eigen::Vector2i, int,
-                           utility::hash_eigen::hash<Eigen::Vector2i>>
-                new_verts;
-        std::vector<Eigen::Vector3i> new_triangles(4 * mesh->triangles_.size());
-        for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-            const auto& triangle = mesh->triangles_[tidx];
-            int vidx0 = triangle(0);
-            int vidx1 = triangle(1);
-            int vidx2 = triangle(2);
-            int vidx01 = SubdivideEdge(new_verts, vidx0, vidx1);
-            int vidx12 = SubdivideEdge(new_verts, vidx1, vidx2);
-            int vidx20 = SubdivideEdge(new_verts, vidx2, vidx0);
-            new_triangles[tidx * 4 + 0] =
-                    Eigen::Vector3i(vidx0, vidx01, vidx20);
-            new_triangles[tidx * 4 + 1] =
-                    Eigen::Vector3i(vidx01, vidx1, vidx12);
-            new_triangles[tidx * 4 + 2] =
-                    Eigen::Vector3i(vidx12, vidx2, vidx20);
-            new_triangles[tidx * 4 + 3] =
-                    Eigen::Vector3i(vidx01, vidx12, vidx20);
+        EdgeIndexedMesh edge_mesh(*mesh);
+        int n_vertices = int(mesh->vertices_.size());
+        int edge_num = edge_mesh.NumberOfEdges();
+        mesh->vertices_.resize(n_vertices + edge_num);
+        if (has_vert_normal) {
+            mesh->vertex_normals_.resize(n_vertices + edge_num);
+        }
+        if (has_vert_color) {
+            mesh->vertex_colors_.resize(n_vertices + edge_num);
+        }
+
+        // midpoint of each edge
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int eidx = 0; eidx < edge_num; ++eidx) {
+            int min = edge_mesh.edges_[eidx](0);
+            int max = edge_mesh.edges_[eidx](1);
+            int vidx01 = n_vertices + eidx;
+            mesh->vertices_[vidx01] =
+                    0.5 * (mesh->vertices_[min] + mesh->vertices_[max]);
+            if (has_vert_normal) {
+                mesh->vertex_normals_[vidx01] =
+                        0.5 * (mesh->vertex_normals_[min] +
+                               mesh->vertex_normals_[max]);
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[vidx01] =
+                        0.5 * (mesh->vertex_colors_[min] +
+                               mesh->vertex_colors_[max]);
+            }
         }
-        mesh->triangles_ = new_triangles;
+
+        std::vector<Eigen::Vector3i> new_triangles;
+        SubdivideTriangles(mesh->triangles_, edge_mesh, n_vertices,
+                           new_triangles);
+        mesh->triangles_ = std::move(new_triangles);
     }
 
     if (input.HasTriangleNormals()) {
@@ -111,94 +233,116 @@ std::shared_ptr<TriangleMesh> SubdivideMidpoint(const TriangleMesh& input,
 
 std::shared_ptr<TriangleMesh> SubdivideLoop(const TriangleMesh& input,
                                             int number_of_iterations) {
-    typedef std::unordered_map<Eigen::Vector2i, int,
-                               utility::hash_eigen::hash<Eigen::Vector2i>>
-            EdgeNewVertMap;
-    typedef std::unordered_map<Eigen::Vector2i, std::unordered_set<int>,
-                               utility::hash_eigen::hash<Eigen::Vector2i>>
-            EdgeTrianglesMap;
-    typedef std::vector<std::unordered_set<int>> VertexNeighbours;
-
-    auto CreateEdge = [](int vidx0, int vidx1) {
-        return Eigen::Vector2i(std::min(vidx0, vidx1), std::max(vidx0, vidx1));
-    };
-
     bool has_vert_normal = input.HasVertexNormals();
     bool has_vert_color = input.HasVertexColors();
-    bool has_tria_normal = input.HasTriangleNormals();
-
-    auto UpdateVertex = [&](int vidx,
-                            const std::shared_ptr<TriangleMesh>& old_mesh,
-                            std::shared_ptr<TriangleMesh>& new_mesh,
-                            const std::unordered_set<int>& nbs,
-                            const EdgeTrianglesMap& edge_to_triangles) {
-        // check if boundary edge and get nb vertices in that case
-        std::unordered_set<int> boundary_nbs;
-        for (int nb : nbs) {
-            const Eigen::Vector2i edge = CreateEdge(vidx, nb);
-            if (edge_to_triangles.at(edge).size() == 1) {
-                boundary_nbs.insert(nb);
-            }
-        }
 
-        // in manifold meshes this should not happen
-        if (boundary_nbs.size() > 2) {
-            utility::PrintWarning(
-                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
-                    "mesh is not manifold.\n");
-        }
+    auto old_mesh = std::make_shared<TriangleMesh>();
+    old_mesh->vertices_ = input.vertices_;
+    old_mesh->vertex_colors_ = input.vertex_colors_;
+    old_mesh->vertex_normals_ = input.vertex_normals_;
+    old_mesh->triangles_ = input.triangles_;
 
-        double beta, alpha;
-        if (boundary_nbs.size() >= 2) {
-            beta = 1. / 8.;
-            alpha = 1. - boundary_nbs.size() * beta;
-        } else if (nbs.size() == 3) {
-            beta = 3. / 16.;
-            alpha = 1. - nbs.size() * beta;
-        } else {
-            beta = 3. / (8. * nbs.size());
-            alpha = 1. - nbs.size() * beta;
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        EdgeIndexedMesh edge_mesh(*old_mesh);
+        int n_old_vertices = int(old_mesh->vertices_.size());
+        int edge_num = edge_mesh.NumberOfEdges();
+        edge_mesh.ComputeVertexEdges(n_old_vertices);
+
+        if (iter == 0) {
+            for (int eidx = 0; eidx < edge_num; ++eidx) {
+                if (edge_mesh.NumberOfEdgeTriangles(eidx) > 2) {
+                    utility::PrintWarning(
+                            "[SubdivideLoop] non-manifold edge.\n");
+                    break;
+                }
+            }
         }
 
-        new_mesh->vertices_[vidx] = alpha * old_mesh->vertices_[vidx];
+        int n_new_vertices = n_old_vertices + edge_num;
+        auto new_mesh = std::make_shared<TriangleMesh>();
+        new_mesh->vertices_.resize(n_new_vertices);
         if (has_vert_normal) {
-            new_mesh->vertex_normals_[vidx] =
-                    alpha * old_mesh->vertex_normals_[vidx];
+            new_mesh->vertex_normals_.resize(n_new_vertices);
         }
         if (has_vert_color) {
-            new_mesh->vertex_colors_[vidx] =
-                    alpha * old_mesh->vertex_colors_[vidx];
+            new_mesh->vertex_colors_.resize(n_new_vertices);
         }
 
-        auto Update = [&](int nb) {
-            new_mesh->vertices_[vidx] += beta * old_mesh->vertices_[nb];
+        // update the old vertices
+        bool boundary_warning = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(|| : boundary_warning)
+#endif
+        for (int vidx = 0; vidx < n_old_vertices; ++vidx) {
+            int edges_begin = edge_mesh.vertex_edges_begin_[vidx];
+            int edges_end = edge_mesh.vertex_edges_begin_[vidx + 1];
+            int n_nbs = edges_end - edges_begin;
+            int n_boundary_nbs = 0;
+            for (int idx = edges_begin; idx < edges_end; ++idx) {
+                int eidx = edge_mesh.vertex_edges_[idx];
+                if (edge_mesh.NumberOfEdgeTriangles(eidx) == 1) {
+                    n_boundary_nbs++;
+                }
+            }
+
+            // in manifold meshes this should not happen
+            if (n_boundary_nbs > 2) {
+                boundary_warning = true;
+            }
+
+            double beta, alpha;
+            if (n_boundary_nbs >= 2) {
+                beta = 1. / 8.;
+                alpha = 1. - n_boundary_nbs * beta;
+            } else if (n_nbs == 3) {
+                beta = 3. / 16.;
+                alpha = 1. - n_nbs * beta;
+            } else {
+                beta = 3. / (8. * n_nbs);
+                alpha = 1. - n_nbs * beta;
+            }
+
+            new_mesh->vertices_[vidx] = alpha * old_mesh->vertices_[vidx];
             if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx] +=
-                        beta * old_mesh->vertex_normals_[nb];
+                new_mesh->vertex_normals_[vidx] =
+                        alpha * old_mesh->vertex_normals_[vidx];
             }
             if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx] +=
-                        beta * old_mesh->vertex_colors_[nb];
+                new_mesh->vertex_colors_[vidx] =
+                        alpha * old_mesh->vertex_colors_[vidx];
             }
-        };
-        if (boundary_nbs.size() >= 2) {
-            for (int nb : boundary_nbs) {
-                Update(nb);
-            }
-        } else {
-            for (int nb : nbs) {
-                Update(nb);
+            for (int idx = edges_begin; idx < edges_end; ++idx) {
+                int eidx = edge_mesh.vertex_edges_[idx];
+                if (n_boundary_nbs >= 2 &&
+                    edge_mesh.NumberOfEdgeTriangles(eidx) != 1) {
+                    continue;
+                }
+                const Eigen::Vector2i& edge = edge_mesh.edges_[eidx];
+                int nb = edge(0) == vidx ? edge(1) : edge(0);
+                new_mesh->vertices_[vidx] += beta * old_mesh->vertices_[nb];
+                if (has_vert_normal) {
+                    new_mesh->vertex_normals_[vidx] +=
+                            beta * old_mesh->vertex_normals_[nb];
+                }
+                if (has_vert_color) {
+                    new_mesh->vertex_colors_[vidx] +=
+                            beta * old_mesh->vertex_colors_[nb];
+                }
             }
         }
-    };
-
-    auto SubdivideEdge = [&](int vidx0, int vidx1,
-                             const std::shared_ptr<TriangleMesh>& old_mesh,
-                             std::shared_ptr<TriangleMesh>& new_mesh,
-                             EdgeNewVertMap& new_verts,
-                             const EdgeTrianglesMap& edge_to_triangles) {
-        Eigen::Vector2i edge = CreateEdge(vidx0, vidx1);
-        if (new_verts.count(edge) == 0) {
+        if (boundary_warning) {
+            utility::PrintWarning(
+                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
+                    "mesh is not manifold.\n");
+        }
+
+        // compute the new edge vertices
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int eidx = 0; eidx < edge_num; ++eidx) {
+            int vidx0 = edge_mesh.edges_[eidx](0);
+            int vidx1 = edge_mesh.edges_[eidx](1);
             Eigen::Vector3d new_vert =
                     old_mesh->vertices_[vidx0] + old_mesh->vertices_[vidx1];
             Eigen::Vector3d new_normal;
@@ -212,8 +356,8 @@ std::shared_ptr<TriangleMesh> SubdivideLoop(const TriangleMesh& input,
                             old_mesh->vertex_colors_[vidx1];
             }
 
-            const auto& edge_triangles = edge_to_triangles.at(edge);
-            if (edge_triangles.size() < 2) {
+            int n_adjacent_trias = edge_mesh.NumberOfEdgeTriangles(eidx);
+            if (n_adjacent_trias < 2) {
                 new_vert *= 0.5;
                 if (has_vert_normal) {
                     new_normal *= 0.5;
@@ -229,9 +373,10 @@ std::shared_ptr<TriangleMesh> SubdivideLoop(const TriangleMesh& input,
                 if (has_vert_color) {
                     new_color *= 3. / 8.;
                 }
-                int n_adjacent_trias = edge_triangles.size();
                 double scale = 1. / (4. * n_adjacent_trias);
-                for (int tidx : edge_triangles) {
+                for (int idx = edge_mesh.edge_triangles_begin_[eidx];
+                     idx < edge_mesh.edge_triangles_begin_[eidx + 1]; ++idx) {
+                    int tidx = edge_mesh.edge_triangles_[idx];
                     const auto& tria = old_mesh->triangles_[tidx];
                     int vidx2 =
                             (tria(0) != vidx0 && tria(0) != vidx1)
@@ -249,8 +394,7 @@ std::shared_ptr<TriangleMesh> SubdivideLoop(const TriangleMesh& input,
                 }
             }
 
-            int vidx01 = old_mesh->vertices_.size() + new_verts.size();
-
+            int vidx01 = n_old_vertices + eidx;
             new_mesh->vertices_[vidx01] = new_vert;
             if (has_vert_normal) {
                 new_mesh->vertex_normals_[vidx01] = new_normal;
@@ -258,111 +402,11 @@ std::shared_ptr<TriangleMesh> SubdivideLoop(const TriangleMesh& input,
             if (has_vert_color) {
                 new_mesh->vertex_colors_[vidx01] = new_color;
             }
-
-            new_verts[edge] = vidx01;
-            return vidx01;
-        } else {
-            int vidx01 = new_verts[edge];
-            return vidx01;
-        }
-    };
-
-    auto InsertTriangle = [&](int tidx, int vidx0, int vidx1, int vidx2,
-                              std::shared_ptr<TriangleMesh>& mesh,
-                              EdgeTrianglesMap& edge_to_triangles,
-                              VertexNeighbours& vertex_neighbours) {
-        mesh->triangles_[tidx] = Eigen::Vector3i(vidx0, vidx1, vidx2);
-        edge_to_triangles[CreateEdge(vidx0, vidx1)].insert(tidx);
-        edge_to_triangles[CreateEdge(vidx1, vidx2)].insert(tidx);
-        edge_to_triangles[CreateEdge(vidx2, vidx0)].insert(tidx);
-        vertex_neighbours[vidx0].insert(vidx1);
-        vertex_neighbours[vidx0].insert(vidx2);
-        vertex_neighbours[vidx1].insert(vidx0);
-        vertex_neighbours[vidx1].insert(vidx2);
-        vertex_neighbours[vidx2].insert(vidx0);
-        vertex_neighbours[vidx2].insert(vidx1);
-    };
-
-    EdgeTrianglesMap edge_to_triangles;
-    VertexNeighbours vertex_neighbours(input.vertices_.size());
-    for (size_t tidx = 0; tidx < input.triangles_.size(); ++tidx) {
-        const auto& tria = input.triangles_[tidx];
-        Eigen::Vector2i e0 = CreateEdge(tria(0), tria(1));
-        edge_to_triangles[e0].insert(tidx);
-        Eigen::Vector2i e1 = CreateEdge(tria(1), tria(2));
-        edge_to_triangles[e1].insert(tidx);
-        Eigen::Vector2i e2 = CreateEdge(tria(2), tria(0));
-        edge_to_triangles[e2].insert(tidx);
-
-        if (edge_to_triangles[e0].size() > 2 ||
-            edge_to_triangles[e1].size() > 2 ||
-            edge_to_triangles[e2].size() > 2) {
-            utility::PrintWarning("[SubdivideLoop] non-manifold edge.\n");
-        }
-
-        vertex_neighbours[tria(0)].insert(tria(1));
-        vertex_neighbours[tria(0)].insert(tria(2));
-        vertex_neighbours[tria(1)].insert(tria(0));
-        vertex_neighbours[tria(1)].insert(tria(2));
-        vertex_neighbours[tria(2)].insert(tria(0));
-        vertex_neighbours[tria(2)].insert(tria(1));
-    }
-
-    auto old_mesh = std::make_shared<TriangleMesh>();
-    old_mesh->vertices_ = input.vertices_;
-    old_mesh->vertex_colors_ = input.vertex_colors_;
-    old_mesh->vertex_normals_ = input.vertex_normals_;
-    old_mesh->triangles_ = input.triangles_;
-
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        int n_new_vertices =
-                old_mesh->vertices_.size() + edge_to_triangles.size();
-        int n_new_triangles = 4 * old_mesh->triangles_.size();
-        auto new_mesh = std::make_shared<TriangleMesh>();
-        new_mesh->vertices_.resize(n_new_vertices);
-        if (has_vert_normal) {
-            new_mesh->vertex_normals_.resize(n_new_vertices);
-        }
-        if (has_vert_color) {
-            new_mesh->vertex_colors_.resize(n_new_vertices);
-        }
-        new_mesh->triangles_.resize(n_new_triangles);
-
-        EdgeNewVertMap new_verts;
-        EdgeTrianglesMap new_edge_to_triangles;
-        VertexNeighbours new_vertex_neighbours(n_new_vertices);
-
-        for (size_t vidx = 0; vidx < old_mesh->vertices_.size(); ++vidx) {
-            UpdateVertex(vidx, old_mesh, new_mesh, vertex_neighbours[vidx],
-                         edge_to_triangles);
-        }
-
-        for (size_t tidx = 0; tidx < old_mesh->triangles_.size(); ++tidx) {
-            const auto& triangle = old_mesh->triangles_[tidx];
-            int vidx0 = triangle(0);
-            int vidx1 = triangle(1);
-            int vidx2 = triangle(2);
-
-            int vidx01 = SubdivideEdge(vidx0, vidx1, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx12 = SubdivideEdge(vidx1, vidx2, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx20 = SubdivideEdge(vidx2, vidx0, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-
-            InsertTriangle(tidx * 4 + 0, vidx0, vidx01, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(tidx * 4 + 1, vidx01, vidx1, vidx12, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(tidx * 4 + 2, vidx12, vidx2, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(tidx * 4 + 3, vidx01, vidx12, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
         }
 
+        SubdivideTriangles(old_mesh->triangles_, edge_mesh, n_old_vertices,
+                           new_mesh->triangles_);
         old_mesh = std::move(new_mesh);
-        edge_to_triangles = std::move(new_edge_to_triangles);
-        vertex_neighbours = std::move(new_vertex_neighbours);
     }
 
     if (input.HasTriangleNormals()) {
@@ -26,11 +26,93 @@
 
 #include "Open3D/Geometry/VoxelGrid.h"
 
+#include <cmath>
+#include <limits>
 #include <unordered_map>
 
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/Octree.h"
+#include "Open3D/Utility/Console.h"
 
 namespace open3d {
+
+namespace {
+using namespace geometry;
+
+const Eigen::Vector3i kNeighborOffsets[6] = {
+        Eigen::Vector3i(-1, 0, 0), Eigen::Vector3i(1, 0, 0),
+        Eigen::Vector3i(0, -1, 0), Eigen::Vector3i(0, 1, 0),
+        Eigen::Vector3i(0, 0, -1), Eigen::Vector3i(0, 0, 1)};
+
+size_t HashGridIndex(const Eigen::Vector3i &grid_index) {
+    uint64_t h = uint64_t(uint32_t(grid_index(0))) * 0x9E3779B97F4A7C15ULL ^
+                 uint64_t(uint32_t(grid_index(1))) * 0xC2B2AE3D27D4EB4FULL ^
+                 uint64_t(uint32_t(grid_index(2))) * 0x165667B19E3779F9ULL;
+    return size_t(h ^ (h >> 29));
+}
+
+bool CheckCompatibleGrids(const VoxelGrid &a,
+                          const VoxelGrid &b,
+                          const char *function_name) {
+    if (a.voxel_size_ != b.voxel_size_ || a.origin_ != b.origin_) {
+        utility::PrintWarning(
+                "[%s] voxel grids have different voxel_size_ or origin_, "
+                "skipping.\n",
+                function_name);
+        return false;
+    }
+    return true;
+}
+
+/// Projects the center of every voxel with camera_parameter and flags the
+/// voxels for which carve(u, v, z) returns true, z being the depth of the
+/// center in camera coordinates.
+template <typename CarveFunc>
+std::vector<char> ProjectAndCarve(
+        const VoxelGrid &voxelgrid,
+        const Image &image,
+        const camera::PinholeCameraParameters &camera_parameter,
+        bool keep_voxels_outside_image,
+        CarveFunc carve) {
+    const Eigen::Matrix4d extrinsic = camera_parameter.extrinsic_;
+    const auto focal = camera_parameter.intrinsic_.GetFocalLength();
+    const auto principal = camera_parameter.intrinsic_.GetPrincipalPoint();
+    const int n = int(voxelgrid.voxels_.size());
+    std::vector<char> remove(n, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < n; i++) {
+        Eigen::Vector3d center =
+                voxelgrid.origin_ +
+                (voxelgrid.voxels_[i].grid_index_.cast<double>().array() +
+                 0.5)
+                                .matrix() *
+                        voxelgrid.voxel_size_;
+        Eigen::Vector4d pt =
+                extrinsic * Eigen::Vector4d(center(0), center(1), center(2), 1);
+        bool inside = false;
+        if (pt(2) > 0) {
+            double u = pt(0) * focal.first / pt(2) + principal.first;
+            double v = pt(1) * focal.second / pt(2) + principal.second;
+            int ui = int(std::floor(u + 0.5));
+            int vi = int(std::floor(v + 0.5));
+            if (ui >= 0 && ui < image.width_ && vi >= 0 &&
+                vi < image.height_) {
+                inside = true;
+                remove[i] = carve(ui, vi, pt(2)) ? 1 : 0;
+            }
+        }
+        if (!inside && !keep_voxels_outside_image) {
+            remove[i] = 1;
+        }
+    }
+    return remove;
+}
+
+}  // unnamed namespace
+
 namespace geometry {
 
 VoxelGrid::VoxelGrid(const VoxelGrid &src_voxel_grid)
@@ -39,10 +121,21 @@ VoxelGrid::VoxelGrid(const VoxelGrid &src_voxel_grid)
       origin_(src_voxel_grid.origin_),
       voxels_(src_voxel_grid.voxels_) {}
 
+VoxelGrid &VoxelGrid::operator=(const VoxelGrid &src_voxel_grid) {
+    voxel_size_ = src_voxel_grid.voxel_size_;
+    origin_ = src_voxel_grid.origin_;
+    voxels_ = src_voxel_grid.voxels_;
+    voxel_index_.clear();
+    voxel_index_size_ = 0;
+    return *this;
+}
+
 void VoxelGrid::Clear() {
     voxel_size_ = 0.0;
     origin_ = Eigen::Vector3d::Zero();
     voxels_.clear();
+    voxel_index_.clear();
+    voxel_index_size_ = 0;
 }
 
 bool VoxelGrid::IsEmpty() const { return !HasVoxels(); }
@@ -95,11 +188,31 @@ VoxelGrid &VoxelGrid::Rotate(const Eigen::Vector3d &rotation,
 }
 
 VoxelGrid &VoxelGrid::operator+=(const VoxelGrid &voxelgrid) {
-    throw std::runtime_error("VoxelGrid::operator+= is not supported");
+    if (!voxelgrid.HasVoxels()) {
+        return *this;
+    }
+    if (!HasVoxels()) {
+        voxel_size_ = voxelgrid.voxel_size_;
+        origin_ = voxelgrid.origin_;
+        voxels_ = voxelgrid.voxels_;
+        UpdateVoxelIndex();
+        return *this;
+    }
+    if (!CheckCompatibleGrids(*this, voxelgrid, "VoxelGrid::operator+=")) {
+        return *this;
+    }
+    const size_t n = voxelgrid.voxels_.size();
+    for (size_t i = 0; i < n; i++) {
+        const Voxel &voxel = voxelgrid.voxels_[i];
+        if (FindVoxel(voxel.grid_index_) < 0) {
+            AddVoxel(voxel);
+        }
+    }
+    return *this;
 }
 
 VoxelGrid VoxelGrid::operator+(const VoxelGrid &voxelgrid) const {
-    throw std::runtime_error("VoxelGrid::operator+ is not supported");
+    return (VoxelGrid(*this) += voxelgrid);
 }
 
 Eigen::Vector3i VoxelGrid::GetVoxel(const Eigen::Vector3d &point) const {
@@ -107,6 +220,193 @@ Eigen::Vector3i VoxelGrid::GetVoxel(const Eigen::Vector3d &point) const {
     return (Eigen::floor(voxel_f.array())).cast<int>();
 }
 
+bool VoxelGrid::HasVoxel(const Eigen::Vector3i &grid_index) const {
+    return FindVoxel(grid_index) >= 0;
+}
+
+int VoxelGrid::FindVoxel(const Eigen::Vector3i &grid_index) const {
+    if (voxel_index_.empty() || voxel_index_size_ != voxels_.size()) {
+        UpdateVoxelIndex();
+    }
+    const size_t mask = voxel_index_.size() - 1;
+    for (size_t slot = HashGridIndex(grid_index) & mask;;
+         slot = (slot + 1) & mask) {
+        int pos = voxel_index_[slot];
+        if (pos < 0) {
+            return -1;
+        }
+        if (size_t(pos) < voxels_.size() &&
+            voxels_[pos].grid_index_ == grid_index) {
+            return pos;
+        }
+    }
+}
+
+void VoxelGrid::AddVoxel(const Voxel &voxel) {
+    int pos = FindVoxel(voxel.grid_index_);
+    if (pos >= 0) {
+        voxels_[pos].color_ = voxel.color_;
+        return;
+    }
+    voxels_.push_back(voxel);
+    // Insert in place while the load factor stays below 1/2, otherwise the
+    // next lookup rebuilds a larger table.
+    if (2 * voxels_.size() <= voxel_index_.size()) {
+        const size_t mask = voxel_index_.size() - 1;
+        size_t slot = HashGridIndex(voxel.grid_index_) & mask;
+        while (voxel_index_[slot] >= 0) {
+            slot = (slot + 1) & mask;
+        }
+        voxel_index_[slot] = int(voxels_.size() - 1);
+        voxel_index_size_ = voxels_.size();
+    }
+}
+
+void VoxelGrid::UpdateVoxelIndex() const {
+    size_t capacity = 16;
+    while (capacity < 2 * voxels_.size()) {
+        capacity <<= 1;
+    }
+    voxel_index_.assign(capacity, -1);
+    const size_t mask = capacity - 1;
+    for (size_t i = 0; i < voxels_.size(); i++) {
+        const Eigen::Vector3i &grid_index = voxels_[i].grid_index_;
+        size_t slot = HashGridIndex(grid_index) & mask;
+        while (voxel_index_[slot] >= 0 &&
+               voxels_[voxel_index_[slot]].grid_index_ != grid_index) {
+            slot = (slot + 1) & mask;
+        }
+        // Duplicated grid indices resolve to the first voxel.
+        if (voxel_index_[slot] < 0) {
+            voxel_index_[slot] = int(i);
+        }
+    }
+    voxel_index_size_ = voxels_.size();
+}
+
+void VoxelGrid::RemoveVoxels(const std::vector<char> &remove) {
+    size_t k = 0;
+    for (size_t i = 0; i < voxels_.size(); i++) {
+        if (!remove[i]) {
+            voxels_[k++] = voxels_[i];
+        }
+    }
+    voxels_.resize(k);
+    UpdateVoxelIndex();
+}
+
+VoxelGrid &VoxelGrid::Intersect(const VoxelGrid &voxelgrid) {
+    if (!CheckCompatibleGrids(*this, voxelgrid, "VoxelGrid::Intersect")) {
+        return *this;
+    }
+    voxelgrid.UpdateVoxelIndex();
+    const int n = int(voxels_.size());
+    std::vector<char> remove(n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < n; i++) {
+        remove[i] = voxelgrid.HasVoxel(voxels_[i].grid_index_) ? 0 : 1;
+    }
+    RemoveVoxels(remove);
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::Subtract(const VoxelGrid &voxelgrid) {
+    if (!CheckCompatibleGrids(*this, voxelgrid, "VoxelGrid::Subtract")) {
+        return *this;
+    }
+    voxelgrid.UpdateVoxelIndex();
+    const int n = int(voxels_.size());
+    std::vector<char> remove(n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < n; i++) {
+        remove[i] = voxelgrid.HasVoxel(voxels_[i].grid_index_) ? 1 : 0;
+    }
+    RemoveVoxels(remove);
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::Dilate(int iterations) {
+    for (int iter = 0; iter < iterations; iter++) {
+        const size_t n = voxels_.size();
+        for (size_t i = 0; i < n; i++) {
+            for (const Eigen::Vector3i &offset : kNeighborOffsets) {
+                Eigen::Vector3i neighbor = voxels_[i].grid_index_ + offset;
+                if (FindVoxel(neighbor) < 0) {
+                    AddVoxel(Voxel(neighbor, voxels_[i].color_));
+                }
+            }
+        }
+    }
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::Erode(int iterations) {
+    for (int iter = 0; iter < iterations && HasVoxels(); iter++) {
+        UpdateVoxelIndex();
+        const int n = int(voxels_.size());
+        std::vector<char> remove(n, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < n; i++) {
+            for (const Eigen::Vector3i &offset : kNeighborOffsets) {
+                if (!HasVoxel(voxels_[i].grid_index_ + offset)) {
+                    remove[i] = 1;
+                    break;
+                }
+            }
+        }
+        RemoveVoxels(remove);
+    }
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::CarveDepthMap(
+        const Image &depth_map,
+        const camera::PinholeCameraParameters &camera_parameter,
+        bool keep_voxels_outside_image) {
+    if (depth_map.num_of_channels_ != 1 || depth_map.bytes_per_channel_ != 4) {
+        utility::PrintWarning(
+                "[VoxelGrid::CarveDepthMap] depth_map has to be a single "
+                "channel float image.\n");
+        return *this;
+    }
+    // A voxel is carved only if it lies entirely in front of the surface.
+    const double half_diagonal = voxel_size_ * std::sqrt(3.0) / 2.0;
+    std::vector<char> remove = ProjectAndCarve(
+            *this, depth_map, camera_parameter, keep_voxels_outside_image,
+            [&](int u, int v, double z) {
+                float depth = *PointerAt<float>(depth_map, u, v);
+                return depth > 0 && z + half_diagonal < depth;
+            });
+    RemoveVoxels(remove);
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::CarveSilhouette(
+        const Image &silhouette_mask,
+        const camera::PinholeCameraParameters &camera_parameter,
+        bool keep_voxels_outside_image) {
+    if (silhouette_mask.num_of_channels_ != 1 ||
+        silhouette_mask.bytes_per_channel_ != 1) {
+        utility::PrintWarning(
+                "[VoxelGrid::CarveSilhouette] silhouette_mask has to be a "
+                "single channel uint8 image.\n");
+        return *this;
+    }
+    std::vector<char> remove = ProjectAndCarve(
+            *this, silhouette_mask, camera_parameter,
+            keep_voxels_outside_image, [&](int u, int v, double /*z*/) {
+                return *PointerAt<uint8_t>(silhouette_mask, u, v) == 0;
+            });
+    RemoveVoxels(remove);
+    return *this;
+}
+
 void VoxelGrid::FromOctree(const Octree &octree) {
     // TODO: currently only handles color leaf nodes
     // Get leaf nodes and their node_info
@@ -127,6 +427,7 @@ void VoxelGrid::FromOctree(const Octree &octree) {
     // Prepare dimensions for voxel
     origin_ = octree.origin_;
     voxels_.clear();
+    voxel_size_ = std::numeric_limits<double>::max();
     for (const auto &it : map_node_to_node_info) {
         voxel_size_ = std::min(voxel_size_, it.second->size_);
     }
@@ -33,11 +33,17 @@
 #include "Open3D/Geometry/Geometry3D.h"
 
 namespace open3d {
+
+namespace camera {
+class PinholeCameraParameters;
+}
+
 namespace geometry {
 
 class PointCloud;
 class TriangleMesh;
 class Octree;
+class Image;
 
 class Voxel {
 public:
@@ -56,6 +62,7 @@ class VoxelGrid : public Geometry3D {
 public:
     VoxelGrid() : Geometry3D(Geometry::GeometryType::VoxelGrid) {}
     VoxelGrid(const VoxelGrid &src_voxel_grid);
+    VoxelGrid &operator=(const VoxelGrid &src_voxel_grid);
     ~VoxelGrid() override {}
 
 public:
@@ -71,6 +78,9 @@ public:
                       RotationType type = RotationType::XYZ) override;
 
 public:
+    /// Union of the voxels. Voxels of voxelgrid already present keep their
+    /// color. Both grids must share voxel_size_ and origin_, unless this grid
+    /// has no voxels.
     VoxelGrid &operator+=(const VoxelGrid &voxelgrid);
     VoxelGrid operator+(const VoxelGrid &voxelgrid) const;
 
@@ -81,18 +91,93 @@ public:
     }
     Eigen::Vector3i GetVoxel(const Eigen::Vector3d &point) const;
 
+    /// Returns true if there is a voxel at grid_index. O(1) with the voxel
+    /// index, see UpdateVoxelIndex.
+    bool HasVoxel(const Eigen::Vector3i &grid_index) const;
+
+    /// Returns the position in voxels_ of the voxel at grid_index, -1 if there
+    /// is none. The voxel index is rebuilt lazily if it is out of date, so
+    /// concurrent calls, also through HasVoxel, are only safe after
+    /// UpdateVoxelIndex was called since the last change to voxels_.
+    int FindVoxel(const Eigen::Vector3i &grid_index) const;
+
+    /// Adds voxel, or overwrites the color of the voxel at its grid index.
+    void AddVoxel(const Voxel &voxel);
+
+    /// Rebuilds the open addressing hash index from grid_index_ to the
+    /// position in voxels_. Lookups rebuild it lazily when the number of
+    /// voxels changed; call it after modifying grid indices in voxels_
+    /// directly, and before concurrent lookups from several threads.
+    void UpdateVoxelIndex() const;
+
+    /// Keeps only the voxels that are also in voxelgrid.
+    VoxelGrid &Intersect(const VoxelGrid &voxelgrid);
+
+    /// Removes the voxels that are in voxelgrid.
+    VoxelGrid &Subtract(const VoxelGrid &voxelgrid);
+
+    /// Morphological dilation with the 6-neighborhood. New voxels take the
+    /// color of a neighbor.
+    VoxelGrid &Dilate(int iterations = 1);
+
+    /// Morphological erosion with the 6-neighborhood.
+    VoxelGrid &Erode(int iterations = 1);
+
+    /// Removes the voxels in the free space in front of a depth map, i.e.
+    /// those entirely closer to the camera than the depth at the pixel of
+    /// their center. depth_map has to be a float image in meters, such as
+    /// returned by Image::ConvertDepthToFloatImage. Pixels with depth 0 carve
+    /// nothing.
+    VoxelGrid &CarveDepthMap(
+            const Image &depth_map,
+            const camera::PinholeCameraParameters &camera_parameter,
+            bool keep_voxels_outside_image = true);
+
+    /// Removes the voxels whose center projects to a zero pixel of the single
+    /// channel silhouette_mask.
+    VoxelGrid &CarveSilhouette(
+            const Image &silhouette_mask,
+            const camera::PinholeCameraParameters &camera_parameter,
+            bool keep_voxels_outside_image = true);
+
     void FromOctree(const Octree &octree);
 
     std::shared_ptr<geometry::Octree> ToOctree(const size_t &max_depth) const;
 
+protected:
+    /// Removes the voxels at the positions where remove is non-zero.
+    void RemoveVoxels(const std::vector<char> &remove);
+
 public:
-    double voxel_size_;
-    Eigen::Vector3d origin_;
+    double voxel_size_ = 0.0;
+    Eigen::Vector3d origin_ = Eigen::Vector3d::Zero();
     std::vector<Voxel> voxels_;
+
+protected:
+    /// Open addressing hash table with linear probing holding positions in
+    /// voxels_, -1 for empty slots.
+    mutable std::vector<int> voxel_index_;
+    mutable size_t voxel_index_size_ = 0;
 };
 
+/// Creates a voxel grid with the voxels occupied by the points of input,
+/// colored with the average point color. The points are binned in parallel
+/// and the voxels are sorted by grid index.
 std::shared_ptr<VoxelGrid> CreateSurfaceVoxelGridFromPointCloud(
         const PointCloud &input, double voxel_size);
 
+/// Creates a voxel grid with the voxels overlapped by the triangles of input,
+/// using exact triangle-box tests. Triangles are processed in parallel and
+/// the voxels are sorted by grid index.
+std::shared_ptr<VoxelGrid> CreateSurfaceVoxelGridFromTriangleMesh(
+        const TriangleMesh &input, double voxel_size);
+
+/// Creates a voxel grid with the surface voxels of input and the voxels
+/// enclosed by them, found by flood filling the outside of the surface. The
+/// mesh has to be watertight at the resolution of voxel_size, otherwise the
+/// fill leaks in and only the surface voxels remain.
+std::shared_ptr<VoxelGrid> CreateVoxelGridFromTriangleMesh(
+        const TriangleMesh &input, double voxel_size);
+
 }  // namespace geometry
 }  // namespace open3d
@@ -24,10 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <numeric>
-#include <unordered_map>
 
+#include "Open3D/Geometry/IntersectionTest.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Geometry/VoxelGrid.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Helper.h"
@@ -37,34 +39,86 @@ namespace open3d {
 namespace {
 using namespace geometry;
 
-class PointCloudVoxel {
-public:
-    PointCloudVoxel() : num_of_points_(0), color_(0.0, 0.0, 0.0) {}
-
-public:
-    void AddPoint(const Eigen::Vector3i &voxel_index,
-                  const PointCloud &cloud,
-                  int index) {
-        coordinate_ = voxel_index;
-        if (cloud.HasColors()) {
-            color_ += cloud.colors_[index];
+bool LessGridIndex(const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+    return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                        b.data() + 3);
+}
+
+/// Returns the sorted grid indices of the voxels overlapped by the triangles
+/// of mesh. Each thread collects the voxels of its triangles separately,
+/// the results are merged at the end.
+std::vector<Eigen::Vector3i> VoxelizeTriangles(const TriangleMesh &mesh,
+                                               const Eigen::Vector3d &origin,
+                                               double voxel_size) {
+    int num_threads = 1;
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+    std::vector<std::vector<Eigen::Vector3i>> thread_voxels(num_threads);
+    const int num_triangles = int(mesh.triangles_.size());
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+    {
+#endif
+        int thread_num = 0;
+#ifdef _OPENMP
+        thread_num = omp_get_thread_num();
+#endif
+        std::vector<Eigen::Vector3i> &voxels = thread_voxels[thread_num];
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int tidx = 0; tidx < num_triangles; ++tidx) {
+            const Eigen::Vector3i &triangle = mesh.triangles_[tidx];
+            const Eigen::Vector3d &p0 = mesh.vertices_[triangle(0)];
+            const Eigen::Vector3d &p1 = mesh.vertices_[triangle(1)];
+            const Eigen::Vector3d &p2 = mesh.vertices_[triangle(2)];
+            Eigen::Vector3i min_index =
+                    Eigen::floor(((p0.cwiseMin(p1).cwiseMin(p2) - origin) /
+                                  voxel_size)
+                                         .array())
+                            .cast<int>();
+            Eigen::Vector3i max_index =
+                    Eigen::floor(((p0.cwiseMax(p1).cwiseMax(p2) - origin) /
+                                  voxel_size)
+                                         .array())
+                            .cast<int>();
+            for (int x = min_index(0); x <= max_index(0); ++x) {
+                for (int y = min_index(1); y <= max_index(1); ++y) {
+                    for (int z = min_index(2); z <= max_index(2); ++z) {
+                        Eigen::Vector3i grid_index(x, y, z);
+                        Eigen::Vector3d box_min =
+                                origin +
+                                grid_index.cast<double>() * voxel_size;
+                        Eigen::Vector3d box_max =
+                                box_min +
+                                Eigen::Vector3d::Constant(voxel_size);
+                        if (IntersectingTriangleAABB(p0, p1, p2, box_min,
+                                                     box_max)) {
+                            voxels.push_back(grid_index);
+                        }
+                    }
+                }
+            }
         }
-        num_of_points_++;
+        std::sort(voxels.begin(), voxels.end(), LessGridIndex);
+        voxels.erase(std::unique(voxels.begin(), voxels.end()), voxels.end());
+#ifdef _OPENMP
     }
+#endif
 
-    Eigen::Vector3i GetVoxelCoordinate() const { return coordinate_; }
-
-    Eigen::Vector3d GetAverageColor() const {
-        return color_ / double(num_of_points_);
+    std::vector<Eigen::Vector3i> merged;
+    for (const auto &voxels : thread_voxels) {
+        merged.insert(merged.end(), voxels.begin(), voxels.end());
     }
+    if (num_threads > 1) {
+        utility::ParallelSort(merged.begin(), merged.end(), LessGridIndex);
+        merged.erase(std::unique(merged.begin(), merged.end()), merged.end());
+    }
+    return merged;
+}
 
-public:
-    int num_of_points_;
-    Eigen::Vector3i coordinate_;
-    Eigen::Vector3d color_;
-};
-
-}  // namespace
+}  // unnamed namespace
 
 namespace geometry {
 
@@ -87,31 +141,169 @@ std::shared_ptr<VoxelGrid> CreateSurfaceVoxelGridFromPointCloud(
     }
     output->voxel_size_ = voxel_size;
     output->origin_ = voxel_min_bound;
-    std::unordered_map<Eigen::Vector3i, PointCloudVoxel,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        ref_coord = (input.points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(voxel_index, input, i);
+
+    // Bin the points in parallel and sort them by grid index, so that each
+    // voxel is a contiguous run of points.
+    const int num_points = int(input.points_.size());
+    std::vector<std::pair<Eigen::Vector3i, int>> binned_points(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_points; i++) {
+        Eigen::Vector3d ref_coord =
+                (input.points_[i] - voxel_min_bound) / voxel_size;
+        binned_points[i].first =
+                Eigen::floor(ref_coord.array()).cast<int>().matrix();
+        binned_points[i].second = i;
     }
+    utility::ParallelSort(
+            binned_points.begin(), binned_points.end(),
+            [](const std::pair<Eigen::Vector3i, int> &a,
+               const std::pair<Eigen::Vector3i, int> &b) {
+                return LessGridIndex(a.first, b.first);
+            });
+    std::vector<int> run_starts;
+    for (int i = 0; i < num_points; i++) {
+        if (i == 0 || binned_points[i].first != binned_points[i - 1].first) {
+            run_starts.push_back(i);
+        }
+    }
+    const int num_voxels = int(run_starts.size());
+    run_starts.push_back(num_points);
+
     bool has_colors = input.HasColors();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        const Eigen::Vector3i &grid_index =
-                accpoint.second.GetVoxelCoordinate();
-        const Eigen::Vector3d &color =
-                has_colors ? accpoint.second.GetAverageColor()
-                           : Eigen::Vector3d(0, 0, 0);
-        output->voxels_.emplace_back(grid_index, color);
+    output->voxels_.resize(num_voxels);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_voxels; i++) {
+        Eigen::Vector3d color(0, 0, 0);
+        if (has_colors) {
+            for (int j = run_starts[i]; j < run_starts[i + 1]; j++) {
+                color += input.colors_[binned_points[j].second];
+            }
+            color /= double(run_starts[i + 1] - run_starts[i]);
+        }
+        output->voxels_[i] =
+                Voxel(binned_points[run_starts[i]].first, color);
     }
+    output->UpdateVoxelIndex();
     utility::PrintDebug(
             "Pointcloud is voxelized from %d points to %d voxels.\n",
             (int)input.points_.size(), (int)output->voxels_.size());
     return output;
 }
 
+std::shared_ptr<VoxelGrid> CreateSurfaceVoxelGridFromTriangleMesh(
+        const TriangleMesh &input, double voxel_size) {
+    auto output = std::make_shared<VoxelGrid>();
+    if (voxel_size <= 0.0) {
+        utility::PrintDebug("[VoxelGridFromTriangleMesh] voxel_size <= 0.\n");
+        return output;
+    }
+    if (!input.HasTriangles()) {
+        utility::PrintDebug("[VoxelGridFromTriangleMesh] mesh is empty.\n");
+        return output;
+    }
+    Eigen::Vector3d voxel_size3 =
+            Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
+    Eigen::Vector3d voxel_min_bound = input.GetMinBound() - voxel_size3 * 0.5;
+    Eigen::Vector3d voxel_max_bound = input.GetMaxBound() + voxel_size3 * 0.5;
+    if (voxel_size * std::numeric_limits<int>::max() <
+        (voxel_max_bound - voxel_min_bound).maxCoeff()) {
+        utility::PrintDebug(
+                "[VoxelGridFromTriangleMesh] voxel_size is too small.\n");
+        return output;
+    }
+    output->voxel_size_ = voxel_size;
+    output->origin_ = voxel_min_bound;
+    std::vector<Eigen::Vector3i> grid_indices =
+            VoxelizeTriangles(input, voxel_min_bound, voxel_size);
+    output->voxels_.reserve(grid_indices.size());
+    for (const Eigen::Vector3i &grid_index : grid_indices) {
+        output->voxels_.emplace_back(grid_index);
+    }
+    output->UpdateVoxelIndex();
+    utility::PrintDebug(
+            "TriangleMesh is voxelized from %d triangles to %d voxels.\n",
+            (int)input.triangles_.size(), (int)output->voxels_.size());
+    return output;
+}
+
+std::shared_ptr<VoxelGrid> CreateVoxelGridFromTriangleMesh(
+        const TriangleMesh &input, double voxel_size) {
+    auto output = CreateSurfaceVoxelGridFromTriangleMesh(input, voxel_size);
+    if (!output->HasVoxels()) {
+        return output;
+    }
+
+    // Dense occupancy of the bounding grid with one layer of padding, so that
+    // the outside is connected.
+    Eigen::Vector3i min_index = output->voxels_[0].grid_index_;
+    Eigen::Vector3i max_index = output->voxels_[0].grid_index_;
+    for (const Voxel &voxel : output->voxels_) {
+        min_index = min_index.cwiseMin(voxel.grid_index_);
+        max_index = max_index.cwiseMax(voxel.grid_index_);
+    }
+    const Eigen::Vector3i offset = min_index - Eigen::Vector3i::Ones();
+    const Eigen::Matrix<int64_t, 3, 1> dims =
+            (max_index - min_index + Eigen::Vector3i::Constant(3))
+                    .cast<int64_t>();
+    if (dims.prod() > int64_t(std::numeric_limits<int>::max())) {
+        utility::PrintWarning(
+                "[VoxelGridFromTriangleMesh] grid is too large to fill, "
+                "returning the surface voxels.\n");
+        return output;
+    }
+    auto linear_index = [&](const Eigen::Vector3i &cell) {
+        return (int64_t(cell(0)) * dims(1) + cell(1)) * dims(2) + cell(2);
+    };
+    const uint8_t kEmpty = 0, kSurface = 1, kOutside = 2;
+    std::vector<uint8_t> state(dims.prod(), kEmpty);
+    for (const Voxel &voxel : output->voxels_) {
+        state[linear_index(voxel.grid_index_ - offset)] = kSurface;
+    }
+
+    // Flood fill the outside from a padding corner.
+    const Eigen::Vector3i neighbor_offsets[6] = {
+            Eigen::Vector3i(-1, 0, 0), Eigen::Vector3i(1, 0, 0),
+            Eigen::Vector3i(0, -1, 0), Eigen::Vector3i(0, 1, 0),
+            Eigen::Vector3i(0, 0, -1), Eigen::Vector3i(0, 0, 1)};
+    std::vector<Eigen::Vector3i> stack(1, Eigen::Vector3i::Zero());
+    state[0] = kOutside;
+    while (!stack.empty()) {
+        Eigen::Vector3i cell = stack.back();
+        stack.pop_back();
+        for (const Eigen::Vector3i &neighbor_offset : neighbor_offsets) {
+            Eigen::Vector3i neighbor = cell + neighbor_offset;
+            if ((neighbor.array() < 0).any() ||
+                (neighbor.cast<int64_t>().array() >= dims.array()).any()) {
+                continue;
+            }
+            uint8_t &neighbor_state = state[linear_index(neighbor)];
+            if (neighbor_state == kEmpty) {
+                neighbor_state = kOutside;
+                stack.push_back(neighbor);
+            }
+        }
+    }
+
+    // Everything not reached is surface or interior; emit it in grid index
+    // order.
+    output->voxels_.clear();
+    for (int x = 0; x < dims(0); ++x) {
+        for (int y = 0; y < dims(1); ++y) {
+            for (int z = 0; z < dims(2); ++z) {
+                Eigen::Vector3i cell(x, y, z);
+                if (state[linear_index(cell)] != kOutside) {
+                    output->voxels_.emplace_back(cell + offset);
+                }
+            }
+        }
+    }
+    output->UpdateVoxelIndex();
+    return output;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -40,19 +40,29 @@ static const std::unordered_map<
         std::function<bool(const std::string &, geometry::Octree &)>>
         file_extension_to_octree_read_function{
                 {"json", ReadOctreeFromJson},
+                {"bin",
+                 [](const std::string &filename, geometry::Octree &octree) {
+                     return ReadOctreeFromBIN(filename, octree);
+                 }},
         };
 
 static const std::unordered_map<
         std::string,
-        std::function<bool(const std::string &, const geometry::Octree &)>>
+        std::function<bool(
+                const std::string &, const geometry::Octree &, const bool)>>
         file_extension_to_octree_write_function{
-                {"json", WriteOctreeToJson},
+                {"json",
+                 [](const std::string &filename,
+                    const geometry::Octree &octree, const bool compressed) {
+                     return WriteOctreeToJson(filename, octree);
+                 }},
+                {"bin", WriteOctreeToBIN},
         };
 
 std::shared_ptr<geometry::Octree> CreateOctreeFromFile(
         const std::string &filename, const std::string &format) {
     auto octree = std::make_shared<geometry::Octree>();
-    WriteOctree(filename, *octree);
+    ReadOctree(filename, *octree, format);
     return octree;
 }
 
@@ -82,7 +92,9 @@ bool ReadOctree(const std::string &filename,
     return success;
 }
 
-bool WriteOctree(const std::string &filename, const geometry::Octree &octree) {
+bool WriteOctree(const std::string &filename,
+                 const geometry::Octree &octree,
+                 bool compressed) {
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -96,7 +108,7 @@ bool WriteOctree(const std::string &filename, const geometry::Octree &octree) {
                 "Write geometry::Octree failed: unknown file extension.\n");
         return false;
     }
-    bool success = map_itr->second(filename, octree);
+    bool success = map_itr->second(filename, octree, compressed);
     utility::PrintDebug("Write geometry::Octree.\n");
     return success;
 }
@@ -47,15 +47,35 @@ bool ReadOctree(const std::string &filename,
 
 /// The general entrance for writing a Octree to a file
 /// The function calls write functions based on the extension name of filename.
-/// If the write function supports binary encoding and compression, the later
-/// two parameters will be used. Otherwise they will be ignored.
+/// If the write function supports compression, the compressed parameter will
+/// be used. Otherwise it will be ignored.
 /// \return return true if the write function is successful, false otherwise.
-bool WriteOctree(const std::string &filename, const geometry::Octree &octree);
+bool WriteOctree(const std::string &filename,
+                 const geometry::Octree &octree,
+                 bool compressed = false);
 
 bool ReadOctreeFromJson(const std::string &filename, geometry::Octree &octree);
 
 bool WriteOctreeToJson(const std::string &filename,
                        const geometry::Octree &octree);
 
+/// Reads an octree from the binary format written by WriteOctreeToBIN. The file
+/// is read block by block while the tree is built level by level. If max_depth
+/// is non-negative and smaller than the depth of the stored octree, only the
+/// top max_depth levels are read and the nodes at depth max_depth become
+/// OctreeColorLeafNode with the mean color of their subtree.
+bool ReadOctreeFromBIN(const std::string &filename,
+                       geometry::Octree &octree,
+                       int max_depth = -1);
+
+/// Writes an octree in a compact binary format: the tree structure is stored
+/// breadth-first as one child mask byte per internal node, followed by the
+/// packed leaf payloads. With compressed, the stream is lzf compressed in
+/// blocks. Nodes above max_depth must be OctreeInternalNode and nodes at
+/// max_depth OctreeColorLeafNode.
+bool WriteOctreeToBIN(const std::string &filename,
+                      const geometry::Octree &octree,
+                      bool compressed = false);
+
 }  // namespace io
 }  // namespace open3d
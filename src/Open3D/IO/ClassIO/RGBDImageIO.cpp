@@ -0,0 +1,148 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/RGBDImageIO.h"
+
+#include <algorithm>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace io {
+
+std::shared_ptr<geometry::RGBDImage> CreateRGBDImageFromFiles(
+        const std::string &color_filename,
+        const std::string &depth_filename,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 3.0*/,
+        bool convert_rgb_to_intensity /* = true*/) {
+    geometry::Image color, depth;
+    if (!ReadImage(color_filename, color) ||
+        !ReadImage(depth_filename, depth)) {
+        utility::PrintWarning("Read RGBDImage failed: unable to read %s/%s\n",
+                              color_filename.c_str(), depth_filename.c_str());
+        return std::make_shared<geometry::RGBDImage>();
+    }
+    return geometry::CreateRGBDImageFromColorAndDepth(
+            color, depth, depth_scale, depth_trunc, convert_rgb_to_intensity);
+}
+
+RGBDImageSequenceReader::RGBDImageSequenceReader(
+        const std::vector<std::string> &color_filenames,
+        const std::vector<std::string> &depth_filenames,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 3.0*/,
+        bool convert_rgb_to_intensity /* = true*/,
+        int num_of_frames_ahead /* = 8*/,
+        int num_of_threads /* = 0*/)
+    : color_filenames_(color_filenames),
+      depth_filenames_(depth_filenames),
+      depth_scale_(depth_scale),
+      depth_trunc_(depth_trunc),
+      convert_rgb_to_intensity_(convert_rgb_to_intensity),
+      num_of_frames_ahead_(std::max(num_of_frames_ahead, 1)) {
+    if (color_filenames_.size() != depth_filenames_.size()) {
+        utility::PrintWarning(
+                "[RGBDImageSequenceReader] %d color images but %d depth "
+                "images, extra ones are ignored.\n",
+                (int)color_filenames_.size(), (int)depth_filenames_.size());
+        const size_t num_of_frames =
+                std::min(color_filenames_.size(), depth_filenames_.size());
+        color_filenames_.resize(num_of_frames);
+        depth_filenames_.resize(num_of_frames);
+    }
+    if (num_of_threads <= 0) {
+        num_of_threads = std::max((int)std::thread::hardware_concurrency(), 1);
+    }
+    num_of_threads = std::min(num_of_threads, (int)num_of_frames_ahead_);
+    for (int i = 0; i < num_of_threads; i++) {
+        threads_.emplace_back(&RGBDImageSequenceReader::DecodeFrames, this);
+    }
+}
+
+RGBDImageSequenceReader::~RGBDImageSequenceReader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    frame_read_.notify_all();
+    for (auto &thread : threads_) {
+        thread.join();
+    }
+}
+
+bool RGBDImageSequenceReader::HasNext() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return next_frame_to_read_ < GetNumOfFrames();
+}
+
+std::shared_ptr<geometry::RGBDImage> RGBDImageSequenceReader::ReadNext() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (next_frame_to_read_ >= GetNumOfFrames()) {
+        return nullptr;
+    }
+    frame_decoded_.wait(lock, [this] {
+        return frames_.count(next_frame_to_read_) > 0;
+    });
+    auto it = frames_.find(next_frame_to_read_);
+    auto frame = it->second;
+    frames_.erase(it);
+    next_frame_to_read_++;
+    lock.unlock();
+    frame_read_.notify_all();
+    return frame;
+}
+
+void RGBDImageSequenceReader::DecodeFrames() {
+    while (true) {
+        size_t index;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            frame_read_.wait(lock, [this] {
+                return stop_ ||
+                       next_frame_to_decode_ >= GetNumOfFrames() ||
+                       next_frame_to_decode_ <
+                               next_frame_to_read_ + num_of_frames_ahead_;
+            });
+            if (stop_ || next_frame_to_decode_ >= GetNumOfFrames()) {
+                return;
+            }
+            index = next_frame_to_decode_++;
+        }
+        auto frame = CreateRGBDImageFromFiles(
+                color_filenames_[index], depth_filenames_[index], depth_scale_,
+                depth_trunc_, convert_rgb_to_intensity_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            frames_[index] = frame;
+        }
+        frame_decoded_.notify_all();
+    }
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Open3D/Geometry/RGBDImage.h"
+
+namespace open3d {
+namespace io {
+
+/// Factory function to create an RGBDImage from a color and a depth image
+/// file, see geometry::CreateRGBDImageFromColorAndDepth for the parameters.
+/// Return an empty RGBDImage if fail to read the files.
+std::shared_ptr<geometry::RGBDImage> CreateRGBDImageFromFiles(
+        const std::string &color_filename,
+        const std::string &depth_filename,
+        double depth_scale = 1000.0,
+        double depth_trunc = 3.0,
+        bool convert_rgb_to_intensity = true);
+
+/// Reader of a sequence of RGB-D frames that decodes the upcoming frames on
+/// worker threads while the current one is processed.
+///
+/// At most num_of_frames_ahead frames are decoded or waiting beyond the last
+/// one handed out, and ReadNext returns them in order. Frames are typically
+/// listed in the order of a camera::PinholeCameraTrajectory:
+///
+///     RGBDImageSequenceReader reader(color_files, depth_files, 1000.0, 4.0,
+///                                    false);
+///     for (const auto &parameters : trajectory.parameters_) {
+///         auto rgbd = reader.ReadNext();
+///         volume.Integrate(*rgbd, parameters.intrinsic_,
+///                          parameters.extrinsic_);
+///     }
+class RGBDImageSequenceReader {
+public:
+    /// \param num_of_threads is the number of decoding threads, the number of
+    /// hardware threads if 0.
+    RGBDImageSequenceReader(const std::vector<std::string> &color_filenames,
+                            const std::vector<std::string> &depth_filenames,
+                            double depth_scale = 1000.0,
+                            double depth_trunc = 3.0,
+                            bool convert_rgb_to_intensity = true,
+                            int num_of_frames_ahead = 8,
+                            int num_of_threads = 0);
+    ~RGBDImageSequenceReader();
+    RGBDImageSequenceReader(const RGBDImageSequenceReader &) = delete;
+    RGBDImageSequenceReader &operator=(const RGBDImageSequenceReader &) =
+            delete;
+
+public:
+    size_t GetNumOfFrames() const { return color_filenames_.size(); }
+    bool HasNext() const;
+
+    /// Function to get the next frame, waiting for it to be decoded.
+    /// \return an empty RGBDImage if the frame fails to read, and nullptr
+    /// past the last frame.
+    std::shared_ptr<geometry::RGBDImage> ReadNext();
+
+private:
+    void DecodeFrames();
+
+private:
+    std::vector<std::string> color_filenames_;
+    std::vector<std::string> depth_filenames_;
+    double depth_scale_;
+    double depth_trunc_;
+    bool convert_rgb_to_intensity_;
+    size_t num_of_frames_ahead_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable frame_decoded_;
+    std::condition_variable frame_read_;
+    /// Decoded frames not handed out yet, by index.
+    std::map<size_t, std::shared_ptr<geometry::RGBDImage>> frames_;
+    size_t next_frame_to_decode_ = 0;
+    size_t next_frame_to_read_ = 0;
+    bool stop_ = false;
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace io
+}  // namespace open3d
@@ -62,6 +62,23 @@ bool WriteTriangleMeshToPLY(const std::string &filename,
                             bool write_ascii = false,
                             bool compressed = false);
 
+/// Out-of-core version of geometry::SimplifyVertexClustering. The PLY file
+/// \param input_filename is streamed and only the per-voxel aggregates and a
+/// cluster index per input vertex are kept in memory, the input triangles are
+/// never stored. For the Quadric contraction the vertex positions are
+/// additionally kept in single precision. The voxel grid is anchored at the
+/// coordinate origin. The simplified mesh is written to \param
+/// output_filename (any format supported by WriteTriangleMesh).
+/// \return return true if reading and writing were successful.
+bool SimplifyVertexClusteringFromPLY(
+        const std::string &input_filename,
+        const std::string &output_filename,
+        double voxel_size,
+        geometry::TriangleMesh::SimplificationContraction contraction =
+                geometry::TriangleMesh::SimplificationContraction::Average,
+        bool write_ascii = false,
+        bool compressed = false);
+
 bool ReadTriangleMeshFromSTL(const std::string &filename,
                              geometry::TriangleMesh &mesh);
 
@@ -24,10 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <liblzf/lzf.h>
+#include <algorithm>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <memory>
 
 #include "Open3D/IO/ClassIO/FeatureIO.h"
+#include "Open3D/IO/ClassIO/OctreeIO.h"
 #include "Open3D/Utility/Console.h"
 
 namespace open3d {
@@ -71,6 +76,412 @@ bool WriteMatrixXdToBINFile(FILE *file, const Eigen::MatrixXd &mat) {
     return true;
 }
 
+/// Binary octree format, all values in native byte order:
+///
+/// OctreeBINHeader, followed by a stream of blocks, each being
+/// (uint32_t raw_size, uint32_t stored_size, bytes). A block is lzf compressed
+/// iff stored_size < raw_size. The uncompressed stream stores the tree
+/// breadth-first. For each depth d < max_depth, with N_d nodes at depth d
+/// (N_0 = 1):
+///   N_d child mask bytes, bit i set iff child i exists,
+///   N_d mean colors of the subtrees as 3 uint8_t each.
+/// The N_max_depth leaves follow, each as 3 doubles for the color and, if
+/// kOctreeBINPointLeaves is set, a uint32_t point count followed by the
+/// uint64_t point indices and the points as 3 doubles each.
+/// Since the levels come in order, a reader can stop after any depth.
+struct OctreeBINHeader {
+    char magic_[4];
+    uint32_t version_;
+    uint32_t flags_;
+    uint32_t max_depth_;
+    double origin_[3];
+    double size_;
+};
+
+const char kOctreeBINMagic[4] = {'O', '3', 'O', 'T'};
+const uint32_t kOctreeBINVersion = 1;
+const uint32_t kOctreeBINHasRoot = 1;
+const uint32_t kOctreeBINPointLeaves = 2;
+const size_t kOctreeBINBlockSize = 1 << 20;
+/// An lzf back reference expands 3 bytes into at most 264 bytes
+const uint64_t kLzfMaxExpansion = 88;
+
+class OctreeBINWriter {
+public:
+    OctreeBINWriter(FILE *file, bool compressed)
+        : file_(file), compressed_(compressed) {
+        buffer_.reserve(kOctreeBINBlockSize);
+    }
+
+    bool Write(const void *data, size_t size) {
+        const char *bytes = static_cast<const char *>(data);
+        while (size > 0) {
+            size_t n = std::min(size, kOctreeBINBlockSize - buffer_.size());
+            buffer_.insert(buffer_.end(), bytes, bytes + n);
+            bytes += n;
+            size -= n;
+            if (buffer_.size() == kOctreeBINBlockSize && !Flush()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Flush() {
+        if (buffer_.empty()) {
+            return true;
+        }
+        uint32_t raw_size = uint32_t(buffer_.size());
+        uint32_t stored_size = 0;
+        if (compressed_) {
+            compressed_buffer_.resize(buffer_.size());
+            // lzf_compress returns 0 if the output does not fit, in which case
+            // the block is stored uncompressed
+            stored_size = lzf_compress(buffer_.data(), raw_size,
+                                       compressed_buffer_.data(), raw_size - 1);
+        }
+        const char *stored = compressed_buffer_.data();
+        if (stored_size == 0) {
+            stored_size = raw_size;
+            stored = buffer_.data();
+        }
+        bool success = fwrite(&raw_size, sizeof(uint32_t), 1, file_) == 1 &&
+                       fwrite(&stored_size, sizeof(uint32_t), 1, file_) == 1 &&
+                       fwrite(stored, 1, stored_size, file_) == stored_size;
+        buffer_.clear();
+        return success;
+    }
+
+private:
+    FILE *file_;
+    bool compressed_;
+    std::vector<char> buffer_;
+    std::vector<char> compressed_buffer_;
+};
+
+class OctreeBINReader {
+public:
+    explicit OctreeBINReader(FILE *file) : file_(file) {
+        long position = ftell(file_);
+        if (position >= 0 && fseek(file_, 0, SEEK_END) == 0) {
+            file_end_ = ftell(file_);
+            fseek(file_, position, SEEK_SET);
+        }
+    }
+
+    /// Returns false if the rest of the file cannot hold \param size bytes
+    /// of the stream, so that sizes read from a corrupt file are rejected
+    /// before anything is allocated for them.
+    bool CanRead(uint64_t size) const {
+        long position = ftell(file_);
+        uint64_t file_left =
+                position >= 0 && file_end_ > position
+                        ? uint64_t(file_end_ - position)
+                        : 0;
+        return size <= uint64_t(buffer_.size() - position_) +
+                               file_left * kLzfMaxExpansion;
+    }
+
+    bool Read(void *data, size_t size) {
+        char *bytes = static_cast<char *>(data);
+        while (size > 0) {
+            if (position_ == buffer_.size() && !ReadBlock()) {
+                return false;
+            }
+            size_t n = std::min(size, buffer_.size() - position_);
+            memcpy(bytes, buffer_.data() + position_, n);
+            position_ += n;
+            bytes += n;
+            size -= n;
+        }
+        return true;
+    }
+
+private:
+    bool ReadBlock() {
+        uint32_t raw_size, stored_size;
+        if (fread(&raw_size, sizeof(uint32_t), 1, file_) < 1 ||
+            fread(&stored_size, sizeof(uint32_t), 1, file_) < 1 ||
+            raw_size == 0 || raw_size > kOctreeBINBlockSize ||
+            stored_size > raw_size) {
+            return false;
+        }
+        buffer_.resize(raw_size);
+        position_ = 0;
+        if (stored_size == raw_size) {
+            return fread(buffer_.data(), 1, raw_size, file_) == raw_size;
+        }
+        compressed_buffer_.resize(stored_size);
+        return fread(compressed_buffer_.data(), 1, stored_size, file_) ==
+                       stored_size &&
+               lzf_decompress(compressed_buffer_.data(), stored_size,
+                              buffer_.data(), raw_size) == raw_size;
+    }
+
+    FILE *file_;
+    long file_end_ = 0;
+    std::vector<char> buffer_;
+    std::vector<char> compressed_buffer_;
+    size_t position_ = 0;
+};
+
+bool WriteOctreeToBINFile(FILE *file,
+                          const geometry::Octree &octree,
+                          bool compressed) {
+    OctreeBINHeader header;
+    memcpy(header.magic_, kOctreeBINMagic, sizeof(header.magic_));
+    header.version_ = kOctreeBINVersion;
+    header.flags_ = 0;
+    header.max_depth_ = uint32_t(octree.max_depth_);
+    for (int i = 0; i < 3; ++i) {
+        header.origin_[i] = octree.origin_(i);
+    }
+    header.size_ = octree.size_;
+
+    // Collect the nodes level by level, with the index of their parent in
+    // the previous level
+    std::vector<std::vector<const geometry::OctreeNode *>> levels;
+    std::vector<std::vector<size_t>> parents;
+    if (octree.root_node_ != nullptr) {
+        header.flags_ |= kOctreeBINHasRoot;
+        levels.push_back({octree.root_node_.get()});
+        parents.push_back({0});
+    }
+    for (size_t depth = 0; depth < levels.size() && depth < octree.max_depth_;
+         ++depth) {
+        std::vector<const geometry::OctreeNode *> next_level;
+        std::vector<size_t> next_parents;
+        for (size_t i = 0; i < levels[depth].size(); ++i) {
+            auto internal_node =
+                    dynamic_cast<const geometry::OctreeInternalNode *>(
+                            levels[depth][i]);
+            if (internal_node == nullptr) {
+                utility::PrintWarning(
+                        "Write BIN failed: leaf node above max_depth.\n");
+                return false;
+            }
+            for (const auto &child : internal_node->children_) {
+                if (child != nullptr) {
+                    next_level.push_back(child.get());
+                    next_parents.push_back(i);
+                }
+            }
+        }
+        levels.push_back(std::move(next_level));
+        parents.push_back(std::move(next_parents));
+    }
+
+    std::vector<const geometry::OctreeColorLeafNode *> leaves;
+    bool point_leaves = !levels.empty();
+    if (!levels.empty()) {
+        for (const geometry::OctreeNode *node : levels.back()) {
+            auto leaf_node =
+                    dynamic_cast<const geometry::OctreeColorLeafNode *>(node);
+            if (leaf_node == nullptr) {
+                utility::PrintWarning(
+                        "Write BIN failed: nodes at max_depth must be "
+                        "OctreeColorLeafNode.\n");
+                return false;
+            }
+            leaves.push_back(leaf_node);
+            point_leaves =
+                    point_leaves &&
+                    dynamic_cast<const geometry::OctreePointColorLeafNode *>(
+                            node) != nullptr;
+        }
+    }
+    if (point_leaves) {
+        header.flags_ |= kOctreeBINPointLeaves;
+    }
+    if (fwrite(&header, sizeof(OctreeBINHeader), 1, file) < 1) {
+        utility::PrintWarning("Write BIN failed: unexpected error.\n");
+        return false;
+    }
+
+    // Mean leaf colors of the subtrees, computed bottom-up
+    std::vector<std::vector<Eigen::Vector3d>> color_sums(levels.size());
+    std::vector<std::vector<size_t>> leaf_counts(levels.size());
+    for (size_t depth = levels.size(); depth-- > 0;) {
+        color_sums[depth].resize(levels[depth].size(), Eigen::Vector3d::Zero());
+        leaf_counts[depth].resize(levels[depth].size(), 0);
+        if (depth + 1 == levels.size()) {
+            for (size_t i = 0; i < leaves.size(); ++i) {
+                color_sums[depth][i] = leaves[i]->color_;
+                leaf_counts[depth][i] = 1;
+            }
+        } else {
+            for (size_t i = 0; i < levels[depth + 1].size(); ++i) {
+                size_t parent = parents[depth + 1][i];
+                color_sums[depth][parent] += color_sums[depth + 1][i];
+                leaf_counts[depth][parent] += leaf_counts[depth + 1][i];
+            }
+        }
+    }
+
+    OctreeBINWriter writer(file, compressed);
+    bool success = true;
+    for (size_t depth = 0; depth + 1 < levels.size(); ++depth) {
+        const auto &level = levels[depth];
+        std::vector<uint8_t> masks(level.size(), 0);
+        std::vector<uint8_t> colors(level.size() * 3);
+        for (size_t i = 0; i < level.size(); ++i) {
+            auto internal_node =
+                    static_cast<const geometry::OctreeInternalNode *>(level[i]);
+            for (size_t cid = 0; cid < 8; ++cid) {
+                if (internal_node->children_[cid] != nullptr) {
+                    masks[i] |= uint8_t(1 << cid);
+                }
+            }
+            // Internal nodes without leaves are stored black
+            Eigen::Vector3d mean_color = Eigen::Vector3d::Zero();
+            if (leaf_counts[depth][i] > 0) {
+                mean_color =
+                        color_sums[depth][i] / double(leaf_counts[depth][i]);
+            }
+            for (int c = 0; c < 3; ++c) {
+                double value = std::min(std::max(mean_color(c), 0.0), 1.0);
+                colors[i * 3 + c] = uint8_t(value * 255.0 + 0.5);
+            }
+        }
+        success = success && writer.Write(masks.data(), masks.size()) &&
+                  writer.Write(colors.data(), colors.size());
+    }
+    for (const geometry::OctreeColorLeafNode *leaf_node : leaves) {
+        success = success && writer.Write(leaf_node->color_.data(),
+                                          3 * sizeof(double));
+        if (point_leaves) {
+            auto point_leaf_node =
+                    static_cast<const geometry::OctreePointColorLeafNode *>(
+                            leaf_node);
+            uint32_t num_points = uint32_t(point_leaf_node->indices_.size());
+            std::vector<uint64_t> indices(point_leaf_node->indices_.begin(),
+                                          point_leaf_node->indices_.end());
+            // std::vector<Eigen::Vector3d> stores its points as contiguous
+            // doubles
+            success = success &&
+                      writer.Write(&num_points, sizeof(uint32_t)) &&
+                      writer.Write(indices.data(),
+                                   num_points * sizeof(uint64_t)) &&
+                      writer.Write(point_leaf_node->points_.data(),
+                                   num_points * 3 * sizeof(double));
+        }
+    }
+    success = success && writer.Flush();
+    if (!success) {
+        utility::PrintWarning("Write BIN failed: unexpected error.\n");
+    }
+    return success;
+}
+
+bool ReadOctreeFromBINFile(FILE *file,
+                           geometry::Octree &octree,
+                           int max_depth) {
+    OctreeBINHeader header;
+    if (fread(&header, sizeof(OctreeBINHeader), 1, file) < 1) {
+        utility::PrintWarning("Read BIN failed: unexpected EOF.\n");
+        return false;
+    }
+    if (memcmp(header.magic_, kOctreeBINMagic, sizeof(header.magic_)) != 0 ||
+        header.version_ != kOctreeBINVersion) {
+        utility::PrintWarning("Read BIN failed: not an octree file.\n");
+        return false;
+    }
+    octree.Clear();
+    octree.origin_ = Eigen::Vector3d(header.origin_[0], header.origin_[1],
+                                     header.origin_[2]);
+    octree.size_ = header.size_;
+    octree.max_depth_ = header.max_depth_;
+    if (max_depth >= 0 && size_t(max_depth) < octree.max_depth_) {
+        octree.max_depth_ = size_t(max_depth);
+    }
+    if ((header.flags_ & kOctreeBINHasRoot) == 0) {
+        return true;
+    }
+
+    // Slots of the nodes of the current level, filled while reading it
+    OctreeBINReader reader(file);
+    std::vector<std::shared_ptr<geometry::OctreeNode> *> slots{
+            &octree.root_node_};
+    for (size_t depth = 0; depth < octree.max_depth_; ++depth) {
+        std::vector<uint8_t> masks(slots.size());
+        std::vector<uint8_t> colors(slots.size() * 3);
+        if (!reader.Read(masks.data(), masks.size()) ||
+            !reader.Read(colors.data(), colors.size())) {
+            utility::PrintWarning("Read BIN failed: unexpected EOF.\n");
+            octree.root_node_ = nullptr;
+            return false;
+        }
+        std::vector<std::shared_ptr<geometry::OctreeNode> *> next_slots;
+        for (size_t i = 0; i < slots.size(); ++i) {
+            auto internal_node =
+                    std::make_shared<geometry::OctreeInternalNode>();
+            for (size_t cid = 0; cid < 8; ++cid) {
+                if (masks[i] & (1 << cid)) {
+                    next_slots.push_back(&internal_node->children_[cid]);
+                }
+            }
+            *slots[i] = internal_node;
+        }
+        slots = std::move(next_slots);
+    }
+
+    if (octree.max_depth_ < header.max_depth_) {
+        // Truncated tree, the nodes at max_depth get their subtree's mean color
+        std::vector<uint8_t> masks(slots.size());
+        std::vector<uint8_t> colors(slots.size() * 3);
+        if (!reader.Read(masks.data(), masks.size()) ||
+            !reader.Read(colors.data(), colors.size())) {
+            utility::PrintWarning("Read BIN failed: unexpected EOF.\n");
+            octree.root_node_ = nullptr;
+            return false;
+        }
+        for (size_t i = 0; i < slots.size(); ++i) {
+            auto leaf_node = std::make_shared<geometry::OctreeColorLeafNode>();
+            leaf_node->color_ =
+                    Eigen::Vector3d(colors[i * 3], colors[i * 3 + 1],
+                                    colors[i * 3 + 2]) /
+                    255.0;
+            *slots[i] = leaf_node;
+        }
+        return true;
+    }
+
+    bool point_leaves = (header.flags_ & kOctreeBINPointLeaves) != 0;
+    for (size_t i = 0; i < slots.size(); ++i) {
+        std::shared_ptr<geometry::OctreeColorLeafNode> leaf_node;
+        bool success = true;
+        if (point_leaves) {
+            auto point_leaf_node =
+                    std::make_shared<geometry::OctreePointColorLeafNode>();
+            success = reader.Read(point_leaf_node->color_.data(),
+                                  3 * sizeof(double));
+            uint32_t num_points = 0;
+            success = success && reader.Read(&num_points, sizeof(uint32_t)) &&
+                      reader.CanRead(uint64_t(num_points) *
+                                     (sizeof(uint64_t) + 3 * sizeof(double)));
+            std::vector<uint64_t> indices(success ? num_points : 0);
+            point_leaf_node->points_.resize(indices.size());
+            success = success &&
+                      reader.Read(indices.data(),
+                                  indices.size() * sizeof(uint64_t)) &&
+                      reader.Read(point_leaf_node->points_.data(),
+                                  indices.size() * 3 * sizeof(double));
+            point_leaf_node->indices_.assign(indices.begin(), indices.end());
+            leaf_node = point_leaf_node;
+        } else {
+            leaf_node = std::make_shared<geometry::OctreeColorLeafNode>();
+            success = reader.Read(leaf_node->color_.data(), 3 * sizeof(double));
+        }
+        if (!success) {
+            utility::PrintWarning("Read BIN failed: unexpected EOF.\n");
+            octree.root_node_ = nullptr;
+            return false;
+        }
+        *slots[i] = leaf_node;
+    }
+    return true;
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -101,5 +512,33 @@ bool WriteFeatureToBIN(const std::string &filename,
     return success;
 }
 
+bool ReadOctreeFromBIN(const std::string &filename,
+                       geometry::Octree &octree,
+                       int max_depth) {
+    FILE *fid = fopen(filename.c_str(), "rb");
+    if (fid == NULL) {
+        utility::PrintWarning("Read BIN failed: unable to open file: %s\n",
+                              filename.c_str());
+        return false;
+    }
+    bool success = ReadOctreeFromBINFile(fid, octree, max_depth);
+    fclose(fid);
+    return success;
+}
+
+bool WriteOctreeToBIN(const std::string &filename,
+                      const geometry::Octree &octree,
+                      bool compressed) {
+    FILE *fid = fopen(filename.c_str(), "wb");
+    if (fid == NULL) {
+        utility::PrintWarning("Write BIN failed: unable to open file: %s\n",
+                              filename.c_str());
+        return false;
+    }
+    bool success = WriteOctreeToBINFile(fid, octree, compressed);
+    fclose(fid);
+    return success;
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -196,6 +196,109 @@ int ReadFaceCallBack(p_ply_argument argument) {
 
 }  // namespace ply_trianglemesh_reader
 
+namespace ply_trianglemesh_simplifier {
+
+struct PLYSimplifierState {
+    geometry::VertexClusteringSimplifier *simplifier_ptr;
+    bool keep_vertices;
+    std::vector<int> vertex_to_cluster;
+    std::vector<Eigen::Vector3f> vertices;
+    long vertex_index;
+    long vertex_num;
+    Eigen::Vector3d vertex;
+    Eigen::Vector3d normal;
+    Eigen::Vector3d color;
+    long triangle_index;
+    long triangle_num;
+    Eigen::Vector3i triangle;
+};
+
+void FlushVertex(PLYSimplifierState *state_ptr) {
+    if (state_ptr->vertex_index < 0) {
+        return;
+    }
+    state_ptr->vertex_to_cluster[state_ptr->vertex_index] =
+            state_ptr->simplifier_ptr->AddVertex(
+                    state_ptr->vertex, state_ptr->normal, state_ptr->color);
+    if (state_ptr->keep_vertices) {
+        state_ptr->vertices[state_ptr->vertex_index] =
+                state_ptr->vertex.cast<float>();
+    }
+    state_ptr->vertex_index = -1;
+    utility::AdvanceConsoleProgress();
+}
+
+// The properties of a vertex arrive one by one, a vertex is only handed to
+// the simplifier once the first property of the next vertex (or the first
+// face) is read. index 0-2: xyz, 3-5: normal, 6-8: color.
+int ReadVertexCallback(p_ply_argument argument) {
+    PLYSimplifierState *state_ptr;
+    long index, instance;
+    ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
+                               &index);
+    ply_get_argument_element(argument, NULL, &instance);
+    if (instance >= state_ptr->vertex_num) {
+        return 0;
+    }
+    if (instance != state_ptr->vertex_index) {
+        FlushVertex(state_ptr);
+        state_ptr->vertex_index = instance;
+    }
+
+    double value = ply_get_argument_value(argument);
+    if (index < 3) {
+        state_ptr->vertex(index) = value;
+    } else if (index < 6) {
+        state_ptr->normal(index - 3) = value;
+    } else {
+        state_ptr->color(index - 6) = value / 255.0;
+    }
+    return 1;
+}
+
+int ReadFaceCallBack(p_ply_argument argument) {
+    PLYSimplifierState *state_ptr;
+    long dummy, length, index;
+    ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
+                               &dummy);
+    FlushVertex(state_ptr);
+    double value = ply_get_argument_value(argument);
+    if (state_ptr->triangle_index >= state_ptr->triangle_num) {
+        return 0;
+    }
+
+    ply_get_argument_property(argument, NULL, &length, &index);
+    if ((index >= 0) && (index <= 2)) {
+        int vidx = static_cast<int>(value);
+        if (vidx < 0 || vidx >= state_ptr->vertex_num) {
+            return 0;
+        }
+        state_ptr->triangle(index) = vidx;
+    }
+    if (index == 2) {  // reading 'triangles_[n](2)'
+        const auto &triangle = state_ptr->triangle;
+        Eigen::Vector3i clusters(state_ptr->vertex_to_cluster[triangle(0)],
+                                 state_ptr->vertex_to_cluster[triangle(1)],
+                                 state_ptr->vertex_to_cluster[triangle(2)]);
+        if (state_ptr->keep_vertices) {
+            const auto &vertices = state_ptr->vertices;
+            state_ptr->simplifier_ptr->AddTriangle(
+                    clusters, vertices[triangle(0)].cast<double>(),
+                    vertices[triangle(1)].cast<double>(),
+                    vertices[triangle(2)].cast<double>());
+        } else {
+            state_ptr->simplifier_ptr->AddTriangle(
+                    clusters, Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero(),
+                    Eigen::Vector3d::Zero());
+        }
+        state_ptr->triangle_index++;
+        utility::AdvanceConsoleProgress();
+    }
+    return 1;
+}
+
+}  // namespace ply_trianglemesh_simplifier
+
 namespace ply_lineset_reader {
 
 struct PLYReaderState {
@@ -620,6 +723,100 @@ bool WriteTriangleMeshToPLY(const std::string &filename,
     return true;
 }
 
+bool SimplifyVertexClusteringFromPLY(
+        const std::string &input_filename,
+        const std::string &output_filename,
+        double voxel_size,
+        geometry::TriangleMesh::SimplificationContraction
+                contraction /* = SimplificationContraction::Average */,
+        bool write_ascii /* = false*/,
+        bool compressed /* = false*/) {
+    using namespace ply_trianglemesh_simplifier;
+
+    if (voxel_size <= 0.0) {
+        utility::PrintWarning("Simplify PLY failed: voxel_size <= 0.\n");
+        return false;
+    }
+
+    p_ply ply_file = ply_open(input_filename.c_str(), NULL, 0, NULL);
+    if (!ply_file) {
+        utility::PrintWarning("Read PLY failed: unable to open file: %s\n",
+                              input_filename.c_str());
+        return false;
+    }
+    if (!ply_read_header(ply_file)) {
+        utility::PrintWarning("Read PLY failed: unable to parse header.\n");
+        ply_close(ply_file);
+        return false;
+    }
+
+    PLYSimplifierState state;
+    state.vertex_num = ply_set_read_cb(ply_file, "vertex", "x",
+                                       ReadVertexCallback, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "y", ReadVertexCallback, &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "z", ReadVertexCallback, &state, 2);
+
+    long normal_num = ply_set_read_cb(ply_file, "vertex", "nx",
+                                      ReadVertexCallback, &state, 3);
+    ply_set_read_cb(ply_file, "vertex", "ny", ReadVertexCallback, &state, 4);
+    ply_set_read_cb(ply_file, "vertex", "nz", ReadVertexCallback, &state, 5);
+
+    long color_num = ply_set_read_cb(ply_file, "vertex", "red",
+                                     ReadVertexCallback, &state, 6);
+    ply_set_read_cb(ply_file, "vertex", "green", ReadVertexCallback, &state,
+                    7);
+    ply_set_read_cb(ply_file, "vertex", "blue", ReadVertexCallback, &state, 8);
+
+    if (state.vertex_num <= 0) {
+        utility::PrintWarning("Read PLY failed: number of vertex <= 0.\n");
+        ply_close(ply_file);
+        return false;
+    }
+
+    state.triangle_num = ply_set_read_cb(ply_file, "face", "vertex_indices",
+                                         ReadFaceCallBack, &state, 0);
+    if (state.triangle_num == 0) {
+        state.triangle_num = ply_set_read_cb(ply_file, "face", "vertex_index",
+                                             ReadFaceCallBack, &state, 0);
+    }
+
+    geometry::VertexClusteringSimplifier simplifier(
+            voxel_size, Eigen::Vector3d::Zero(), contraction, normal_num > 0,
+            color_num > 0);
+    state.simplifier_ptr = &simplifier;
+    state.keep_vertices =
+            contraction ==
+            geometry::TriangleMesh::SimplificationContraction::Quadric;
+    state.vertex_to_cluster.resize(state.vertex_num);
+    if (state.keep_vertices) {
+        state.vertices.resize(state.vertex_num);
+    }
+    state.vertex_index = -1;
+    state.vertex.setZero();
+    state.normal.setZero();
+    state.color.setZero();
+    state.triangle_index = 0;
+
+    utility::ResetConsoleProgress(state.vertex_num + state.triangle_num,
+                                  "Simplifying PLY: ");
+
+    if (!ply_read(ply_file)) {
+        utility::PrintWarning("Read PLY failed: unable to read file: %s\n",
+                              input_filename.c_str());
+        ply_close(ply_file);
+        return false;
+    }
+    ply_close(ply_file);
+    FlushVertex(&state);
+
+    // Release the per input vertex data before assembling the output
+    std::vector<int>().swap(state.vertex_to_cluster);
+    std::vector<Eigen::Vector3f>().swap(state.vertices);
+
+    auto mesh = simplifier.GetSimplifiedMesh();
+    return WriteTriangleMesh(output_filename, *mesh, write_ascii, compressed);
+}
+
 bool ReadLineSetFromPLY(const std::string &filename,
                         geometry::LineSet &lineset) {
     using namespace ply_lineset_reader;
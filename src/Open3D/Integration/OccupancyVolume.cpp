@@ -0,0 +1,336 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Integration/OccupancyVolume.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+namespace {
+
+float ProbabilityToLogOdds(double probability) {
+    return float(std::log(probability / (1.0 - probability)));
+}
+
+double LogOddsToProbability(float log_odds) {
+    return 1.0 - 1.0 / (1.0 + std::exp(double(log_odds)));
+}
+
+bool LessVoxelIndex(const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+    return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                        b.data() + 3);
+}
+
+/// Voxel coordinates have to lie in [-kMaxVoxelCoordinate,
+/// kMaxVoxelCoordinate) to be packed; others would alias other voxels.
+const int kMaxVoxelCoordinate = 1 << 20;
+
+bool IsPackableVoxelPoint(const Eigen::Vector3d &point) {
+    return (point.array() >= -kMaxVoxelCoordinate).all() &&
+           (point.array() < kMaxVoxelCoordinate).all();
+}
+
+/// Packs a voxel index with coordinates in [-2^20, 2^20) into 63 bits.
+uint64_t PackVoxelIndex(const Eigen::Vector3i &index) {
+    const uint64_t mask = (uint64_t(1) << 21) - 1;
+    return (uint64_t(index(0) + (1 << 20)) & mask) |
+           ((uint64_t(index(1) + (1 << 20)) & mask) << 21) |
+           ((uint64_t(index(2) + (1 << 20)) & mask) << 42);
+}
+
+Eigen::Vector3i UnpackVoxelIndex(uint64_t key) {
+    const uint64_t mask = (uint64_t(1) << 21) - 1;
+    return Eigen::Vector3i(int(key & mask) - (1 << 20),
+                           int((key >> 21) & mask) - (1 << 20),
+                           int((key >> 42) & mask) - (1 << 20));
+}
+
+const uint64_t kEmptyVoxelKey = ~uint64_t(0);
+
+/// Open addressing hash set of packed voxel indices, used to collect the
+/// voxels touched by the rays of one image without duplicates.
+class VoxelKeySet {
+public:
+    VoxelKeySet() : table_(size_t(1) << 12, kEmptyVoxelKey) {}
+
+    bool Insert(uint64_t key) {
+        if (2 * (keys_.size() + 1) > table_.size()) {
+            Grow();
+        }
+        const size_t mask = table_.size() - 1;
+        for (size_t slot = Hash(key) & mask;; slot = (slot + 1) & mask) {
+            if (table_[slot] == key) {
+                return false;
+            }
+            if (table_[slot] == kEmptyVoxelKey) {
+                table_[slot] = key;
+                keys_.push_back(key);
+                return true;
+            }
+        }
+    }
+
+    bool Contains(uint64_t key) const {
+        const size_t mask = table_.size() - 1;
+        for (size_t slot = Hash(key) & mask;; slot = (slot + 1) & mask) {
+            if (table_[slot] == key) {
+                return true;
+            }
+            if (table_[slot] == kEmptyVoxelKey) {
+                return false;
+            }
+        }
+    }
+
+    const std::vector<uint64_t> &Keys() const { return keys_; }
+
+private:
+    static size_t Hash(uint64_t key) {
+        key *= 0x9E3779B97F4A7C15ULL;
+        return size_t(key ^ (key >> 32));
+    }
+
+    void Grow() {
+        table_.assign(table_.size() * 2, kEmptyVoxelKey);
+        const size_t mask = table_.size() - 1;
+        for (uint64_t key : keys_) {
+            size_t slot = Hash(key) & mask;
+            while (table_[slot] != kEmptyVoxelKey) {
+                slot = (slot + 1) & mask;
+            }
+            table_[slot] = key;
+        }
+    }
+
+    std::vector<uint64_t> table_;
+    std::vector<uint64_t> keys_;
+};
+
+/// Appends the voxels crossed by the segment from start to end, both given in
+/// voxel units, excluding the voxel containing end (Amanatides and Woo, "A
+/// Fast Voxel Traversal Algorithm for Ray Tracing").
+void TraverseRay(const Eigen::Vector3d &start,
+                 const Eigen::Vector3d &end,
+                 VoxelKeySet &cells) {
+    Eigen::Vector3i current = Eigen::floor(start.array()).cast<int>();
+    const Eigen::Vector3i last = Eigen::floor(end.array()).cast<int>();
+    const Eigen::Vector3d direction = end - start;
+    Eigen::Vector3i step;
+    Eigen::Vector3d t_max;
+    Eigen::Vector3d t_delta;
+    for (int i = 0; i < 3; i++) {
+        if (direction(i) > 0) {
+            step(i) = 1;
+            t_delta(i) = 1.0 / direction(i);
+            t_max(i) = (current(i) + 1 - start(i)) * t_delta(i);
+        } else if (direction(i) < 0) {
+            step(i) = -1;
+            t_delta(i) = -1.0 / direction(i);
+            t_max(i) = (start(i) - current(i)) * t_delta(i);
+        } else {
+            step(i) = 0;
+            t_delta(i) = std::numeric_limits<double>::infinity();
+            t_max(i) = std::numeric_limits<double>::infinity();
+        }
+    }
+    const int num_steps = (last - current).cwiseAbs().sum();
+    for (int k = 0; k < num_steps; k++) {
+        cells.Insert(PackVoxelIndex(current));
+        int axis;
+        t_max.minCoeff(&axis);
+        current(axis) += step(axis);
+        t_max(axis) += t_delta(axis);
+    }
+}
+
+}  // unnamed namespace
+
+namespace integration {
+
+OccupancyVolume::OccupancyVolume(double voxel_length,
+                                 double max_range,
+                                 double prob_hit,
+                                 double prob_miss,
+                                 double prob_min,
+                                 double prob_max,
+                                 int depth_sampling_stride)
+    : voxel_length_(voxel_length),
+      max_range_(max_range),
+      log_odds_hit_(ProbabilityToLogOdds(prob_hit)),
+      log_odds_miss_(ProbabilityToLogOdds(prob_miss)),
+      log_odds_min_(ProbabilityToLogOdds(prob_min)),
+      log_odds_max_(ProbabilityToLogOdds(prob_max)),
+      depth_sampling_stride_(depth_sampling_stride) {}
+
+void OccupancyVolume::Reset() { log_odds_.clear(); }
+
+void OccupancyVolume::Integrate(const geometry::Image &depth,
+                                const camera::PinholeCameraIntrinsic &intrinsic,
+                                const Eigen::Matrix4d &extrinsic) {
+    if (depth.num_of_channels_ != 1 || depth.bytes_per_channel_ != 4 ||
+        depth.width_ != intrinsic.width_ ||
+        depth.height_ != intrinsic.height_) {
+        utility::PrintWarning(
+                "[OccupancyVolume::Integrate] Unsupported image format.\n");
+        return;
+    }
+    const double fx = intrinsic.GetFocalLength().first;
+    const double fy = intrinsic.GetFocalLength().second;
+    const double cx = intrinsic.GetPrincipalPoint().first;
+    const double cy = intrinsic.GetPrincipalPoint().second;
+    const Eigen::Matrix4d camera_to_world = extrinsic.inverse();
+    const Eigen::Matrix3d rotation = camera_to_world.block<3, 3>(0, 0);
+    const Eigen::Vector3d ray_origin =
+            camera_to_world.block<3, 1>(0, 3) / voxel_length_;
+    const int stride = std::max(depth_sampling_stride_, 1);
+    const int num_rows = (depth.height_ + stride - 1) / stride;
+    if (!IsPackableVoxelPoint(ray_origin)) {
+        utility::PrintWarning(
+                "[OccupancyVolume::Integrate] Camera center is out of the "
+                "volume range.\n");
+        return;
+    }
+
+    // Every thread traverses its rays into its own voxel sets, which are
+    // merged into the map afterwards so that each voxel is updated once.
+    int num_threads = 1;
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+    std::vector<VoxelKeySet> thread_free(num_threads);
+    std::vector<VoxelKeySet> thread_hit(num_threads);
+    bool range_warning = false;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads) reduction(|| : range_warning)
+    {
+#endif
+        int thread_num = 0;
+#ifdef _OPENMP
+        thread_num = omp_get_thread_num();
+#endif
+        VoxelKeySet &free_cells = thread_free[thread_num];
+        VoxelKeySet &hit_cells = thread_hit[thread_num];
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int row = 0; row < num_rows; row++) {
+            const int v = row * stride;
+            for (int u = 0; u < depth.width_; u += stride) {
+                const float d = *geometry::PointerAt<float>(depth, u, v);
+                if (!(d > 0)) {
+                    continue;
+                }
+                Eigen::Vector3d direction((u - cx) / fx, (v - cy) / fy, 1.0);
+                double range = d * direction.norm();
+                bool hit = range <= max_range_;
+                double scale = hit ? d : d * max_range_ / range;
+                Eigen::Vector3d ray_end =
+                        ray_origin +
+                        rotation * (direction * scale / voxel_length_);
+                // Both ends are in range, hence the voxels between them too.
+                if (!IsPackableVoxelPoint(ray_end)) {
+                    range_warning = true;
+                    continue;
+                }
+                TraverseRay(ray_origin, ray_end, free_cells);
+                if (hit) {
+                    hit_cells.Insert(PackVoxelIndex(
+                            Eigen::floor(ray_end.array()).cast<int>()));
+                }
+            }
+        }
+#ifdef _OPENMP
+    }
+#endif
+    if (range_warning) {
+        utility::PrintWarning(
+                "[OccupancyVolume::Integrate] Rays leaving the volume range "
+                "are skipped.\n");
+    }
+
+    VoxelKeySet &hit_cells = thread_hit[0];
+    for (int i = 1; i < num_threads; i++) {
+        for (uint64_t key : thread_hit[i].Keys()) {
+            hit_cells.Insert(key);
+        }
+    }
+    for (uint64_t key : hit_cells.Keys()) {
+        float &log_odds = log_odds_[UnpackVoxelIndex(key)];
+        log_odds = std::min(log_odds + log_odds_hit_, log_odds_max_);
+    }
+    VoxelKeySet &free_cells = thread_free[0];
+    for (int i = 1; i < num_threads; i++) {
+        for (uint64_t key : thread_free[i].Keys()) {
+            free_cells.Insert(key);
+        }
+    }
+    for (uint64_t key : free_cells.Keys()) {
+        if (hit_cells.Contains(key)) {
+            continue;
+        }
+        float &log_odds = log_odds_[UnpackVoxelIndex(key)];
+        log_odds = std::max(log_odds + log_odds_miss_, log_odds_min_);
+    }
+}
+
+std::shared_ptr<geometry::VoxelGrid> OccupancyVolume::ExtractOccupied(
+        double occupancy_threshold) const {
+    auto voxel_grid = std::make_shared<geometry::VoxelGrid>();
+    voxel_grid->voxel_size_ = voxel_length_;
+    voxel_grid->origin_ = Eigen::Vector3d::Zero();
+    const float threshold = ProbabilityToLogOdds(occupancy_threshold);
+    for (const auto &it : log_odds_) {
+        if (it.second > threshold) {
+            double probability = LogOddsToProbability(it.second);
+            voxel_grid->voxels_.emplace_back(
+                    it.first,
+                    Eigen::Vector3d(probability, probability, probability));
+        }
+    }
+    std::sort(voxel_grid->voxels_.begin(), voxel_grid->voxels_.end(),
+              [](const geometry::Voxel &a, const geometry::Voxel &b) {
+                  return LessVoxelIndex(a.grid_index_, b.grid_index_);
+              });
+    voxel_grid->UpdateVoxelIndex();
+    return voxel_grid;
+}
+
+double OccupancyVolume::GetOccupancyProbability(
+        const Eigen::Vector3d &point) const {
+    auto it = log_odds_.find(LocateVoxel(point));
+    if (it == log_odds_.end()) {
+        return 0.5;
+    }
+    return LogOddsToProbability(it->second);
+}
+
+}  // namespace integration
+}  // namespace open3d
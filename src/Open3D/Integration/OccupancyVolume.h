@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/Utility/Helper.h"
+
+namespace open3d {
+namespace integration {
+
+/// Sparse probabilistic occupancy map, integrated from depth images in the
+/// manner of OctoMap:
+/// A. Hornung, K. M. Wurm, M. Bennewitz, C. Stachniss, and W. Burgard
+/// OctoMap: An Efficient Probabilistic 3D Mapping Framework Based on Octrees
+/// In Autonomous Robots, 2013
+///
+/// Every voxel stores the log-odds of being occupied. Each depth pixel casts
+/// a ray from the camera center, traversed with a 3D-DDA: the voxels crossed
+/// by the ray are updated as free, the voxel containing the measured point as
+/// occupied. Voxel (x, y, z) spans from (x, y, z) * voxel_length_ to
+/// (x + 1, y + 1, z + 1) * voxel_length_. Voxel coordinates are limited to
+/// [-2^20, 2^20), i.e. the volume covers +/- 2^20 * voxel_length_ around the
+/// origin.
+class OccupancyVolume {
+public:
+    OccupancyVolume(double voxel_length,
+                    double max_range = 5.0,
+                    double prob_hit = 0.7,
+                    double prob_miss = 0.4,
+                    double prob_min = 0.12,
+                    double prob_max = 0.97,
+                    int depth_sampling_stride = 1);
+    ~OccupancyVolume() {}
+
+public:
+    /// Function to reset the OccupancyVolume
+    void Reset();
+
+    /// Function to integrate a depth image into the volume. depth has to be a
+    /// float image in meters, such as RGBDImage::depth_; pixels with depth 0
+    /// are skipped. Rays longer than max_range_ only carve free space up to
+    /// max_range_. Each voxel is updated at most once per image, occupied
+    /// taking precedence over free. Rays leaving the volume range are skipped
+    /// with a warning.
+    void Integrate(const geometry::Image &depth,
+                   const camera::PinholeCameraIntrinsic &intrinsic,
+                   const Eigen::Matrix4d &extrinsic);
+
+    /// Function to extract the voxels with an occupancy probability above
+    /// occupancy_threshold. The voxel colors are set to the occupancy
+    /// probability.
+    std::shared_ptr<geometry::VoxelGrid> ExtractOccupied(
+            double occupancy_threshold = 0.5) const;
+
+    /// Returns the occupancy probability of the voxel containing point, 0.5
+    /// if it has never been observed.
+    double GetOccupancyProbability(const Eigen::Vector3d &point) const;
+
+    Eigen::Vector3i LocateVoxel(const Eigen::Vector3d &point) const {
+        return Eigen::Vector3i((int)std::floor(point(0) / voxel_length_),
+                               (int)std::floor(point(1) / voxel_length_),
+                               (int)std::floor(point(2) / voxel_length_));
+    }
+
+public:
+    double voxel_length_;
+    double max_range_;
+    float log_odds_hit_;
+    float log_odds_miss_;
+    float log_odds_min_;
+    float log_odds_max_;
+    int depth_sampling_stride_;
+
+    std::unordered_map<Eigen::Vector3i,
+                       float,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            log_odds_;
+};
+
+}  // namespace integration
+}  // namespace open3d
@@ -27,6 +27,7 @@
 #include "Open3D/Integration/ScalableTSDFVolume.h"
 
 #include <unordered_set>
+#include <vector>
 
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Integration/MarchingCubesConst.h"
@@ -80,29 +81,65 @@ void ScalableTSDFVolume::Integrate(
     auto pointcloud = geometry::CreatePointCloudFromDepthImage(
             image.depth_, intrinsic, extrinsic, 1000.0, 1000.0,
             depth_sampling_stride_);
+    const Eigen::Vector3d sdf_trunc_3d(sdf_trunc_, sdf_trunc_, sdf_trunc_);
+    const auto &points = pointcloud->points_;
+
+    // Each thread collects the volume units touched by its points without
+    // duplicates, then the thread sets are merged.
     std::unordered_set<Eigen::Vector3i,
                        utility::hash_eigen::hash<Eigen::Vector3i>>
-            touched_volume_units_;
-    for (const auto &point : pointcloud->points_) {
-        auto min_bound = LocateVolumeUnit(
-                point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        auto max_bound = LocateVolumeUnit(
-                point + Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        for (auto x = min_bound(0); x <= max_bound(0); x++) {
-            for (auto y = min_bound(1); y <= max_bound(1); y++) {
-                for (auto z = min_bound(2); z <= max_bound(2); z++) {
-                    auto loc = Eigen::Vector3i(x, y, z);
-                    if (touched_volume_units_.find(loc) ==
-                        touched_volume_units_.end()) {
-                        touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
+            touched_volume_units;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::unordered_set<Eigen::Vector3i,
+                           utility::hash_eigen::hash<Eigen::Vector3i>>
+                touched_volume_units_local;
+#ifdef _OPENMP
+#pragma omp for schedule(static) nowait
+#endif
+        for (int i = 0; i < (int)points.size(); i++) {
+            auto min_bound = LocateVolumeUnit(points[i] - sdf_trunc_3d);
+            auto max_bound = LocateVolumeUnit(points[i] + sdf_trunc_3d);
+            for (auto x = min_bound(0); x <= max_bound(0); x++) {
+                for (auto y = min_bound(1); y <= max_bound(1); y++) {
+                    for (auto z = min_bound(2); z <= max_bound(2); z++) {
+                        touched_volume_units_local.insert(
+                                Eigen::Vector3i(x, y, z));
                     }
                 }
             }
         }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        touched_volume_units.insert(touched_volume_units_local.begin(),
+                                    touched_volume_units_local.end());
+    }
+
+    // The units are inserted into the map serially. References to the
+    // elements of an unordered_map stay valid when it grows, so the volumes
+    // can then be allocated and integrated in parallel, one unit per task.
+    std::vector<VolumeUnit *> units;
+    units.reserve(touched_volume_units.size());
+    for (const auto &index : touched_volume_units) {
+        auto &unit = volume_units_[index];
+        unit.index_ = index;
+        units.push_back(&unit);
+    }
+    // The parallel loop of IntegrateWithDepthToCameraDistanceMultiplier runs
+    // serially within each task, unless nested parallelism is enabled.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)units.size(); i++) {
+        VolumeUnit &unit = *units[i];
+        if (!unit.volume_) {
+            unit.volume_ = CreateVolumeUnit(unit.index_);
+        }
+        unit.volume_->IntegrateWithDepthToCameraDistanceMultiplier(
+                image, intrinsic, extrinsic, *depth2cameradistance);
     }
 }
 
@@ -390,14 +427,19 @@ std::shared_ptr<UniformTSDFVolume> ScalableTSDFVolume::OpenVolumeUnit(
         const Eigen::Vector3i &index) {
     auto &unit = volume_units_[index];
     if (!unit.volume_) {
-        unit.volume_.reset(new UniformTSDFVolume(
-                volume_unit_length_, volume_unit_resolution_, sdf_trunc_,
-                color_type_, index.cast<double>() * volume_unit_length_));
+        unit.volume_ = CreateVolumeUnit(index);
         unit.index_ = index;
     }
     return unit.volume_;
 }
 
+std::shared_ptr<UniformTSDFVolume> ScalableTSDFVolume::CreateVolumeUnit(
+        const Eigen::Vector3i &index) const {
+    return std::make_shared<UniformTSDFVolume>(
+            volume_unit_length_, volume_unit_resolution_, sdf_trunc_,
+            color_type_, index.cast<double>() * volume_unit_length_);
+}
+
 Eigen::Vector3d ScalableTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
     Eigen::Vector3d n;
     const double half_gap = 0.99 * voxel_length_;
@@ -106,6 +106,9 @@ private:
     std::shared_ptr<UniformTSDFVolume> OpenVolumeUnit(
             const Eigen::Vector3i &index);
 
+    std::shared_ptr<UniformTSDFVolume> CreateVolumeUnit(
+            const Eigen::Vector3i &index) const;
+
     Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
 
     double GetTSDFAt(const Eigen::Vector3d &p);
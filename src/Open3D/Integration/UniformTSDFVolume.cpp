@@ -30,6 +30,7 @@
 #include <thread>
 #include <unordered_map>
 
+#include "Open3D/Geometry/DistanceField.h"
 #include "Open3D/Geometry/VoxelGrid.h"
 #include "Open3D/Integration/MarchingCubesConst.h"
 #include "Open3D/Utility/Helper.h"
@@ -292,6 +293,29 @@ std::shared_ptr<geometry::VoxelGrid> UniformTSDFVolume::ExtractVoxelGrid()
     return voxel_grid;
 }
 
+std::shared_ptr<geometry::DistanceField>
+UniformTSDFVolume::ExtractDistanceField() const {
+    auto field = std::make_shared<geometry::DistanceField>(
+            origin_, voxel_length_,
+            Eigen::Vector3i(resolution_, resolution_, resolution_));
+    std::vector<uint8_t> occupancy(voxel_num_);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < voxel_num_; i++) {
+        const geometry::TSDFVoxel &voxel = voxel_grid_.voxels_[i];
+        if (voxel.weight_ == 0.0f) {
+            occupancy[i] = geometry::DistanceField::VOXEL_UNKNOWN;
+        } else if (voxel.tsdf_ < 0) {
+            occupancy[i] = geometry::DistanceField::VOXEL_OCCUPIED;
+        } else {
+            occupancy[i] = geometry::DistanceField::VOXEL_FREE;
+        }
+    }
+    field->ComputeSignedDistances(occupancy);
+    return field;
+}
+
 void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
         const geometry::RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
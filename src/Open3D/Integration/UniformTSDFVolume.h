@@ -33,6 +33,8 @@ namespace open3d {
 
 namespace geometry {
 
+class DistanceField;
+
 class TSDFVoxel : public Voxel {
 public:
     TSDFVoxel() : Voxel() {}
@@ -76,6 +78,13 @@ public:
     std::shared_ptr<geometry::PointCloud> ExtractVoxelPointCloud() const;
     std::shared_ptr<geometry::VoxelGrid> ExtractVoxelGrid() const;
 
+    /// Function to extract the full Euclidean signed distance field of the
+    /// volume, taking the observed voxels with negative TSDF as occupied.
+    /// Voxels never observed, such as the interior of objects thicker than
+    /// sdf_trunc_, are inside if the closest observed voxel is occupied.
+    /// Unlike the TSDF, the distances are not truncated.
+    std::shared_ptr<geometry::DistanceField> ExtractDistanceField() const;
+
     /// Faster Integrate function that uses depth_to_camera_distance_multiplier
     /// precomputed from camera intrinsic
     void IntegrateWithDepthToCameraDistanceMultiplier(
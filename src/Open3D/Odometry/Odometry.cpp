@@ -29,6 +29,7 @@
 #include <Eigen/Dense>
 
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/ImagePool.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Odometry/RGBDOdometryJacobian.h"
 #include "Open3D/Utility/Eigen.h"
@@ -42,10 +43,9 @@ using namespace odometry;
 std::tuple<std::shared_ptr<geometry::Image>, std::shared_ptr<geometry::Image>>
 InitializeCorrespondenceMap(int width, int height) {
     // initialization: filling with any (u,v) to (-1,-1)
-    auto correspondence_map = std::make_shared<geometry::Image>();
-    auto depth_buffer = std::make_shared<geometry::Image>();
-    correspondence_map->PrepareImage(width, height, 2, 4);
-    depth_buffer->PrepareImage(width, height, 1, 4);
+    auto correspondence_map =
+            geometry::CreatePooledImage(width, height, 2, 4, false);
+    auto depth_buffer = geometry::CreatePooledImage(width, height, 1, 4, false);
     for (int v = 0; v < correspondence_map->height_; v++) {
         for (int u = 0; u < correspondence_map->width_; u++) {
             *geometry::PointerAt<int>(*correspondence_map, u, v, 0) = -1;
@@ -207,17 +207,17 @@ std::shared_ptr<CorrespondenceSetPixelWise> ComputeCorrespondence(
 
 std::shared_ptr<geometry::Image> ConvertDepthImageToXYZImage(
         const geometry::Image &depth, const Eigen::Matrix3d &intrinsic_matrix) {
-    auto image_xyz = std::make_shared<geometry::Image>();
     if (depth.num_of_channels_ != 1 || depth.bytes_per_channel_ != 4) {
         utility::PrintDebug(
                 "[ConvertDepthImageToXYZImage] Unsupported image format.\n");
-        return image_xyz;
+        return std::make_shared<geometry::Image>();
     }
     const double inv_fx = 1.0 / intrinsic_matrix(0, 0);
     const double inv_fy = 1.0 / intrinsic_matrix(1, 1);
     const double ox = intrinsic_matrix(0, 2);
     const double oy = intrinsic_matrix(1, 2);
-    image_xyz->PrepareImage(depth.width_, depth.height_, 3, 4);
+    auto image_xyz = geometry::CreatePooledImage(depth.width_, depth.height_,
+                                                 3, 4, false);
 
     for (int y = 0; y < image_xyz->height_; y++) {
         for (int x = 0; x < image_xyz->width_; x++) {
@@ -341,8 +341,9 @@ inline std::shared_ptr<geometry::RGBDImage> PackRGBDImage(
 
 std::shared_ptr<geometry::Image> PreprocessDepth(
         const geometry::Image &depth_orig, const OdometryOption &option) {
-    std::shared_ptr<geometry::Image> depth_processed =
-            std::make_shared<geometry::Image>();
+    auto depth_processed = geometry::CreatePooledImage(
+            depth_orig.width_, depth_orig.height_, depth_orig.num_of_channels_,
+            depth_orig.bytes_per_channel_, false);
     *depth_processed = depth_orig;
     for (int y = 0; y < depth_processed->height_; y++) {
         for (int x = 0; x < depth_processed->width_; x++) {
@@ -33,9 +33,12 @@
 #include "Open3D/Camera/PinholeCameraTrajectory.h"
 #include "Open3D/ColorMap/ColorMapOptimization.h"
 #include "Open3D/ColorMap/ImageWarpingField.h"
+#include "Open3D/Geometry/DistanceField.h"
 #include "Open3D/Geometry/Geometry.h"
 #include "Open3D/Geometry/HalfEdgeTriangleMesh.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/ImagePool.h"
+#include "Open3D/Geometry/ImageView.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/LineSet.h"
 #include "Open3D/Geometry/PointCloud.h"
@@ -49,8 +52,10 @@
 #include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "Open3D/IO/ClassIO/PoseGraphIO.h"
+#include "Open3D/IO/ClassIO/RGBDImageIO.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/IO/ClassIO/VoxelGridIO.h"
+#include "Open3D/Integration/OccupancyVolume.h"
 #include "Open3D/Integration/ScalableTSDFVolume.h"
 #include "Open3D/Integration/TSDFVolume.h"
 #include "Open3D/Integration/UniformTSDFVolume.h"
@@ -0,0 +1,46 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// clang-format off
+// Open3D version
+#define OPEN3D_VERSION_MAJOR 0
+#define OPEN3D_VERSION_MINOR 7
+#define OPEN3D_VERSION_PATCH 0
+#define OPEN3D_VERSION_TWEAK 0
+#define OPEN3D_VERSION       "0.7.0.0"
+
+// Open3D info
+#define OPEN3D_HOME          "http://www.open3d.org"
+#define OPEN3D_DOCS          "http://www.open3d.org/docs"
+#define OPEN3D_CODE          "https://github.com/intel-isl/Open3D"
+#define OPEN3D_ISSUES        "https://github.com/intel-isl/Open3D/issues"
+
+namespace open3d {
+
+    void PrintOpen3DVersion();
+
+}
+// clang-format on
@@ -26,11 +26,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <tuple>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace open3d {
 namespace utility {
 
@@ -120,5 +126,40 @@ size_t WordLength(const std::string& doc,
                   size_t start_pos,
                   const std::string& valid_chars = "_");
 
+/// Function to sort the range [first, last) with the comparator \param comp
+/// using all OpenMP threads. The range is split into one chunk per thread,
+/// the chunks are sorted concurrently and then merged pairwise. Like
+/// std::sort, the sort is not stable.
+template <typename RandomIt, typename Compare>
+void ParallelSort(RandomIt first, RandomIt last, Compare comp) {
+#ifdef _OPENMP
+    const int64_t size = int64_t(last - first);
+    const int num_chunks = omp_get_max_threads();
+    if (num_chunks <= 1 || size < 4096) {
+        std::sort(first, last, comp);
+        return;
+    }
+    std::vector<int64_t> bounds(num_chunks + 1);
+    for (int i = 0; i <= num_chunks; i++) {
+        bounds[i] = size * i / num_chunks;
+    }
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < num_chunks; i++) {
+        std::sort(first + bounds[i], first + bounds[i + 1], comp);
+    }
+    for (int width = 1; width < num_chunks; width *= 2) {
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < num_chunks - width; i += 2 * width) {
+            std::inplace_merge(first + bounds[i], first + bounds[i + width],
+                               first + bounds[std::min(i + 2 * width,
+                                                       num_chunks)],
+                               comp);
+        }
+    }
+#else
+    std::sort(first, last, comp);
+#endif
+}
+
 }  // namespace utility
 }  // namespace open3d
@@ -69,6 +69,19 @@ void pybind_camera_classes(py::module &m) {
             .def("is_valid", &camera::PinholeCameraIntrinsic::IsValid,
                  "Returns True iff both the width and height are greater than "
                  "0.")
+            .def("set_distortion",
+                 &camera::PinholeCameraIntrinsic::SetDistortion, "k1"_a,
+                 "k2"_a, "p1"_a, "p2"_a, "k3"_a = 0.0,
+                 "Set the lens distortion coefficients, in the order used by "
+                 "OpenCV.")
+            .def("has_distortion",
+                 &camera::PinholeCameraIntrinsic::HasDistortion,
+                 "Returns True iff a distortion coefficient is not 0.")
+            .def("distort_normalized_point",
+                 &camera::PinholeCameraIntrinsic::DistortNormalizedPoint,
+                 "point"_a,
+                 "Applies the lens distortion to a point in normalized image "
+                 "coordinates.")
             .def_readwrite("width", &camera::PinholeCameraIntrinsic::width_,
                            "int: Width of the image.")
             .def_readwrite("height", &camera::PinholeCameraIntrinsic::height_,
@@ -78,6 +91,11 @@ void pybind_camera_classes(py::module &m) {
                            "3x3 numpy array: Intrinsic camera matrix ``[[fx, "
                            "0, cx], [0, fy, "
                            "cy], [0, 0, 1]]``")
+            .def_readwrite(
+                    "distortion_coefficients",
+                    &camera::PinholeCameraIntrinsic::distortion_coefficients_,
+                    "5x1 numpy array: Lens distortion coefficients ``[k1, k2, "
+                    "p1, p2, k3]``")
             .def("__repr__", [](const camera::PinholeCameraIntrinsic &c) {
                 return std::string(
                                "camera::PinholeCameraIntrinsic with width = ") +
@@ -102,6 +120,12 @@ void pybind_camera_classes(py::module &m) {
                                     "get_principal_point");
     docstring::ClassMethodDocInject(m, "PinholeCameraIntrinsic", "get_skew");
     docstring::ClassMethodDocInject(m, "PinholeCameraIntrinsic", "is_valid");
+    docstring::ClassMethodDocInject(m, "PinholeCameraIntrinsic",
+                                    "set_distortion");
+    docstring::ClassMethodDocInject(m, "PinholeCameraIntrinsic",
+                                    "has_distortion");
+    docstring::ClassMethodDocInject(m, "PinholeCameraIntrinsic",
+                                    "distort_normalized_point");
 
     // open3d.camera.PinholeCameraIntrinsicParameters
     py::enum_<camera::PinholeCameraIntrinsicParameters> pinhole_intr_params(
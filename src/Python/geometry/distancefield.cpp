@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/DistanceField.h"
+#include "Open3D/Geometry/VoxelGrid.h"
+#include "Python/docstring.h"
+#include "Python/geometry/geometry.h"
+
+using namespace open3d;
+
+void pybind_distancefield(py::module &m) {
+    py::class_<geometry::DistanceField,
+               std::shared_ptr<geometry::DistanceField>>
+            distancefield(m, "DistanceField",
+                          "Dense Euclidean signed distance field on a regular "
+                          "grid.");
+    py::detail::bind_default_constructor<geometry::DistanceField>(
+            distancefield);
+    py::detail::bind_copy_functions<geometry::DistanceField>(distancefield);
+    distancefield
+            .def("__repr__",
+                 [](const geometry::DistanceField &field) {
+                     return std::string("geometry::DistanceField with "
+                                        "resolution ") +
+                            std::to_string(field.resolution_(0)) + "x" +
+                            std::to_string(field.resolution_(1)) + "x" +
+                            std::to_string(field.resolution_(2)) + ".";
+                 })
+            .def("is_empty", &geometry::DistanceField::IsEmpty,
+                 "Returns ``True`` if the field has no voxels.")
+            .def("get_distance", &geometry::DistanceField::GetDistance,
+                 "point"_a,
+                 "Trilinear interpolation of the signed distance at a point.")
+            .def("get_gradient", &geometry::DistanceField::GetGradient,
+                 "point"_a, "Gradient of the signed distance at a point.")
+            .def_readwrite("origin", &geometry::DistanceField::origin_,
+                           "``float64`` vector of length 3: Minimum corner of "
+                           "the grid.")
+            .def_readwrite("voxel_size", &geometry::DistanceField::voxel_size_,
+                           "float: Voxel size.")
+            .def_readwrite("resolution", &geometry::DistanceField::resolution_,
+                           "``int`` vector of length 3: Number of voxels "
+                           "along each axis.")
+            .def_readwrite("distances", &geometry::DistanceField::distances_,
+                           "List of float: Signed distances at the voxel "
+                           "centers.");
+    docstring::ClassMethodDocInject(m, "DistanceField", "is_empty");
+    docstring::ClassMethodDocInject(m, "DistanceField", "get_distance",
+                                    {{"point", "The query point."}});
+    docstring::ClassMethodDocInject(m, "DistanceField", "get_gradient",
+                                    {{"point", "The query point."}});
+
+    py::class_<geometry::SparseDistanceField,
+               std::shared_ptr<geometry::SparseDistanceField>>
+            sparse_distancefield(m, "SparseDistanceField",
+                                 "Sparse Euclidean distance field updated "
+                                 "incrementally from obstacle changes.");
+    py::detail::bind_copy_functions<geometry::SparseDistanceField>(
+            sparse_distancefield);
+    sparse_distancefield
+            .def(py::init<double, double>(), "voxel_size"_a,
+                 "max_distance"_a)
+            .def("reset", &geometry::SparseDistanceField::Reset,
+                 "Removes all obstacles.")
+            .def("add_obstacle", &geometry::SparseDistanceField::AddObstacle,
+                 "index"_a, "Queues a new obstacle voxel.")
+            .def("remove_obstacle",
+                 &geometry::SparseDistanceField::RemoveObstacle, "index"_a,
+                 "Queues the removal of an obstacle voxel.")
+            .def("set_obstacles",
+                 &geometry::SparseDistanceField::SetObstacles, "voxel_grid"_a,
+                 "Queues the changes making the obstacles equal to the "
+                 "voxels of a voxel grid.")
+            .def("update", &geometry::SparseDistanceField::Update,
+                 "Propagates the queued obstacle changes.")
+            .def("is_obstacle", &geometry::SparseDistanceField::IsObstacle,
+                 "index"_a, "Returns ``True`` if the voxel is an obstacle.")
+            .def("get_distance", &geometry::SparseDistanceField::GetDistance,
+                 "point"_a, "Distance to the closest obstacle at a point.")
+            .def("get_gradient", &geometry::SparseDistanceField::GetGradient,
+                 "point"_a, "Gradient of the distance at a point.")
+            .def_readonly("voxel_size",
+                          &geometry::SparseDistanceField::voxel_size_,
+                          "float: Voxel size.")
+            .def_readonly("max_distance",
+                          &geometry::SparseDistanceField::max_distance_,
+                          "float: Distances are capped to this value.");
+    docstring::ClassMethodDocInject(m, "SparseDistanceField", "reset");
+    docstring::ClassMethodDocInject(m, "SparseDistanceField", "add_obstacle",
+                                    {{"index", "Voxel index."}});
+    docstring::ClassMethodDocInject(m, "SparseDistanceField",
+                                    "remove_obstacle",
+                                    {{"index", "Voxel index."}});
+    docstring::ClassMethodDocInject(
+            m, "SparseDistanceField", "set_obstacles",
+            {{"voxel_grid", "Voxel grid of the obstacles."}});
+    docstring::ClassMethodDocInject(m, "SparseDistanceField", "update");
+    docstring::ClassMethodDocInject(m, "SparseDistanceField", "is_obstacle",
+                                    {{"index", "Voxel index."}});
+    docstring::ClassMethodDocInject(m, "SparseDistanceField", "get_distance",
+                                    {{"point", "The query point."}});
+    docstring::ClassMethodDocInject(m, "SparseDistanceField", "get_gradient",
+                                    {{"point", "The query point."}});
+}
+
+void pybind_distancefield_methods(py::module &m) {
+    m.def("create_distance_field_from_voxel_grid",
+          &geometry::CreateDistanceFieldFromVoxelGrid,
+          "Function to compute the signed distance field of a voxel grid",
+          "voxel_grid"_a, "padding"_a = 5);
+    docstring::FunctionDocInject(
+            m, "create_distance_field_from_voxel_grid",
+            {{"voxel_grid", "The occupied voxels."},
+             {"padding", "Number of voxels added around the bounding grid."}});
+}
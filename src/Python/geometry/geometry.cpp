@@ -158,4 +158,6 @@ void pybind_geometry(py::module &m) {
     pybind_image_methods(m_submodule);
     pybind_octree_methods(m_submodule);
     pybind_octree(m_submodule);
+    pybind_distancefield(m_submodule);
+    pybind_distancefield_methods(m_submodule);
 }
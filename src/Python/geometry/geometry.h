@@ -44,3 +44,5 @@ void pybind_lineset_methods(py::module &m);
 void pybind_image_methods(py::module &m);
 void pybind_octree_methods(py::module &m);
 void pybind_octree(py::module &m);
+void pybind_distancefield(py::module &m);
+void pybind_distancefield_methods(py::module &m);
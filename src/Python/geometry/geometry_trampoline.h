@@ -77,8 +77,9 @@ template <class TriangleMeshBase = geometry::TriangleMesh>
 class PyTriangleMesh : public PyGeometry3D<TriangleMeshBase> {
 public:
     using PyGeometry3D<TriangleMeshBase>::PyGeometry3D;
-    void RemoveDuplicatedVertices() override {
-        PYBIND11_OVERLOAD(void, TriangleMeshBase, RemoveDuplicatedVertices, );
+    void RemoveDuplicatedVertices(double eps) override {
+        PYBIND11_OVERLOAD(void, TriangleMeshBase, RemoveDuplicatedVertices,
+                          eps);
     };
     void RemoveDuplicatedTriangles() override {
         PYBIND11_OVERLOAD(void, TriangleMeshBase, RemoveDuplicatedTriangles, );
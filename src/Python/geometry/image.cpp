@@ -24,7 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/ImagePool.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Python/docstring.h"
 #include "Python/geometry/geometry.h"
@@ -52,7 +54,24 @@ static const std::unordered_map<std::string, std::string>
                 {"num_of_levels ", "Levels of the image pyramid"},
                 {"with_gaussian_filter",
                  "When ``True``, image in the pyramid will first be filtered "
-                 "by a 3x3 Gaussian kernel before downsampling."}};
+                 "by a 3x3 Gaussian kernel before downsampling."},
+                {"half_kernel_size",
+                 "The filter covers (2 half_kernel_size + 1)^2 pixels."},
+                {"sigma_space",
+                 "Standard deviation of the spatial weights, in pixels."},
+                {"sigma_depth",
+                 "Standard deviation of the depth weights, in depth units."},
+                {"kernel_size", "Size of the median window, 3 or 5."},
+                {"max_distance",
+                 "Holes farther than this from a valid pixel, in pixels, are "
+                 "left unfilled."},
+                {"width", "Width of the output image."},
+                {"height", "Height of the output image."},
+                {"interpolation_type", "The interpolation type to be used."},
+                {"map",
+                 "2-channel float image of the input pixel coordinates of "
+                 "the output pixels."},
+                {"intrinsic", "Intrinsic of the camera with lens distortion."}};
 
 void pybind_image(py::module &m) {
     py::class_<geometry::Image, PyGeometry2D<geometry::Image>,
@@ -243,6 +262,101 @@ void pybind_image_methods(py::module &m) {
     docstring::FunctionDocInject(m, "filter_image_pyramid",
                                  map_shared_argument_docstrings);
 
+    m.def("bilateral_filter_depth_image",
+          (std::shared_ptr<geometry::Image>(*)(const geometry::Image &, int,
+                                               double, double)) &
+                  geometry::BilateralFilterDepthImage,
+          "Function to smooth a float depth image with an edge-preserving "
+          "bilateral filter. Pixels that are not positive are invalid and "
+          "stay 0.",
+          "depth"_a, "half_kernel_size"_a = 2, "sigma_space"_a = 1.5,
+          "sigma_depth"_a = 0.03);
+    docstring::FunctionDocInject(m, "bilateral_filter_depth_image",
+                                 map_shared_argument_docstrings);
+
+    m.def("median_filter_depth_image",
+          (std::shared_ptr<geometry::Image>(*)(const geometry::Image &,
+                                               int)) &
+                  geometry::MedianFilterDepthImage,
+          "Function to replace the valid pixels of a float depth image by "
+          "the median of the valid pixels of their neighbourhood.",
+          "depth"_a, "kernel_size"_a = 3);
+    docstring::FunctionDocInject(m, "median_filter_depth_image",
+                                 map_shared_argument_docstrings);
+
+    m.def("fill_depth_image_holes",
+          (std::shared_ptr<geometry::Image>(*)(const geometry::Image &,
+                                               double)) &
+                  geometry::FillDepthImageHoles,
+          "Function to fill the invalid pixels of a float depth image with "
+          "their nearest valid pixel.",
+          "depth"_a, "max_distance"_a = 10.0);
+    docstring::FunctionDocInject(m, "fill_depth_image_holes",
+                                 map_shared_argument_docstrings);
+
+    py::enum_<geometry::Image::InterpolationType> interpolation_type(
+            m, "ImageInterpolationType");
+    interpolation_type
+            .value("Nearest", geometry::Image::InterpolationType::Nearest)
+            .value("Bilinear", geometry::Image::InterpolationType::Bilinear)
+            .value("Area", geometry::Image::InterpolationType::Area)
+            .export_values();
+    interpolation_type.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Enum class for Image interpolation types.";
+            }),
+            py::none(), py::none(), "");
+
+    m.def("resize_image",
+          (std::shared_ptr<geometry::Image>(*)(
+                  const geometry::Image &, int, int,
+                  geometry::Image::InterpolationType)) &
+                  geometry::ResizeImage,
+          "Function to resize an Image. Use Area interpolation to downsample, "
+          "and Nearest for depth images.",
+          "image"_a, "width"_a, "height"_a,
+          "interpolation_type"_a =
+                  geometry::Image::InterpolationType::Bilinear);
+    docstring::FunctionDocInject(m, "resize_image",
+                                 map_shared_argument_docstrings);
+
+    m.def("remap_image",
+          (std::shared_ptr<geometry::Image>(*)(
+                  const geometry::Image &, const geometry::Image &,
+                  geometry::Image::InterpolationType)) &
+                  geometry::RemapImage,
+          "Function to resample an Image at the pixel coordinates stored in "
+          "a 2-channel float map.",
+          "image"_a, "map"_a,
+          "interpolation_type"_a =
+                  geometry::Image::InterpolationType::Bilinear);
+    docstring::FunctionDocInject(m, "remap_image",
+                                 map_shared_argument_docstrings);
+
+    m.def("create_undistortion_map",
+          (std::shared_ptr<geometry::Image>(*)(
+                  const camera::PinholeCameraIntrinsic &,
+                  const camera::PinholeCameraIntrinsic &)) &
+                  geometry::CreateUndistortionMap,
+          "Function to create the map that remap_image takes to undistort "
+          "the images of a camera into images of an ideal pinhole camera.",
+          "intrinsic"_a, "undistorted_intrinsic"_a);
+    m.def("create_undistortion_map",
+          (std::shared_ptr<geometry::Image>(*)(
+                  const camera::PinholeCameraIntrinsic &)) &
+                  geometry::CreateUndistortionMap,
+          "Function to create the map that remap_image takes to undistort "
+          "the images of a camera.",
+          "intrinsic"_a);
+
+    m.def("undistort_image", &geometry::UndistortImage,
+          "Function to undistort an Image of a camera with lens distortion.",
+          "image"_a, "intrinsic"_a,
+          "interpolation_type"_a =
+                  geometry::Image::InterpolationType::Bilinear);
+    docstring::FunctionDocInject(m, "undistort_image",
+                                 map_shared_argument_docstrings);
+
     m.def("create_rgbd_image_from_color_and_depth",
           &geometry::CreateRGBDImageFromColorAndDepth,
           "Function to make RGBDImage from color and depth image", "color"_a,
@@ -278,4 +392,23 @@ void pybind_image_methods(py::module &m) {
           "convert_rgb_to_intensity"_a = true);
     docstring::FunctionDocInject(m, "create_rgbd_image_from_nyu_format",
                                  map_shared_argument_docstrings);
+
+    m.def("set_image_pool_max_cached_bytes",
+          [](size_t max_cached_bytes) {
+              geometry::GetImagePool().SetMaxCachedBytes(max_cached_bytes);
+          },
+          "Function to set the maximum size of the released images that the "
+          "image functions keep for reuse, 256 MB by default. 0 disables "
+          "recycling.",
+          "max_cached_bytes"_a);
+    docstring::FunctionDocInject(
+            m, "set_image_pool_max_cached_bytes",
+            {{"max_cached_bytes", "Maximum size of the cached images."}});
+    m.def("get_image_pool_max_cached_bytes",
+          []() { return geometry::GetImagePool().GetMaxCachedBytes(); },
+          "Function to get the maximum size of the released images that the "
+          "image functions keep for reuse.");
+    m.def("clear_image_pool", []() { geometry::GetImagePool().Clear(); },
+          "Function to free the released images that the image functions "
+          "keep for reuse.");
 }
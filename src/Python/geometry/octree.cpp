@@ -43,10 +43,23 @@ static const std::unordered_map<std::string, std::string>
                 {"point", "Coordinates of the point."},
                 {"max_depth", "Maximum depth of the octree."},
                 {"point_cloud", "Input point cloud."},
+                {"query", "The query point."},
+                {"knn", "Number of nearest neighbors to search."},
+                {"radius", "Search radius."},
+                {"min_bound", "Minimum corner of the box."},
+                {"max_bound", "Maximum corner of the box."},
+                {"view_projection",
+                 "4x4 OpenGL style clip matrix, i.e. projection * view."},
+                {"lod_depth",
+                 "Depth at which the traversal stops and internal nodes are "
+                 "returned. A negative value returns leaf nodes."},
                 {"size_expand",
                  "A small expansion size such that the octree is slightly "
                  "bigger than the original point cloud bounds to accmondate "
-                 "all points."}};
+                 "all points."},
+                {"store_points",
+                 "If ``True``, the leaves keep the points and their indices, "
+                 "which the search methods require."}};
 
 void pybind_octree(py::module &m) {
     // geometry::OctreeNodeInfo
@@ -186,6 +199,37 @@ void pybind_octree(py::module &m) {
     py::detail::bind_copy_functions<geometry::OctreeColorLeafNode>(
             octree_color_leaf_node);
 
+    // geometry::OctreePointColorLeafNode
+    py::class_<geometry::OctreePointColorLeafNode,
+               PyOctreeLeafNode<geometry::OctreePointColorLeafNode>,
+               std::shared_ptr<geometry::OctreePointColorLeafNode>,
+               geometry::OctreeColorLeafNode>
+            octree_point_color_leaf_node(
+                    m, "OctreePointColorLeafNode",
+                    "OctreePointColorLeafNode class is an OctreeColorLeafNode "
+                    "that also stores the points inside the node.");
+    octree_point_color_leaf_node
+            .def("__repr__",
+                 [](const geometry::OctreePointColorLeafNode &leaf_node) {
+                     std::ostringstream repr;
+                     repr << "OctreePointColorLeafNode with "
+                          << leaf_node.indices_.size() << " points";
+                     return repr.str();
+                 })
+            .def_readwrite("indices",
+                           &geometry::OctreePointColorLeafNode::indices_,
+                           "List of int: Indices of the points in the source "
+                           "point cloud.")
+            .def_readwrite("points",
+                           &geometry::OctreePointColorLeafNode::points_,
+                           "``float64`` array of shape ``(num_points, 3)``: "
+                           "Coordinates of the points.");
+
+    py::detail::bind_default_constructor<geometry::OctreePointColorLeafNode>(
+            octree_point_color_leaf_node);
+    py::detail::bind_copy_functions<geometry::OctreePointColorLeafNode>(
+            octree_point_color_leaf_node);
+
     // geometry::Octree
     py::class_<geometry::Octree, PyGeometry3D<geometry::Octree>,
                std::shared_ptr<geometry::Octree>, geometry::Geometry3D>
@@ -224,7 +268,60 @@ void pybind_octree(py::module &m) {
                         "point < origin + size")
             .def("convert_from_point_cloud",
                  &geometry::Octree::ConvertFromPointCloud, "point_cloud"_a,
-                 "size_expand"_a = 0.01, "Convert octree from point cloud.")
+                 "size_expand"_a = 0.01, "store_points"_a = false,
+                 "Convert octree from point cloud.")
+            .def("search_knn",
+                 [](const geometry::Octree &octree,
+                    const Eigen::Vector3d &query, int knn) {
+                     std::vector<int> indices;
+                     std::vector<double> distance2;
+                     int k = octree.SearchKNN(query, knn, indices, distance2);
+                     return std::make_tuple(k, indices, distance2);
+                 },
+                 "query"_a, "knn"_a,
+                 "Returns the knn nearest points to query as (k, indices, "
+                 "squared distances).")
+            .def("search_radius",
+                 [](const geometry::Octree &octree,
+                    const Eigen::Vector3d &query, double radius) {
+                     std::vector<int> indices;
+                     std::vector<double> distance2;
+                     int k = octree.SearchRadius(query, radius, indices,
+                                                 distance2);
+                     return std::make_tuple(k, indices, distance2);
+                 },
+                 "query"_a, "radius"_a,
+                 "Returns the points within radius of query as (k, indices, "
+                 "squared distances).")
+            .def("search_box",
+                 [](const geometry::Octree &octree,
+                    const Eigen::Vector3d &min_bound,
+                    const Eigen::Vector3d &max_bound) {
+                     std::vector<int> indices;
+                     octree.SearchBox(min_bound, max_bound, indices);
+                     return indices;
+                 },
+                 "min_bound"_a, "max_bound"_a,
+                 "Returns the indices of the points inside the box.")
+            .def("search_frustum",
+                 [](const geometry::Octree &octree,
+                    const Eigen::Matrix4d &view_projection) {
+                     std::vector<int> indices;
+                     octree.SearchFrustum(view_projection, indices);
+                     return indices;
+                 },
+                 "view_projection"_a,
+                 "Returns the indices of the points inside the view "
+                 "frustum.")
+            .def("locate_nodes_in_box", &geometry::Octree::LocateNodesInBox,
+                 "min_bound"_a, "max_bound"_a, "lod_depth"_a = -1,
+                 "Returns the (OctreeNode, OctreeNodeInfo) pairs intersecting "
+                 "the box.")
+            .def("locate_nodes_in_frustum",
+                 &geometry::Octree::LocateNodesInFrustum, "view_projection"_a,
+                 "lod_depth"_a = -1,
+                 "Returns the (OctreeNode, OctreeNodeInfo) pairs intersecting "
+                 "the view frustum.")
             .def("to_voxel_grid", &geometry::Octree::ToVoxelGrid,
                  "Convert to VoxelGrid.")
             .def("from_voxel_grid", &geometry::Octree::FromVoxelGrid,
@@ -250,6 +347,18 @@ void pybind_octree(py::module &m) {
                                     map_octree_argument_docstrings);
     docstring::ClassMethodDocInject(m, "Octree", "convert_from_point_cloud",
                                     map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "Octree", "search_knn",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "Octree", "search_radius",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "Octree", "search_box",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "Octree", "search_frustum",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "Octree", "locate_nodes_in_box",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "Octree", "locate_nodes_in_frustum",
+                                    map_octree_argument_docstrings);
     docstring::ClassMethodDocInject(m, "Octree", "to_voxel_grid",
                                     map_octree_argument_docstrings);
     docstring::ClassMethodDocInject(
@@ -94,9 +94,13 @@ point is:
       - z = d / depth_scale
       - x = (u - cx) * z / fx
       - y = (v - cy) * z / fy
+
+Without project_valid_depth_only, the point cloud keeps one point per sampled
+pixel in row-major order, NaN for the pixels without a valid depth.
 )",
           "depth"_a, "intrinsic"_a, "extrinsic"_a = Eigen::Matrix4d::Identity(),
-          "depth_scale"_a = 1000.0, "depth_trunc"_a = 1000.0, "stride"_a = 1);
+          "depth_scale"_a = 1000.0, "depth_trunc"_a = 1000.0, "stride"_a = 1,
+          "project_valid_depth_only"_a = true);
     docstring::FunctionDocInject(m, "create_point_cloud_from_depth_image");
 
     m.def("create_point_cloud_from_rgbd_image",
@@ -108,9 +112,12 @@ point is:
       - z = d / depth_scale
       - x = (u - cx) * z / fx
       - y = (v - cy) * z / fy
+
+Without project_valid_depth_only, the point cloud keeps one point per pixel in
+row-major order, NaN for the pixels without a valid depth.
 )",
-          "image"_a, "intrinsic"_a,
-          "extrinsic"_a = Eigen::Matrix4d::Identity());
+          "image"_a, "intrinsic"_a, "extrinsic"_a = Eigen::Matrix4d::Identity(),
+          "project_valid_depth_only"_a = true);
     docstring::FunctionDocInject(m, "create_point_cloud_from_rgbd_image");
 
     // Overloaded function, do not inject docs. Keep commented out for future.
@@ -205,6 +212,29 @@ point is:
              {"search_param",
               "The KDTree search parameters for neighborhood search."}});
 
+    m.def("estimate_normals_organised", &geometry::EstimateNormalsOrganised,
+          "Function to compute the normals of an organised point cloud, as "
+          "created from a depth image without project_valid_depth_only, from "
+          "integral images of its neighbourhoods instead of a KDTree.",
+          "cloud"_a, "width"_a, "height"_a, "half_window_size"_a = 3,
+          "max_depth_change_factor"_a = 0.02,
+          "camera_location"_a = Eigen::Vector3d(0.0, 0.0, 0.0));
+    docstring::FunctionDocInject(
+            m, "estimate_normals_organised",
+            {{"cloud",
+              "The input point cloud of width x height points in row-major "
+              "order. It also stores the output normals."},
+             {"width", "Width of the image the point cloud is organised as."},
+             {"height", "Height of the image the point cloud is organised as."},
+             {"half_window_size",
+              "Half size of the window of neighbouring pixels."},
+             {"max_depth_change_factor",
+              "Neighbouring points further apart than this factor times "
+              "their distance to the camera are on different surfaces."},
+             {"camera_location",
+              "Normals are oriented towards the camera_location if the input "
+              "has no normals."}});
+
     m.def("orient_normals_to_align_with_direction",
           &geometry::OrientNormalsToAlignWithDirection,
           "Function to orient the normals of a point cloud", "cloud"_a,
@@ -268,4 +298,82 @@ point is:
           "Computes the convex hull of the point cloud.", "input"_a);
     docstring::FunctionDocInject(m, "compute_point_cloud_convex_hull",
                                  {{"input", "The input point cloud."}});
+
+    m.def("cluster_dbscan", &geometry::ClusterDBSCAN,
+          "Clusters the point cloud with DBSCAN. Returns the cluster label of "
+          "every point, -1 for noise, and the size of every cluster.",
+          "input"_a, "eps"_a, "min_points"_a);
+    docstring::FunctionDocInject(
+            m, "cluster_dbscan",
+            {{"input", "The input point cloud."},
+             {"eps", "Radius of the neighbourhood of a point."},
+             {"min_points",
+              "Minimum number of points, the point included, within eps of a "
+              "core point."}});
+
+    m.def("cluster_euclidean", &geometry::ClusterEuclidean,
+          "Clusters the point cloud into the connected components of the "
+          "graph linking the points within tolerance of each other. Returns "
+          "the cluster label of every point, -1 for the points of rejected "
+          "clusters, and the size of every cluster.",
+          "input"_a, "tolerance"_a, "min_cluster_size"_a = 1,
+          "max_cluster_size"_a = std::numeric_limits<size_t>::max());
+    docstring::FunctionDocInject(
+            m, "cluster_euclidean",
+            {{"input", "The input point cloud."},
+             {"tolerance", "Maximum distance between neighbouring points."},
+             {"min_cluster_size", "Minimum number of points of a cluster."},
+             {"max_cluster_size", "Maximum number of points of a cluster."}});
+
+    m.def("segment_plane", &geometry::SegmentPlane,
+          "Segments the dominant plane of the point cloud with RANSAC. "
+          "Returns the plane (a, b, c, d) with a unit normal and the indices "
+          "of its inliers.",
+          "input"_a, "distance_threshold"_a, "max_iterations"_a = 1000,
+          "probability"_a = 0.9999, "refine"_a = true);
+    docstring::FunctionDocInject(
+            m, "segment_plane",
+            {{"input", "The input point cloud."},
+             {"distance_threshold",
+              "Maximum distance of an inlier to the plane."},
+             {"max_iterations", "Maximum number of RANSAC hypotheses."},
+             {"probability",
+              "Confidence of finding the best model before terminating."},
+             {"refine",
+              "Refit the model to its inliers by least squares."}});
+
+    m.def("segment_sphere", &geometry::SegmentSphere,
+          "Segments the dominant sphere of the point cloud with RANSAC. "
+          "Returns the sphere (cx, cy, cz, r) and the indices of its "
+          "inliers.",
+          "input"_a, "distance_threshold"_a, "max_iterations"_a = 1000,
+          "probability"_a = 0.9999, "refine"_a = true);
+    docstring::FunctionDocInject(
+            m, "segment_sphere",
+            {{"input", "The input point cloud."},
+             {"distance_threshold",
+              "Maximum distance of an inlier to the sphere."},
+             {"max_iterations", "Maximum number of RANSAC hypotheses."},
+             {"probability",
+              "Confidence of finding the best model before terminating."},
+             {"refine",
+              "Refit the model to its inliers by least squares."}});
+
+    m.def("segment_cylinder", &geometry::SegmentCylinder,
+          "Segments the dominant cylinder of the point cloud with RANSAC. "
+          "The point cloud must have normals. Returns the cylinder (px, py, "
+          "pz, dx, dy, dz, r), with a unit axis direction, and the indices of "
+          "its inliers.",
+          "input"_a, "distance_threshold"_a, "max_iterations"_a = 1000,
+          "probability"_a = 0.9999, "refine"_a = true);
+    docstring::FunctionDocInject(
+            m, "segment_cylinder",
+            {{"input", "The input point cloud."},
+             {"distance_threshold",
+              "Maximum distance of an inlier to the cylinder."},
+             {"max_iterations", "Maximum number of RANSAC hypotheses."},
+             {"probability",
+              "Confidence of finding the best model before terminating."},
+             {"refine",
+              "Refit the model to its inliers by least squares."}});
 }
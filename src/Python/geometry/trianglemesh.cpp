@@ -91,7 +91,8 @@ void pybind_trianglemesh(py::module &m) {
             .def("remove_duplicated_vertices",
                  &geometry::TriangleMesh::RemoveDuplicatedVertices,
                  "Function that removes duplicated verties, i.e., vertices "
-                 "that have identical coordinates.")
+                 "that have identical coordinates.",
+                 "eps"_a = 0.0)
             .def("remove_duplicated_triangles",
                  &geometry::TriangleMesh::RemoveDuplicatedTriangles,
                  "Function that removes duplicated triangles, i.e., removes "
@@ -281,8 +282,11 @@ void pybind_trianglemesh(py::module &m) {
             {{"other", "Other triangle mesh to test intersection with."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "is_orientable");
     docstring::ClassMethodDocInject(m, "TriangleMesh", "orient_triangles");
-    docstring::ClassMethodDocInject(m, "TriangleMesh",
-                                    "remove_duplicated_vertices");
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "remove_duplicated_vertices",
+            {{"eps",
+              "If larger than zero, vertices that fall into the same cell of "
+              "a grid with this spacing are merged."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "remove_duplicated_triangles");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
@@ -369,6 +373,24 @@ void pybind_trianglemesh_methods(py::module &m) {
               "Initial PointCloud that is used for sample elimination. If this "
               "parameter is provided the init_factor is ignored."}});
 
+    m.def("sample_points_poisson_disk_parallel",
+          &geometry::SamplePointsPoissonDiskParallel,
+          "Function to sample points from the mesh like "
+          "sample_points_poisson_disk, but with the sample elimination run "
+          "in parallel on a spatial grid.",
+          "input"_a, "number_of_points"_a, "init_factor"_a = 5,
+          "pcl"_a = nullptr);
+    docstring::FunctionDocInject(
+            m, "sample_points_poisson_disk_parallel",
+            {{"input", "The input triangle mesh."},
+             {"number_of_points", "Number of points that should be sampled."},
+             {"init_factor",
+              "Factor for the initial uniformly sampled PointCloud. This init "
+              "PointCloud is used for sample elimination."},
+             {"pcl",
+              "Initial PointCloud that is used for sample elimination. If this "
+              "parameter is provided the init_factor is ignored."}});
+
     m.def("subdivide_midpoint", &geometry::SubdivideMidpoint,
           "Function subdivide mesh using midpoint algorithm.", "input"_a,
           "number_of_iterations"_a = 1);
@@ -420,6 +442,14 @@ void pybind_trianglemesh_methods(py::module &m) {
     docstring::FunctionDocInject(m, "compute_mesh_convex_hull",
                                  {{"input", "The input triangle mesh."}});
 
+    m.def("cluster_connected_triangles", &geometry::ClusterConnectedTriangles,
+          "Labels the components of the triangle mesh connected by shared "
+          "edges. Returns the component label of every triangle and the "
+          "number of triangles of every component.",
+          "mesh"_a);
+    docstring::FunctionDocInject(m, "cluster_connected_triangles",
+                                 {{"mesh", "The input triangle mesh."}});
+
     m.def("create_mesh_box", &geometry::CreateMeshBox,
           "Factory function to create a box. The left bottom corner on the "
           "front will be placed at (0, 0, 0).",
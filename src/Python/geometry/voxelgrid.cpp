@@ -25,8 +25,11 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/Octree.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
 #include "Python/docstring.h"
 #include "Python/geometry/geometry.h"
 #include "Python/geometry/geometry_trampoline.h"
@@ -90,6 +93,36 @@ void pybind_voxelgrid(py::module &m) {
                  "Returns ``True`` if the voxel grid contains voxels.")
             .def("get_voxel", &geometry::VoxelGrid::GetVoxel, "point"_a,
                  "Returns voxel index given query point.")
+            .def("has_voxel", &geometry::VoxelGrid::HasVoxel, "grid_index"_a,
+                 "Returns ``True`` if there is a voxel at grid_index.")
+            .def("find_voxel", &geometry::VoxelGrid::FindVoxel,
+                 "grid_index"_a,
+                 "Returns the index in voxels of the voxel at grid_index, -1 "
+                 "if there is none.")
+            .def("add_voxel", &geometry::VoxelGrid::AddVoxel, "voxel"_a,
+                 "Adds a voxel, or overwrites the color of the existing voxel "
+                 "with the same grid index.")
+            .def("update_voxel_index", &geometry::VoxelGrid::UpdateVoxelIndex,
+                 "Rebuilds the hash index from grid index to voxel, needed "
+                 "after modifying the grid indices of voxels in place.")
+            .def("intersect", &geometry::VoxelGrid::Intersect, "voxel_grid"_a,
+                 "Keeps only the voxels that are also in voxel_grid.")
+            .def("subtract", &geometry::VoxelGrid::Subtract, "voxel_grid"_a,
+                 "Removes the voxels that are in voxel_grid.")
+            .def("dilate", &geometry::VoxelGrid::Dilate, "iterations"_a = 1,
+                 "Morphological dilation with the 6-neighborhood.")
+            .def("erode", &geometry::VoxelGrid::Erode, "iterations"_a = 1,
+                 "Morphological erosion with the 6-neighborhood.")
+            .def("carve_depth_map", &geometry::VoxelGrid::CarveDepthMap,
+                 "depth_map"_a, "camera_params"_a,
+                 "keep_voxels_outside_image"_a = true,
+                 "Removes the voxels in the free space in front of a float "
+                 "depth map.")
+            .def("carve_silhouette", &geometry::VoxelGrid::CarveSilhouette,
+                 "silhouette_mask"_a, "camera_params"_a,
+                 "keep_voxels_outside_image"_a = true,
+                 "Removes the voxels projecting outside of a silhouette "
+                 "mask.")
             .def("to_octree", &geometry::VoxelGrid::ToOctree, "max_depth"_a,
                  "Convert to Octree.")
             .def("from_octree", &geometry::VoxelGrid::FromOctree,
@@ -103,6 +136,39 @@ void pybind_voxelgrid(py::module &m) {
     docstring::ClassMethodDocInject(m, "VoxelGrid", "has_voxels");
     docstring::ClassMethodDocInject(m, "VoxelGrid", "get_voxel",
                                     {{"point", "The query point."}});
+    docstring::ClassMethodDocInject(m, "VoxelGrid", "has_voxel",
+                                    {{"grid_index", "The voxel grid index."}});
+    docstring::ClassMethodDocInject(m, "VoxelGrid", "find_voxel",
+                                    {{"grid_index", "The voxel grid index."}});
+    docstring::ClassMethodDocInject(m, "VoxelGrid", "add_voxel",
+                                    {{"voxel", "The voxel to add."}});
+    docstring::ClassMethodDocInject(m, "VoxelGrid", "update_voxel_index");
+    docstring::ClassMethodDocInject(
+            m, "VoxelGrid", "intersect",
+            {{"voxel_grid",
+              "Voxel grid with the same voxel_size and origin."}});
+    docstring::ClassMethodDocInject(
+            m, "VoxelGrid", "subtract",
+            {{"voxel_grid",
+              "Voxel grid with the same voxel_size and origin."}});
+    docstring::ClassMethodDocInject(
+            m, "VoxelGrid", "dilate",
+            {{"iterations", "Number of dilation steps."}});
+    docstring::ClassMethodDocInject(
+            m, "VoxelGrid", "erode",
+            {{"iterations", "Number of erosion steps."}});
+    docstring::ClassMethodDocInject(
+            m, "VoxelGrid", "carve_depth_map",
+            {{"depth_map", "Single channel float depth image in meters."},
+             {"camera_params", "Intrinsic and extrinsic camera parameters."},
+             {"keep_voxels_outside_image",
+              "Keep voxels that do not project into the image."}});
+    docstring::ClassMethodDocInject(
+            m, "VoxelGrid", "carve_silhouette",
+            {{"silhouette_mask", "Single channel uint8 mask, 0 is outside."},
+             {"camera_params", "Intrinsic and extrinsic camera parameters."},
+             {"keep_voxels_outside_image",
+              "Keep voxels that do not project into the image."}});
     docstring::ClassMethodDocInject(
             m, "VoxelGrid", "to_octree",
             {{"max_depth", "int: Maximum depth of the octree."}});
@@ -120,4 +186,21 @@ void pybind_voxelgrid_methods(py::module &m) {
             m, "create_surface_voxel_grid_from_point_cloud",
             {{"point_cloud", "The input point cloud."},
              {"voxel_size", "Voxel size of of the VoxelGrid construction."}});
+    m.def("create_surface_voxel_grid_from_triangle_mesh",
+          &geometry::CreateSurfaceVoxelGridFromTriangleMesh,
+          "Function to make voxels overlapped by the triangles of a mesh",
+          "mesh"_a, "voxel_size"_a);
+    docstring::FunctionDocInject(
+            m, "create_surface_voxel_grid_from_triangle_mesh",
+            {{"mesh", "The input triangle mesh."},
+             {"voxel_size", "Voxel size of of the VoxelGrid construction."}});
+    m.def("create_voxel_grid_from_triangle_mesh",
+          &geometry::CreateVoxelGridFromTriangleMesh,
+          "Function to make the voxels of the surface and the interior of a "
+          "watertight mesh",
+          "mesh"_a, "voxel_size"_a);
+    docstring::FunctionDocInject(
+            m, "create_voxel_grid_from_triangle_mesh",
+            {{"mesh", "The input triangle mesh."},
+             {"voxel_size", "Voxel size of of the VoxelGrid construction."}});
 }
@@ -26,7 +26,9 @@
 
 #include "Python/integration/integration.h"
 
+#include "Open3D/Geometry/DistanceField.h"
 #include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/Integration/OccupancyVolume.h"
 #include "Open3D/Integration/ScalableTSDFVolume.h"
 #include "Open3D/Integration/TSDFVolume.h"
 #include "Open3D/Integration/UniformTSDFVolume.h"
@@ -144,6 +146,10 @@ In SIGGRAPH, 1996)");
             .def("extract_voxel_grid",
                  &integration::UniformTSDFVolume::ExtractVoxelGrid,
                  "Debug function to extract the voxel data VoxelGrid.")
+            .def("extract_distance_field",
+                 &integration::UniformTSDFVolume::ExtractDistanceField,
+                 "Function to extract the full Euclidean signed distance "
+                 "field.")
             .def_readwrite("length", &integration::UniformTSDFVolume::length_,
                            "Total length, where ``voxel_length = length / "
                            "resolution``.")
@@ -153,6 +159,8 @@ In SIGGRAPH, 1996)");
                            "``voxel_length = length / resolution``");
     docstring::ClassMethodDocInject(m, "UniformTSDFVolume",
                                     "extract_voxel_point_cloud");
+    docstring::ClassMethodDocInject(m, "UniformTSDFVolume",
+                                    "extract_distance_field");
 
     // open3d.integration.ScalableTSDFVolume: open3d.integration.TSDFVolume
     py::class_<integration::ScalableTSDFVolume,
@@ -204,6 +212,70 @@ In SIGGRAPH, 2013)");
                  "cloud.");
     docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
                                     "extract_voxel_point_cloud");
+
+    // open3d.integration.OccupancyVolume
+    py::class_<integration::OccupancyVolume> occupancy_volume(
+            m, "OccupancyVolume", R"(Sparse probabilistic occupancy map
+storing the log-odds of occupancy per voxel. Depth images are integrated by
+casting a ray per pixel: the voxels crossed by the ray are updated as free,
+the voxel of the measured point as occupied.
+
+Ref: OctoMap: An Efficient Probabilistic 3D Mapping Framework Based on Octrees
+
+A. Hornung, K. M. Wurm, M. Bennewitz, C. Stachniss, and W. Burgard
+
+In Autonomous Robots, 2013)");
+    py::detail::bind_copy_functions<integration::OccupancyVolume>(
+            occupancy_volume);
+    occupancy_volume
+            .def(py::init<double, double, double, double, double, double,
+                          int>(),
+                 "voxel_length"_a, "max_range"_a = 5.0, "prob_hit"_a = 0.7,
+                 "prob_miss"_a = 0.4, "prob_min"_a = 0.12,
+                 "prob_max"_a = 0.97, "depth_sampling_stride"_a = 1)
+            .def("__repr__",
+                 [](const integration::OccupancyVolume &vol) {
+                     return std::string("integration::OccupancyVolume with ") +
+                            std::to_string(vol.log_odds_.size()) +
+                            " observed voxels.";
+                 })
+            .def("reset", &integration::OccupancyVolume::Reset,
+                 "Function to reset the integration::OccupancyVolume")
+            .def("integrate", &integration::OccupancyVolume::Integrate,
+                 "Function to integrate a float depth image into the volume",
+                 "depth"_a, "intrinsic"_a, "extrinsic"_a)
+            .def("extract_occupied",
+                 &integration::OccupancyVolume::ExtractOccupied,
+                 "Function to extract the occupied voxels into a VoxelGrid",
+                 "occupancy_threshold"_a = 0.5)
+            .def("get_occupancy_probability",
+                 &integration::OccupancyVolume::GetOccupancyProbability,
+                 "Returns the occupancy probability at a point, 0.5 if "
+                 "unobserved",
+                 "point"_a)
+            .def_readwrite("voxel_length",
+                           &integration::OccupancyVolume::voxel_length_,
+                           "float: Voxel size.")
+            .def_readwrite("max_range",
+                           &integration::OccupancyVolume::max_range_,
+                           "float: Maximum range of the integrated rays.")
+            .def_readwrite(
+                    "depth_sampling_stride",
+                    &integration::OccupancyVolume::depth_sampling_stride_,
+                    "int: Pixel stride of the integrated rays.");
+    docstring::ClassMethodDocInject(m, "OccupancyVolume", "reset");
+    docstring::ClassMethodDocInject(
+            m, "OccupancyVolume", "integrate",
+            {{"depth", "Float depth image in meters."},
+             {"intrinsic", "Pinhole camera intrinsic parameters."},
+             {"extrinsic", "Extrinsic parameters."}});
+    docstring::ClassMethodDocInject(
+            m, "OccupancyVolume", "extract_occupied",
+            {{"occupancy_threshold",
+              "Minimum occupancy probability of the extracted voxels."}});
+    docstring::ClassMethodDocInject(m, "OccupancyVolume",
+                                    "get_occupancy_probability",
+                                    {{"point", "The query point."}});
 }
 
 void pybind_integration_methods(py::module &m) {
@@ -38,6 +38,7 @@
 #include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "Open3D/IO/ClassIO/PoseGraphIO.h"
+#include "Open3D/IO/ClassIO/RGBDImageIO.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/IO/ClassIO/VoxelGridIO.h"
 #include "Python/docstring.h"
@@ -71,6 +72,18 @@ static const std::unordered_map<std::string, std::string>
                  "The ``PinholeCameraParameters`` object for I/O"},
                 {"pose_graph", "The ``PoseGraph`` object for I/O"},
                 {"feature", "The ``Feature`` object for I/O"},
+                // RGBD
+                {"color_filename", "Path to the color image file."},
+                {"depth_filename", "Path to the depth image file."},
+                {"depth_scale",
+                 "The ratio to scale depth values. The depth values will first "
+                 "be scaled and then truncated."},
+                {"depth_trunc",
+                 "Depth values larger than ``depth_trunc`` gets truncated to "
+                 "0. The depth values will first be scaled and then "
+                 "truncated."},
+                {"convert_rgb_to_intensity",
+                 "Whether to convert RGB image to intensity image."},
 };
 
 void pybind_io(py::module &m) {
@@ -167,6 +180,27 @@ void pybind_io(py::module &m) {
     docstring::FunctionDocInject(m_io, "write_triangle_mesh",
                                  map_shared_argument_docstrings);
 
+    m_io.def("simplify_vertex_clustering_from_ply",
+             &io::SimplifyVertexClusteringFromPLY,
+             "Function to simplify a PLY mesh that does not fit into memory "
+             "using vertex clustering, and write the result to file",
+             "input_filename"_a, "output_filename"_a, "voxel_size"_a,
+             "contraction"_a =
+                     geometry::TriangleMesh::SimplificationContraction::Average,
+             "write_ascii"_a = false, "compressed"_a = false);
+    docstring::FunctionDocInject(
+            m_io, "simplify_vertex_clustering_from_ply",
+            {{"input_filename", "Path to the input PLY file."},
+             {"output_filename", "Path to the simplified output mesh."},
+             {"voxel_size",
+              "The size of the voxel within vertices are pooled."},
+             {"contraction",
+              "Method to aggregate vertex information. Average computes a "
+              "simple average, Quadric minimizes the distance to the adjacent "
+              "planes."},
+             {"write_ascii", map_shared_argument_docstrings.at("write_ascii")},
+             {"compressed", map_shared_argument_docstrings.at("compressed")}});
+
     // open3d::geometry::VoxelGrid
     m_io.def("read_voxel_grid",
              [](const std::string &filename, const std::string &format) {
@@ -293,4 +327,35 @@ void pybind_io(py::module &m) {
              "pose_graph"_a);
     docstring::FunctionDocInject(m_io, "write_pose_graph",
                                  map_shared_argument_docstrings);
+
+    // open3d::geometry::RGBDImage
+    m_io.def("create_rgbd_image_from_files", &io::CreateRGBDImageFromFiles,
+             "Function to read a color and a depth image from file and "
+             "combine them into an RGBDImage",
+             "color_filename"_a, "depth_filename"_a, "depth_scale"_a = 1000.0,
+             "depth_trunc"_a = 3.0, "convert_rgb_to_intensity"_a = true);
+    docstring::FunctionDocInject(m_io, "create_rgbd_image_from_files",
+                                 map_shared_argument_docstrings);
+
+    py::class_<io::RGBDImageSequenceReader> rgbd_reader(
+            m_io, "RGBDImageSequenceReader",
+            "Reads a sequence of RGBDImages, decoding the frames ahead of "
+            "the consumer on worker threads.");
+    rgbd_reader
+            .def(py::init<const std::vector<std::string> &,
+                          const std::vector<std::string> &, double, double,
+                          bool, int, int>(),
+                 "color_filenames"_a, "depth_filenames"_a,
+                 "depth_scale"_a = 1000.0, "depth_trunc"_a = 3.0,
+                 "convert_rgb_to_intensity"_a = true,
+                 "num_of_frames_ahead"_a = 8, "num_of_threads"_a = 0)
+            .def("get_num_of_frames",
+                 &io::RGBDImageSequenceReader::GetNumOfFrames,
+                 "Returns the number of frames in the sequence.")
+            .def("has_next", &io::RGBDImageSequenceReader::HasNext,
+                 "Returns ``True`` if there are frames left to read.")
+            .def("read_next", &io::RGBDImageSequenceReader::ReadNext,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Returns the next frame, waiting for it to be decoded. "
+                 "Returns ``None`` past the end of the sequence.");
 }
@@ -292,3 +292,31 @@ TEST(PinholeCameraIntrinsic, ConvertToFromJsonValue) {
 
     ExpectEQ(reference, dst.intrinsic_matrix_);
 }
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PinholeCameraIntrinsic, Distortion) {
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    EXPECT_FALSE(intrinsic.HasDistortion());
+    ExpectEQ(Vector2d(0.3, -0.2),
+             intrinsic.DistortNormalizedPoint(Vector2d(0.3, -0.2)));
+
+    double k1 = -0.2, k2 = 0.05, p1 = 0.001, p2 = -0.002, k3 = 0.01;
+    intrinsic.SetDistortion(k1, k2, p1, p2, k3);
+    EXPECT_TRUE(intrinsic.HasDistortion());
+
+    double x = 0.3, y = -0.2;
+    double r2 = x * x + y * y;
+    double radial = 1.0 + k1 * r2 + k2 * r2 * r2 + k3 * r2 * r2 * r2;
+    Vector2d reference(x * radial + 2.0 * p1 * x * y + p2 * (r2 + 2.0 * x * x),
+                       y * radial + p1 * (r2 + 2.0 * y * y) + 2.0 * p2 * x * y);
+    ExpectEQ(reference, intrinsic.DistortNormalizedPoint(Vector2d(x, y)));
+
+    Json::Value value;
+    EXPECT_TRUE(intrinsic.ConvertToJsonValue(value));
+    camera::PinholeCameraIntrinsic dst;
+    EXPECT_TRUE(dst.ConvertFromJsonValue(value));
+    ExpectEQ(intrinsic.distortion_coefficients_, dst.distortion_coefficients_);
+}
@@ -0,0 +1,211 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <limits>
+
+#include "Open3D/Geometry/DistanceField.h"
+#include "Open3D/Geometry/VoxelGrid.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+/// Brute force distance in voxels from index to the closest of sites.
+double BruteForceDistance(const Eigen::Vector3i& index,
+                          const std::vector<Eigen::Vector3i>& sites) {
+    double distance = std::numeric_limits<double>::infinity();
+    for (const auto& site : sites) {
+        distance = std::min(distance,
+                            (index - site).cast<double>().norm());
+    }
+    return distance;
+}
+
+}  // namespace
+
+TEST(DistanceField, SquaredEuclideanDistanceTransform) {
+    const Eigen::Vector3i resolution(12, 9, 7);
+    std::vector<Eigen::Vector3i> sites(10);
+    Rand(sites, Eigen::Vector3i(0, 0, 0), Eigen::Vector3i(11, 8, 6), 0);
+    std::vector<float> grid(resolution.prod(),
+                            std::numeric_limits<float>::infinity());
+    geometry::DistanceField layout(Eigen::Vector3d::Zero(), 1.0, resolution);
+    for (const auto& site : sites) {
+        grid[layout.IndexOf(site)] = 0;
+    }
+    geometry::ComputeSquaredEuclideanDistanceTransform(grid, resolution);
+    for (int x = 0; x < resolution(0); x++) {
+        for (int y = 0; y < resolution(1); y++) {
+            for (int z = 0; z < resolution(2); z++) {
+                Eigen::Vector3i index(x, y, z);
+                double expected = BruteForceDistance(index, sites);
+                EXPECT_NEAR(grid[layout.IndexOf(index)], expected * expected,
+                            1e-4);
+            }
+        }
+    }
+
+    // Without sites, everything stays infinite.
+    std::fill(grid.begin(), grid.end(),
+              std::numeric_limits<float>::infinity());
+    geometry::ComputeSquaredEuclideanDistanceTransform(grid, resolution);
+    for (float value : grid) {
+        EXPECT_EQ(value, std::numeric_limits<float>::infinity());
+    }
+}
+
+TEST(DistanceField, CreateFromVoxelGrid) {
+    geometry::VoxelGrid voxel_grid;
+    voxel_grid.voxel_size_ = 0.1;
+    for (int x = -1; x <= 1; x++) {
+        for (int y = -1; y <= 1; y++) {
+            for (int z = -1; z <= 1; z++) {
+                voxel_grid.AddVoxel(geometry::Voxel(Eigen::Vector3i(x, y, z)));
+            }
+        }
+    }
+    auto field = geometry::CreateDistanceFieldFromVoxelGrid(voxel_grid, 4);
+    ExpectEQ(field->resolution_, Eigen::Vector3i(11, 11, 11));
+    ExpectEQ(field->origin_, Eigen::Vector3d(-0.5, -0.5, -0.5));
+
+    // Voxel centers: the center voxel is one voxel deep, the voxels around
+    // it lie on the boundary.
+    EXPECT_NEAR(field->GetDistance({0.05, 0.05, 0.05}), -0.15, 1e-6);
+    EXPECT_NEAR(field->GetDistance({0.15, 0.05, 0.05}), -0.05, 1e-6);
+    EXPECT_NEAR(field->GetDistance({0.25, 0.05, 0.05}), 0.05, 1e-6);
+    EXPECT_NEAR(field->GetDistance({0.45, 0.05, 0.05}), 0.25, 1e-6);
+    EXPECT_NEAR(field->GetDistance({0.35, 0.35, 0.05}),
+                0.1 * (std::sqrt(8.0) - 0.5), 1e-6);
+    // Interpolated between two voxel centers, and clamped outside.
+    EXPECT_NEAR(field->GetDistance({0.3, 0.05, 0.05}), 0.1, 1e-6);
+    EXPECT_NEAR(field->GetDistance({2.0, 0.05, 0.05}), 0.35, 1e-6);
+
+    Eigen::Vector3d gradient = field->GetGradient({0.3, 0.05, 0.05});
+    ExpectEQ(gradient, Eigen::Vector3d(1, 0, 0));
+    gradient = field->GetGradient({-0.3, 0.05, 0.05});
+    ExpectEQ(gradient, Eigen::Vector3d(-1, 0, 0));
+}
+
+TEST(DistanceField, CreateFromFarApartVoxels) {
+    auto create_field = [](const std::vector<Eigen::Vector3i>& indices,
+                           int padding) {
+        geometry::VoxelGrid voxel_grid;
+        voxel_grid.voxel_size_ = 0.01;
+        for (const Eigen::Vector3i& index : indices) {
+            voxel_grid.AddVoxel(geometry::Voxel(index));
+        }
+        return geometry::CreateDistanceFieldFromVoxelGrid(voxel_grid, padding);
+    };
+    // The bounding grid of two far apart voxels has 2^32 voxels, too many
+    // for a dense field.
+    EXPECT_TRUE(create_field({Eigen::Vector3i(0, 0, 0),
+                              Eigen::Vector3i(65535, 65535, 0)},
+                             0)
+                        ->IsEmpty());
+    // Also when only the padding makes it too large, or leaves the int range.
+    EXPECT_TRUE(create_field({Eigen::Vector3i(0, 0, 0)}, 1 << 20)->IsEmpty());
+    EXPECT_TRUE(create_field({Eigen::Vector3i(std::numeric_limits<int>::max(),
+                                              0, 0)},
+                             1)
+                        ->IsEmpty());
+    EXPECT_FALSE(create_field({Eigen::Vector3i(0, 0, 0),
+                               Eigen::Vector3i(1000, 1000, 0)},
+                              0)
+                         ->IsEmpty());
+
+    geometry::DistanceField too_large(Eigen::Vector3d::Zero(), 0.01,
+                                      Eigen::Vector3i(65536, 65536, 1));
+    EXPECT_TRUE(too_large.IsEmpty());
+    ExpectEQ(too_large.resolution_, Eigen::Vector3i(0, 0, 0));
+    too_large.ComputeSignedDistances(std::vector<uint8_t>());
+    EXPECT_TRUE(too_large.IsEmpty());
+}
+
+TEST(DistanceField, SparseDistanceField) {
+    const double voxel_size = 0.1;
+    const double max_distance = 0.6;
+    geometry::SparseDistanceField field(voxel_size, max_distance);
+    std::vector<Eigen::Vector3i> obstacles(30);
+    Rand(obstacles, Eigen::Vector3i(-10, -10, -10), Eigen::Vector3i(10, 10, 10),
+         0);
+    for (const auto& obstacle : obstacles) {
+        field.AddObstacle(obstacle);
+    }
+    field.Update();
+
+    auto check = [&](const std::vector<Eigen::Vector3i>& sites) {
+        for (int x = -12; x <= 12; x++) {
+            for (int y = -12; y <= 12; y++) {
+                for (int z = -12; z <= 12; z++) {
+                    Eigen::Vector3i index(x, y, z);
+                    double expected = std::min(
+                            BruteForceDistance(index, sites) * voxel_size,
+                            max_distance);
+                    Eigen::Vector3d center =
+                            (index.cast<double>().array() + 0.5) * voxel_size;
+                    EXPECT_NEAR(field.GetDistance(center), expected, 1e-5);
+                }
+            }
+        }
+    };
+    check(obstacles);
+
+    // Remove half of the obstacles.
+    std::vector<Eigen::Vector3i> remaining;
+    for (size_t i = 0; i < obstacles.size(); i++) {
+        if (i % 2 == 0) {
+            field.RemoveObstacle(obstacles[i]);
+        } else {
+            remaining.push_back(obstacles[i]);
+        }
+    }
+    field.Update();
+    check(remaining);
+    for (const auto& it : field.blocks_) {
+        for (const auto& cell : it.second.cells_) {
+            if (std::isfinite(cell.distance_)) {
+                EXPECT_LE(cell.distance_ * voxel_size, max_distance + 1e-6);
+            }
+        }
+    }
+
+    // Replace the obstacles through a voxel grid.
+    geometry::VoxelGrid voxel_grid;
+    voxel_grid.voxel_size_ = voxel_size;
+    voxel_grid.AddVoxel(geometry::Voxel(Eigen::Vector3i(0, 0, 0)));
+    field.SetObstacles(voxel_grid);
+    field.Update();
+    check({Eigen::Vector3i(0, 0, 0)});
+    // Only the blocks around the remaining obstacle are left.
+    EXPECT_EQ(field.blocks_.size(), 8u);
+    EXPECT_TRUE(field.IsObstacle(Eigen::Vector3i(0, 0, 0)));
+    Eigen::Vector3d gradient = field.GetGradient({0.25, 0.05, 0.05});
+    EXPECT_GT(gradient(0), 0);
+    EXPECT_NEAR(gradient(1), 0, 1e-6);
+}
@@ -270,6 +270,16 @@ TEST(HalfEdgeTriangleMesh, Constructor_TwoTrianglesInvalidVertex) {
                  std::runtime_error);  // Non-manifold
 }
 
+TEST(HalfEdgeTriangleMesh, Constructor_TwoTetrahedraSharedVertex) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0},  {1, 0, 0},  {0, 1, 0}, {0, 0, 1},
+                      {-1, 0, 0}, {0, -1, 0}, {0, 0, -1}};
+    mesh.triangles_ = {{0, 2, 1}, {0, 1, 3}, {0, 3, 2}, {1, 2, 3},
+                       {0, 5, 4}, {0, 4, 6}, {0, 6, 5}, {4, 5, 6}};
+    ASSERT_THROW(geometry::CreateHalfEdgeMeshFromMesh(mesh),
+                 std::runtime_error);  // Non-manifold vertex
+}
+
 TEST(HalfEdgeTriangleMesh, Constructor_Hexagon) {
     geometry::TriangleMesh mesh = get_mesh_hexagon();
     auto he_mesh = geometry::CreateHalfEdgeMeshFromMesh(mesh);
@@ -324,6 +334,39 @@ TEST(HalfEdgeTriangleMesh, OrderedHalfEdgesFromVertex_PartialHexagon) {
     assert_ordreded_neighbor(mesh, 6, {3});
 }
 
+TEST(HalfEdgeTriangleMesh, OneRingHalfEdges) {
+    auto mesh = geometry::CreateHalfEdgeMeshFromMesh(get_mesh_hexagon());
+    std::vector<int> neighbors;
+    for (int half_edge_index : mesh->OneRingHalfEdges(3)) {
+        EXPECT_EQ(mesh->half_edges_[half_edge_index].vertex_indices_(0), 3);
+        neighbors.push_back(
+                mesh->half_edges_[half_edge_index].vertex_indices_(1));
+    }
+    assert_vector_eq(neighbors, {0, 2, 5, 6, 4, 1}, true);
+
+    mesh = geometry::CreateHalfEdgeMeshFromMesh(get_mesh_partial_hexagon());
+    neighbors.clear();
+    for (int half_edge_index : mesh->OneRingHalfEdges(3)) {
+        neighbors.push_back(
+                mesh->half_edges_[half_edge_index].vertex_indices_(1));
+    }
+    assert_vector_eq(neighbors, {4, 1, 0, 2, 5});
+}
+
+TEST(HalfEdgeTriangleMesh, BoundaryLoopHalfEdges) {
+    auto mesh =
+            geometry::CreateHalfEdgeMeshFromMesh(get_mesh_partial_hexagon());
+    int first_half_edge_index = mesh->ordered_half_edge_from_vertex_[6][0];
+    std::vector<int> boundary;
+    for (int half_edge_index :
+         mesh->BoundaryLoopHalfEdges(first_half_edge_index)) {
+        EXPECT_TRUE(mesh->half_edges_[half_edge_index].IsBoundary());
+        boundary.push_back(
+                mesh->half_edges_[half_edge_index].vertex_indices_(0));
+    }
+    assert_vector_eq(boundary, {6, 3, 4, 1, 0, 2, 5});
+}
+
 TEST(HalfEdgeTriangleMesh, BoundaryHalfEdgesFromVertex_TwoTriangles) {
     auto mesh = geometry::CreateHalfEdgeMeshFromMesh(get_mesh_two_triangles());
     EXPECT_FALSE(mesh->IsEmpty());
@@ -507,6 +507,92 @@ TEST(Image, ConvertDepthToFloatImage) {
     ExpectEQ(ref, float_image->data_);
 }
 
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(Image, ConvertDepthToFloatImage_16bit) {
+    const int width = 37;
+    const int height = 11;
+    geometry::Image depth;
+    depth.PrepareImage(width, height, 1, 2);
+    uint16_t* data = reinterpret_cast<uint16_t*>(depth.data_.data());
+    for (int i = 0; i < width * height; i++) {
+        data[i] = uint16_t((i * 7919) % 65536);
+    }
+
+    const double parameters[][2] = {
+            {1000.0, 3.0}, {5000.0, 4.0}, {1000.0, 1000.0}, {1000.0, 3.0}};
+    for (const auto& parameter : parameters) {
+        auto output = geometry::ConvertDepthToFloatImage(depth, parameter[0],
+                                                         parameter[1]);
+        ASSERT_EQ(width, output->width_);
+        ASSERT_EQ(height, output->height_);
+        ASSERT_EQ(4, output->bytes_per_channel_);
+        const float* po = reinterpret_cast<const float*>(output->data_.data());
+        for (int i = 0; i < width * height; i++) {
+            float ref = (float)data[i];
+            ref /= (float)parameter[0];
+            if (ref >= parameter[1]) ref = 0.0f;
+            EXPECT_EQ(ref, po[i]);
+        }
+    }
+
+    // Into a region of a larger image.
+    geometry::Image output;
+    output.PrepareImage(width + 4, height + 2, 1, 4);
+    auto region = geometry::CreateImageView<float>(output).Region(
+            2, 1, width, height);
+    EXPECT_TRUE(geometry::ConvertDepthToFloatImage(
+            geometry::CreateImageView<uint16_t>(depth), region));
+    auto ref = geometry::ConvertDepthToFloatImage(depth);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            EXPECT_EQ(*geometry::PointerAt<float>(*ref, u, v), region(u, v));
+        }
+    }
+    EXPECT_EQ(0.0f, *geometry::PointerAt<float>(output, 1, 1));
+    EXPECT_FALSE(geometry::ConvertDepthToFloatImage(
+            geometry::CreateImageView<uint16_t>(depth),
+            geometry::CreateImageView<float>(output)));
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(Image, ConvertColorToIntensity) {
+    const int width = 29;
+    const int height = 7;
+    geometry::Image color;
+    color.PrepareImage(width, height, 3, 1);
+    Rand(color.data_, 0, 255, 0);
+    geometry::Image output;
+    output.PrepareImage(width, height, 1, 4);
+    const float* po = reinterpret_cast<const float*>(output.data_.data());
+    const uint8_t* pi = color.data_.data();
+
+    EXPECT_TRUE(geometry::ConvertColorToIntensity(
+            geometry::CreateImageView<uint8_t, 3>(color),
+            geometry::CreateImageView<float>(output),
+            ConversionType::Weighted));
+    for (int i = 0; i < width * height; i++) {
+        float ref = (0.2990f * (float)(pi[3 * i]) +
+                     0.5870f * (float)(pi[3 * i + 1]) +
+                     0.1140f * (float)(pi[3 * i + 2])) /
+                    255.0f;
+        EXPECT_EQ(ref, po[i]);
+    }
+
+    EXPECT_TRUE(geometry::ConvertColorToIntensity(
+            geometry::CreateImageView<uint8_t, 3>(color),
+            geometry::CreateImageView<float>(output), ConversionType::Equal));
+    for (int i = 0; i < width * height; i++) {
+        float ref = ((float)(pi[3 * i]) + (float)(pi[3 * i + 1]) +
+                     (float)(pi[3 * i + 2])) /
+                    3.0f / 255.0f;
+        EXPECT_EQ(ref, po[i]);
+    }
+}
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -1015,3 +1101,398 @@ TEST(Image, CreateImagePyramid) {
         expected_height /= 2;
     }
 }
+
+// ----------------------------------------------------------------------------
+// Random depth image with a fraction of invalid (zero) pixels.
+// ----------------------------------------------------------------------------
+shared_ptr<geometry::Image> CreateRandomDepthImage(int width,
+                                                   int height,
+                                                   double invalid_ratio,
+                                                   int seed) {
+    auto depth = make_shared<geometry::Image>();
+    depth->PrepareImage(width, height, 1, 4);
+    float* const data = reinterpret_cast<float*>(depth->data_.data());
+    Rand(data, width * height, 1.0f, 2.0f, seed);
+    vector<float> mask(width * height);
+    Rand(mask.data(), mask.size(), 0.0f, 1.0f, seed + 1);
+    for (int i = 0; i < width * height; i++) {
+        if (mask[i] < invalid_ratio) {
+            data[i] = 0.0f;
+        }
+    }
+    return depth;
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(Image, MedianFilterDepthImage) {
+    int width = 23;
+    int height = 17;
+    auto depth = CreateRandomDepthImage(width, height, 0.2, 0);
+
+    for (int kernel_size : {3, 5}) {
+        auto output = geometry::MedianFilterDepthImage(*depth, kernel_size);
+        ASSERT_EQ(width, output->width_);
+        ASSERT_EQ(height, output->height_);
+
+        int half = kernel_size / 2;
+        for (int v = 0; v < height; v++) {
+            for (int u = 0; u < width; u++) {
+                float center = *geometry::PointerAt<float>(*depth, u, v);
+                float ref = 0.0f;
+                if (center > 0.0f) {
+                    vector<float> values;
+                    for (int dv = -half; dv <= half; dv++) {
+                        for (int du = -half; du <= half; du++) {
+                            int uu = min(max(u + du, 0), width - 1);
+                            int vv = min(max(v + dv, 0), height - 1);
+                            float d = *geometry::PointerAt<float>(*depth, uu,
+                                                                  vv);
+                            if (d > 0.0f) values.push_back(d);
+                        }
+                    }
+                    sort(values.begin(), values.end());
+                    ref = values[values.size() / 2];
+                }
+                EXPECT_EQ(ref, *geometry::PointerAt<float>(*output, u, v));
+            }
+        }
+    }
+
+    EXPECT_TRUE(geometry::MedianFilterDepthImage(*depth, 7)->IsEmpty());
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(Image, BilateralFilterDepthImage) {
+    // A step from 1 to 2 at u = 8, noise, and a hole.
+    int width = 16;
+    int height = 12;
+    geometry::Image depth;
+    depth.PrepareImage(width, height, 1, 4);
+    vector<float> noise(width * height);
+    Rand(noise.data(), noise.size(), -0.005f, 0.005f, 0);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *geometry::PointerAt<float>(depth, u, v) =
+                    (u < 8 ? 1.0f : 2.0f) + noise[v * width + u];
+        }
+    }
+    *geometry::PointerAt<float>(depth, 3, 4) = 0.0f;
+
+    auto output = geometry::BilateralFilterDepthImage(depth, 2, 1.5, 0.03);
+    ASSERT_EQ(width, output->width_);
+    ASSERT_EQ(height, output->height_);
+
+    double noise_in = 0.0;
+    double noise_out = 0.0;
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            float d = *geometry::PointerAt<float>(*output, u, v);
+            if (u == 3 && v == 4) {
+                EXPECT_EQ(0.0f, d);
+                continue;
+            }
+            // The edge is preserved.
+            float step = u < 8 ? 1.0f : 2.0f;
+            EXPECT_NEAR(step, d, 0.005);
+            noise_in += abs(*geometry::PointerAt<float>(depth, u, v) - step);
+            noise_out += abs(d - step);
+        }
+    }
+    EXPECT_GT(0.6 * noise_in, noise_out);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(Image, FillDepthImageHoles) {
+    int width = 31;
+    int height = 19;
+    double max_distance = 3.0;
+    auto depth = CreateRandomDepthImage(width, height, 0.9, 0);
+
+    auto output = geometry::FillDepthImageHoles(*depth, max_distance);
+    ASSERT_EQ(width, output->width_);
+    ASSERT_EQ(height, output->height_);
+
+    int num_filled = 0;
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            float d = *geometry::PointerAt<float>(*depth, u, v);
+            float filled = *geometry::PointerAt<float>(*output, u, v);
+            if (d > 0.0f) {
+                EXPECT_EQ(d, filled);
+                continue;
+            }
+            // The fill is one of the nearest valid pixels.
+            int best = numeric_limits<int>::max();
+            vector<float> candidates;
+            for (int vv = 0; vv < height; vv++) {
+                for (int uu = 0; uu < width; uu++) {
+                    float dd = *geometry::PointerAt<float>(*depth, uu, vv);
+                    if (dd <= 0.0f) continue;
+                    int d2 = (uu - u) * (uu - u) + (vv - v) * (vv - v);
+                    if (d2 < best) {
+                        best = d2;
+                        candidates.clear();
+                    }
+                    if (d2 == best) candidates.push_back(dd);
+                }
+            }
+            if (best > max_distance * max_distance) {
+                EXPECT_EQ(0.0f, filled);
+            } else {
+                EXPECT_NE(candidates.end(), find(candidates.begin(),
+                                                 candidates.end(), filled));
+                num_filled++;
+            }
+        }
+    }
+    EXPECT_LT(0, num_filled);
+
+    // In place.
+    auto view = geometry::CreateImageView<float>(*depth);
+    EXPECT_TRUE(geometry::FillDepthImageHoles(view, view, max_distance));
+    ExpectEQ(output->data_, depth->data_);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(Image, ResizeImage) {
+    using InterpolationType = geometry::Image::InterpolationType;
+
+    // Area downsampling by 2 averages 2x2 blocks. The images are wider than
+    // a resampling tile.
+    geometry::Image image;
+    image.PrepareImage(320, 20, 1, 4);
+    float *const float_data = reinterpret_cast<float *>(image.data_.data());
+    Rand(float_data, image.width_ * image.height_, 0.0f, 1.0f, 0);
+    auto area = geometry::ResizeImage(image, 160, 10, InterpolationType::Area);
+    auto downsampled = geometry::DownsampleImage(image);
+    ASSERT_EQ(160, area->width_);
+    ASSERT_EQ(10, area->height_);
+    for (int v = 0; v < 10; v++) {
+        for (int u = 0; u < 160; u++) {
+            EXPECT_NEAR(*geometry::PointerAt<float>(*downsampled, u, v),
+                        *geometry::PointerAt<float>(*area, u, v),
+                        THRESHOLD_1E_6);
+        }
+    }
+
+    // Bilinear upsampling of a linear ramp is exact, pixel centers aligned.
+    int width = 150;
+    int height = 12;
+    image.PrepareImage(width, height, 1, 4);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *geometry::PointerAt<float>(image, u, v) = 0.5f * u + 2.0f * v;
+        }
+    }
+    auto bilinear = geometry::ResizeImage(image, 2 * width, 2 * height);
+    ASSERT_EQ(2 * width, bilinear->width_);
+    ASSERT_EQ(2 * height, bilinear->height_);
+    for (int v = 0; v < 2 * height; v++) {
+        for (int u = 0; u < 2 * width; u++) {
+            double x = min(max((u + 0.5) / 2.0 - 0.5, 0.0), width - 1.0);
+            double y = min(max((v + 0.5) / 2.0 - 0.5, 0.0), height - 1.0);
+            EXPECT_NEAR(0.5 * x + 2.0 * y,
+                        *geometry::PointerAt<float>(*bilinear, u, v), 1e-4);
+        }
+    }
+
+    // Nearest downsampling by 2 picks the bottom right pixel of 2x2 blocks.
+    image.PrepareImage(300, 6, 1, 2);
+    Rand(image.data_, 0, 255, 0);
+    auto halved = geometry::ResizeImage(image, 150, 3,
+                                        InterpolationType::Nearest);
+    ASSERT_EQ(150, halved->width_);
+    ASSERT_EQ(3, halved->height_);
+    for (int v = 0; v < 3; v++) {
+        for (int u = 0; u < 150; u++) {
+            EXPECT_EQ(*geometry::PointerAt<uint16_t>(image, 2 * u + 1,
+                                                     2 * v + 1),
+                      *geometry::PointerAt<uint16_t>(*halved, u, v));
+        }
+    }
+
+    // Nearest picks the input pixel under the output pixel center.
+    image.PrepareImage(13, 9, 3, 2);
+    Rand(image.data_, 0, 255, 0);
+    auto nearest = geometry::ResizeImage(image, 5, 7,
+                                         InterpolationType::Nearest);
+    ASSERT_EQ(3, nearest->num_of_channels_);
+    ASSERT_EQ(2, nearest->bytes_per_channel_);
+    for (int v = 0; v < 7; v++) {
+        for (int u = 0; u < 5; u++) {
+            int uu = int((u + 0.5) * 13.0 / 5.0);
+            int vv = int((v + 0.5) * 9.0 / 7.0);
+            for (int ch = 0; ch < 3; ch++) {
+                EXPECT_EQ(*geometry::PointerAt<uint16_t>(image, uu, vv, ch),
+                          *geometry::PointerAt<uint16_t>(*nearest, u, v, ch));
+            }
+        }
+    }
+
+    // Resizing to the same size is the identity.
+    image.PrepareImage(17, 11, 3, 1);
+    Rand(image.data_, 0, 255, 0);
+    for (auto type : {InterpolationType::Nearest, InterpolationType::Bilinear,
+                      InterpolationType::Area}) {
+        auto output = geometry::ResizeImage(image, 17, 11, type);
+        ExpectEQ(image.data_, output->data_);
+    }
+
+    image.PrepareImage(17, 11, 2, 1);
+    EXPECT_TRUE(geometry::ResizeImage(image, 8, 5)->IsEmpty());
+    EXPECT_TRUE(geometry::ResizeImage(image, 0, 5)->IsEmpty());
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(Image, RemapImage) {
+    using InterpolationType = geometry::Image::InterpolationType;
+
+    int width = 150;
+    int height = 40;
+    geometry::Image map;
+    map.PrepareImage(width, height, 2, 4);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *geometry::PointerAt<float>(map, u, v, 0) = u + 0.5f;
+            *geometry::PointerAt<float>(map, u, v, 1) = v + 0.25f;
+        }
+    }
+
+    geometry::Image image;
+    image.PrepareImage(width, height, 1, 4);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *geometry::PointerAt<float>(image, u, v) = 0.5f * u + 2.0f * v;
+        }
+    }
+    auto output = geometry::RemapImage(image, map);
+    ASSERT_EQ(width, output->width_);
+    ASSERT_EQ(height, output->height_);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            // Coordinates in the border half pixels are clamped to the edge.
+            float ref = 0.5f * min(u + 0.5f, width - 1.0f) +
+                        2.0f * min(v + 0.25f, height - 1.0f);
+            EXPECT_NEAR(ref, *geometry::PointerAt<float>(*output, u, v), 1e-4);
+        }
+    }
+
+    // Pixels mapped further than half a pixel out of the input are set to 0.
+    geometry::Image border_map;
+    border_map.PrepareImage(4, 1, 2, 4);
+    vector<Vector2f> coordinates = {{-0.5f, -0.5f},
+                                    {-0.51f, 0.0f},
+                                    {width - 0.5f, height - 0.5f},
+                                    {width - 0.49f, 0.0f}};
+    for (int u = 0; u < 4; u++) {
+        *geometry::PointerAt<float>(border_map, u, 0, 0) = coordinates[u](0);
+        *geometry::PointerAt<float>(border_map, u, 0, 1) = coordinates[u](1);
+    }
+    for (auto type :
+         {InterpolationType::Nearest, InterpolationType::Bilinear}) {
+        output = geometry::RemapImage(image, border_map, type);
+        EXPECT_EQ(*geometry::PointerAt<float>(image, 0, 0),
+                  *geometry::PointerAt<float>(*output, 0, 0));
+        EXPECT_EQ(0.0f, *geometry::PointerAt<float>(*output, 1, 0));
+        EXPECT_EQ(*geometry::PointerAt<float>(image, width - 1, height - 1),
+                  *geometry::PointerAt<float>(*output, 2, 0));
+        EXPECT_EQ(0.0f, *geometry::PointerAt<float>(*output, 3, 0));
+    }
+
+    // An integer map reproduces the input, whatever the interpolation.
+    image.PrepareImage(width, height, 3, 1);
+    Rand(image.data_, 0, 255, 0);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *geometry::PointerAt<float>(map, u, v, 0) = float(u);
+            *geometry::PointerAt<float>(map, u, v, 1) = float(v);
+        }
+    }
+    *geometry::PointerAt<float>(map, 3, 2, 0) =
+            numeric_limits<float>::quiet_NaN();
+    for (auto type :
+         {InterpolationType::Nearest, InterpolationType::Bilinear}) {
+        output = geometry::RemapImage(image, map, type);
+        for (int v = 0; v < height; v++) {
+            for (int u = 0; u < width; u++) {
+                for (int ch = 0; ch < 3; ch++) {
+                    EXPECT_EQ(u == 3 && v == 2
+                                      ? 0
+                                      : *geometry::PointerAt<uint8_t>(
+                                                image, u, v, ch),
+                              *geometry::PointerAt<uint8_t>(*output, u, v,
+                                                            ch));
+                }
+            }
+        }
+    }
+
+    EXPECT_TRUE(geometry::RemapImage(image, map, InterpolationType::Area)
+                        ->IsEmpty());
+    EXPECT_TRUE(geometry::RemapImage(image, image)->IsEmpty());
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(Image, CreateUndistortionMap) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 55.0, 31.5, 24.0);
+
+    // Without distortion, the map is the identity.
+    auto map = geometry::CreateUndistortionMap(intrinsic);
+    ASSERT_EQ(64, map->width_);
+    ASSERT_EQ(48, map->height_);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            EXPECT_NEAR(u, *geometry::PointerAt<float>(*map, u, v, 0), 1e-4);
+            EXPECT_NEAR(v, *geometry::PointerAt<float>(*map, u, v, 1), 1e-4);
+        }
+    }
+
+    // With distortion, the map projects the distorted normalized points.
+    intrinsic.SetDistortion(-0.2, 0.05, 0.001, -0.002, 0.01);
+    camera::PinholeCameraIntrinsic undistorted(32, 24, 25.0, 25.0, 16.0,
+                                               12.0);
+    map = geometry::CreateUndistortionMap(intrinsic, undistorted);
+    ASSERT_EQ(32, map->width_);
+    ASSERT_EQ(24, map->height_);
+    for (int v = 0; v < 24; v++) {
+        for (int u = 0; u < 32; u++) {
+            Vector2d p = intrinsic.DistortNormalizedPoint(
+                    Vector2d((u - 16.0) / 25.0, (v - 12.0) / 25.0));
+            EXPECT_NEAR(50.0 * p(0) + 31.5,
+                        *geometry::PointerAt<float>(*map, u, v, 0), 1e-4);
+            EXPECT_NEAR(55.0 * p(1) + 24.0,
+                        *geometry::PointerAt<float>(*map, u, v, 1), 1e-4);
+        }
+    }
+
+    geometry::Image image;
+    image.PrepareImage(64, 48, 1, 2);
+    Rand(image.data_, 0, 255, 0);
+    auto output = geometry::UndistortImage(
+            image, intrinsic, geometry::Image::InterpolationType::Nearest);
+    ExpectEQ(geometry::RemapImage(
+                     image, *geometry::CreateUndistortionMap(intrinsic),
+                     geometry::Image::InterpolationType::Nearest)
+                     ->data_,
+             output->data_);
+
+    image.PrepareImage(32, 24, 1, 2);
+    EXPECT_TRUE(geometry::UndistortImage(image, intrinsic)->IsEmpty());
+
+    camera::PinholeCameraIntrinsic invalid;
+    EXPECT_TRUE(
+            geometry::CreateUndistortionMap(invalid, undistorted)->IsEmpty());
+    EXPECT_TRUE(geometry::CreateUndistortionMap(intrinsic, invalid)->IsEmpty());
+}
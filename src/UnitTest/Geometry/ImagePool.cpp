@@ -0,0 +1,200 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/ImagePool.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImagePool, Acquire) {
+    geometry::ImagePool pool;
+
+    auto image = pool.Acquire(5, 3, 2, 4);
+
+    EXPECT_EQ(5, image->width_);
+    EXPECT_EQ(3, image->height_);
+    EXPECT_EQ(2, image->num_of_channels_);
+    EXPECT_EQ(4, image->bytes_per_channel_);
+    ExpectEQ(vector<uint8_t>(5 * 3 * 2 * 4, 0), image->data_);
+
+    auto statistics = pool.GetStatistics();
+    EXPECT_EQ(1u, statistics.num_of_requests_);
+    EXPECT_EQ(0u, statistics.num_of_hits_);
+    EXPECT_EQ(0u, statistics.num_of_cached_images_);
+    EXPECT_EQ(0.0, statistics.GetHitRate());
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImagePool, Recycle) {
+    geometry::ImagePool pool;
+
+    auto image = pool.Acquire(5, 3, 1, 4);
+    const uint8_t* data = image->data_.data();
+    Rand(image->data_, 1, 255, 0);
+    vector<uint8_t> pixels = image->data_;
+    image.reset();
+
+    auto statistics = pool.GetStatistics();
+    EXPECT_EQ(1u, statistics.num_of_cached_images_);
+    EXPECT_EQ(5u * 3u * 4u, statistics.cached_bytes_);
+
+    image = pool.Acquire(5, 3, 1, 4, false);
+    EXPECT_EQ(data, image->data_.data());
+    ExpectEQ(pixels, image->data_);
+    image.reset();
+
+    image = pool.Acquire(5, 3, 1, 4);
+    EXPECT_EQ(data, image->data_.data());
+    ExpectEQ(vector<uint8_t>(5 * 3 * 4, 0), image->data_);
+
+    statistics = pool.GetStatistics();
+    EXPECT_EQ(3u, statistics.num_of_requests_);
+    EXPECT_EQ(2u, statistics.num_of_hits_);
+    EXPECT_EQ(0u, statistics.num_of_cached_images_);
+    EXPECT_EQ(0u, statistics.cached_bytes_);
+    EXPECT_NEAR(2.0 / 3.0, statistics.GetHitRate(), THRESHOLD_1E_6);
+
+    pool.ResetStatistics();
+    statistics = pool.GetStatistics();
+    EXPECT_EQ(0u, statistics.num_of_requests_);
+    EXPECT_EQ(0u, statistics.num_of_hits_);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImagePool, Format) {
+    geometry::ImagePool pool;
+
+    pool.Acquire(4, 3, 1, 4).reset();
+    auto transposed = pool.Acquire(3, 4, 1, 4);
+    auto rgba = pool.Acquire(4, 3, 4, 1);
+    auto half = pool.Acquire(4, 3, 1, 2);
+    EXPECT_EQ(0u, pool.GetStatistics().num_of_hits_);
+
+    // Images are recycled under the format they have when given back.
+    half->PrepareImage(4, 3, 1, 4);
+    half.reset();
+    EXPECT_EQ(2u, pool.GetStatistics().num_of_cached_images_);
+    transposed->Clear();
+    transposed.reset();
+    EXPECT_EQ(2u, pool.GetStatistics().num_of_cached_images_);
+    auto image0 = pool.Acquire(4, 3, 1, 4);
+    auto image1 = pool.Acquire(4, 3, 1, 4);
+    EXPECT_EQ(2u, pool.GetStatistics().num_of_hits_);
+    EXPECT_EQ(0u, pool.GetStatistics().num_of_cached_images_);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImagePool, MaxCachedBytes) {
+    geometry::ImagePool pool(100);
+    EXPECT_EQ(100u, pool.GetMaxCachedBytes());
+
+    auto image0 = pool.Acquire(4, 3, 1, 4);
+    auto image1 = pool.Acquire(4, 3, 1, 4);
+    auto image2 = pool.Acquire(4, 3, 1, 4);
+    image0.reset();
+    image1.reset();
+    image2.reset();
+
+    auto statistics = pool.GetStatistics();
+    EXPECT_EQ(2u, statistics.num_of_cached_images_);
+    EXPECT_EQ(96u, statistics.cached_bytes_);
+    EXPECT_EQ(1u, statistics.num_of_discards_);
+
+    pool.SetMaxCachedBytes(50);
+    statistics = pool.GetStatistics();
+    EXPECT_EQ(1u, statistics.num_of_cached_images_);
+    EXPECT_EQ(48u, statistics.cached_bytes_);
+
+    pool.Clear();
+    statistics = pool.GetStatistics();
+    EXPECT_EQ(0u, statistics.num_of_cached_images_);
+    EXPECT_EQ(0u, statistics.cached_bytes_);
+
+    pool.SetMaxCachedBytes(0);
+    pool.Acquire(4, 3, 1, 4).reset();
+    EXPECT_EQ(0u, pool.GetStatistics().num_of_cached_images_);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImagePool, OutlivePool) {
+    shared_ptr<geometry::Image> image;
+    {
+        geometry::ImagePool pool;
+        image = pool.Acquire(4, 3, 1, 4);
+    }
+    EXPECT_EQ(4 * 3 * 4, (int)image->data_.size());
+    image.reset();
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImagePool, Factories) {
+    auto& pool = geometry::GetImagePool();
+    pool.Clear();
+    pool.ResetStatistics();
+
+    geometry::Image image;
+    image.PrepareImage(16, 12, 1, 4);
+    Rand(reinterpret_cast<float*>(image.data_.data()), 16 * 12, 0.0f, 1.0f,
+         0);
+
+    auto first = geometry::FilterImage(image,
+                                       geometry::Image::FilterType::Gaussian3);
+    ExpectEQ(first->data_,
+             geometry::FilterImage(image,
+                                   geometry::Image::FilterType::Gaussian3)
+                     ->data_);
+    vector<uint8_t> pixels = first->data_;
+    first.reset();
+    auto second = geometry::FilterImage(image,
+                                        geometry::Image::FilterType::Gaussian3);
+    ExpectEQ(pixels, second->data_);
+
+    auto statistics = pool.GetStatistics();
+    EXPECT_EQ(3u, statistics.num_of_requests_);
+    EXPECT_EQ(1u, statistics.num_of_hits_);
+
+    auto pyramid = geometry::CreateImagePyramid(image, 3);
+    pyramid.clear();
+    pyramid = geometry::CreateImagePyramid(image, 3);
+    statistics = pool.GetStatistics();
+    EXPECT_EQ(9u, statistics.num_of_requests_);
+    EXPECT_EQ(5u, statistics.num_of_hits_);
+}
@@ -0,0 +1,285 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/ImageView.h"
+#include "Open3D/Geometry/Image.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+using FilterType = geometry::Image::FilterType;
+
+namespace {
+
+shared_ptr<geometry::Image> CreateRandomFloatImage(int width,
+                                                   int height,
+                                                   int seed) {
+    auto image = make_shared<geometry::Image>();
+    image->PrepareImage(width, height, 1, 4);
+    float* data = reinterpret_cast<float*>(image->data_.data());
+    Rand(data, width * height, 0.0f, 1.0f, seed);
+    return image;
+}
+
+}  // unnamed namespace
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImageView, DefaultConstructor) {
+    geometry::ImageView<float> view;
+
+    EXPECT_TRUE(view.IsEmpty());
+    EXPECT_EQ(nullptr, view.data_);
+    EXPECT_EQ(0, view.width_);
+    EXPECT_EQ(0, view.height_);
+    EXPECT_EQ(0, view.stride_);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImageView, CreateImageView) {
+    geometry::Image image;
+    image.PrepareImage(4, 3, 3, 2);
+    Rand(image.data_, 0, 255, 0);
+
+    auto view = geometry::CreateImageView<uint16_t, 3>(image);
+    EXPECT_FALSE(view.IsEmpty());
+    EXPECT_TRUE(view.IsContiguous());
+    EXPECT_EQ(4, view.width_);
+    EXPECT_EQ(3, view.height_);
+    EXPECT_EQ(image.BytesPerLine(), view.stride_);
+    for (int v = 0; v < 3; v++) {
+        for (int u = 0; u < 4; u++) {
+            for (int ch = 0; ch < 3; ch++) {
+                EXPECT_EQ(geometry::PointerAt<uint16_t>(image, u, v, ch),
+                          &view(u, v, ch));
+            }
+        }
+    }
+
+    // Views write through to the image.
+    view(1, 2, 1) = 12345;
+    EXPECT_EQ(12345, *geometry::PointerAt<uint16_t>(image, 1, 2, 1));
+
+    const geometry::Image& const_image = image;
+    geometry::ImageView<const uint16_t, 3> const_view =
+            geometry::CreateImageView<uint16_t, 3>(const_image);
+    EXPECT_EQ(12345, const_view(1, 2, 1));
+
+    // Mismatching formats give empty views.
+    EXPECT_TRUE((geometry::CreateImageView<float>(image).IsEmpty()));
+    EXPECT_TRUE((geometry::CreateImageView<uint16_t, 1>(image).IsEmpty()));
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImageView, Region) {
+    auto image = CreateRandomFloatImage(8, 6, 0);
+    auto view = geometry::CreateImageView<float>(*image);
+
+    auto region = view.Region(2, 1, 5, 4);
+    EXPECT_FALSE(region.IsContiguous());
+    EXPECT_EQ(5, region.width_);
+    EXPECT_EQ(4, region.height_);
+    EXPECT_EQ(view.stride_, region.stride_);
+    for (int v = 0; v < 4; v++) {
+        for (int u = 0; u < 5; u++) {
+            EXPECT_EQ(view.At(u + 2, v + 1), region.At(u, v));
+        }
+    }
+
+    auto copy = geometry::CreateImageFromImageView(region);
+    EXPECT_EQ(5, copy->width_);
+    EXPECT_EQ(4, copy->height_);
+    EXPECT_EQ(1, copy->num_of_channels_);
+    EXPECT_EQ(4, copy->bytes_per_channel_);
+    for (int v = 0; v < 4; v++) {
+        for (int u = 0; u < 5; u++) {
+            EXPECT_EQ(region(u, v), *geometry::PointerAt<float>(*copy, u, v));
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImageView, ExternalBuffer) {
+    // Rows padded to 7 floats, as a driver could allocate them.
+    int width = 5;
+    int height = 4;
+    int padded_width = 7;
+    vector<float> buffer(padded_width * height, -1.0f);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            buffer[v * padded_width + u] = float(v * width + u);
+        }
+    }
+
+    geometry::ImageView<float> view(buffer.data(), width, height,
+                                    padded_width * sizeof(float));
+    EXPECT_FALSE(view.IsContiguous());
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            EXPECT_EQ(float(v * width + u), view(u, v));
+        }
+    }
+
+    auto copy = geometry::CreateImageFromImageView(view);
+    auto ref = geometry::CreateImageView<float>(*copy);
+    EXPECT_TRUE(ref.IsContiguous());
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            EXPECT_EQ(view(u, v), ref(u, v));
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImageView, FilterImage) {
+    auto image = CreateRandomFloatImage(16, 12, 0);
+    auto region = geometry::CreateImageView<float>(*image).Region(3, 2, 9, 7);
+    auto cropped = geometry::CreateImageFromImageView(region);
+
+    // Filtering a region matches filtering a copy of it.
+    vector<FilterType> types = {FilterType::Gaussian3, FilterType::Gaussian5,
+                                FilterType::Gaussian7, FilterType::Sobel3Dx,
+                                FilterType::Sobel3Dy};
+    for (auto type : types) {
+        auto ref = geometry::FilterImage(*cropped, type);
+
+        geometry::Image output;
+        output.PrepareImage(9, 7, 1, 4);
+        EXPECT_TRUE(geometry::FilterImage(
+                region, type, geometry::CreateImageView<float>(output)));
+        ExpectEQ(ref->data_, output.data_);
+    }
+
+    // In place.
+    auto ref = geometry::FilterImage(*cropped, FilterType::Gaussian5);
+    auto cropped_view = geometry::CreateImageView<float>(*cropped);
+    EXPECT_TRUE(geometry::FilterImage(cropped_view, FilterType::Gaussian5,
+                                      cropped_view));
+    ExpectEQ(ref->data_, cropped->data_);
+
+    // Mismatching sizes.
+    geometry::Image output;
+    output.PrepareImage(8, 7, 1, 4);
+    EXPECT_FALSE(geometry::FilterImage(
+            region, FilterType::Gaussian3,
+            geometry::CreateImageView<float>(output)));
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImageView, FilterHorizontalImage) {
+    vector<double> kernel = {0.03125, 0.109375, 0.21875, 0.28125,
+                             0.21875, 0.109375, 0.03125};
+
+    // Narrower and wider than the kernel.
+    for (int width : {3, 23}) {
+        auto image = CreateRandomFloatImage(width, 5, 0);
+        auto view = geometry::CreateImageView<float>(*image);
+
+        // Clamped reference.
+        vector<float> ref(width * 5);
+        for (int v = 0; v < 5; v++) {
+            for (int u = 0; u < width; u++) {
+                double sum = 0.0;
+                for (int k = -3; k <= 3; k++) {
+                    int uk = min(max(u + k, 0), width - 1);
+                    sum += view(uk, v) * (float)kernel[k + 3];
+                }
+                ref[v * width + u] = (float)sum;
+            }
+        }
+
+        // In place.
+        EXPECT_TRUE(geometry::FilterHorizontalImage(view, kernel, view));
+        for (int v = 0; v < 5; v++) {
+            for (int u = 0; u < width; u++) {
+                EXPECT_EQ(ref[v * width + u], view(u, v));
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImageView, FilterAndDownsampleImage) {
+    vector<vector<double>> kernels = {
+            {0.25, 0.5, 0.25},
+            {0.03125, 0.109375, 0.21875, 0.28125, 0.21875, 0.109375,
+             0.03125}};
+    vector<Vector2i> sizes = {{17, 13}, {6, 5}, {3, 2}};
+    for (const auto& kernel : kernels) {
+        for (const auto& size : sizes) {
+            auto image = CreateRandomFloatImage(size(0), size(1), 0);
+            auto ref = geometry::DownsampleImage(
+                    *geometry::FilterImage(*image, kernel, kernel));
+
+            geometry::Image output;
+            output.PrepareImage(size(0) / 2, size(1) / 2, 1, 4);
+            EXPECT_TRUE(geometry::FilterAndDownsampleImage(
+                    geometry::CreateImageView<float>(*image), kernel,
+                    geometry::CreateImageView<float>(output)));
+            ExpectEQ(ref->data_, output.data_);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(ImageView, CreateImagePyramid) {
+    auto image = CreateRandomFloatImage(32, 24, 0);
+    auto region = geometry::CreateImageView<float>(*image).Region(4, 3, 21, 17);
+    auto cropped = geometry::CreateImageFromImageView(region);
+
+    for (bool with_gaussian_filter : {false, true}) {
+        auto ref = geometry::CreateImagePyramid(*cropped, 4,
+                                                with_gaussian_filter);
+        auto pyramid =
+                geometry::CreateImagePyramid(region, 4, with_gaussian_filter);
+        ASSERT_EQ(ref.size(), pyramid.size());
+        for (size_t i = 0; i < ref.size(); i++) {
+            EXPECT_EQ(ref[i]->width_, pyramid[i]->width_);
+            EXPECT_EQ(ref[i]->height_, pyramid[i]->height_);
+            ExpectEQ(ref[i]->data_, pyramid[i]->data_);
+        }
+        EXPECT_EQ(2, pyramid[3]->width_);
+        EXPECT_EQ(2, pyramid[3]->height_);
+    }
+}
@@ -0,0 +1,121 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <memory>
+
+#include "Open3D/Geometry/LinearOctree.h"
+#include "Open3D/Geometry/Octree.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(LinearOctree, Morton) {
+    EXPECT_EQ(geometry::LinearOctree::EncodeMorton(Eigen::Vector3i(1, 0, 0)),
+              1u);
+    EXPECT_EQ(geometry::LinearOctree::EncodeMorton(Eigen::Vector3i(0, 1, 0)),
+              2u);
+    EXPECT_EQ(geometry::LinearOctree::EncodeMorton(Eigen::Vector3i(0, 0, 1)),
+              4u);
+    EXPECT_EQ(geometry::LinearOctree::EncodeMorton(Eigen::Vector3i(3, 0, 1)),
+              13u);
+
+    std::vector<Eigen::Vector3i> grid_indices(100);
+    Rand(grid_indices, Eigen::Vector3i(0, 0, 0),
+         Eigen::Vector3i(2097151, 2097151, 2097151), 0);
+    for (const Eigen::Vector3i& grid_index : grid_indices) {
+        ExpectEQ(geometry::LinearOctree::DecodeMorton(
+                         geometry::LinearOctree::EncodeMorton(grid_index)),
+                 grid_index);
+    }
+}
+
+TEST(LinearOctree, ConvertFromPointCloud) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    pcd.colors_.resize(1000);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    Rand(pcd.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 1);
+    // several points in the same leaf, the last color is kept
+    pcd.points_.push_back(pcd.points_[0]);
+    pcd.colors_.push_back(Eigen::Vector3d(0.5, 0.5, 0.5));
+
+    for (size_t max_depth : {0, 1, 4}) {
+        geometry::Octree octree(max_depth);
+        octree.ConvertFromPointCloud(pcd, 0.01);
+        geometry::LinearOctree linear_octree(max_depth);
+        linear_octree.ConvertFromPointCloud(pcd, 0.01);
+
+        ExpectEQ(linear_octree.origin_, octree.origin_);
+        EXPECT_EQ(linear_octree.size_, octree.size_);
+        EXPECT_TRUE(std::is_sorted(linear_octree.leaf_codes_.begin(),
+                                   linear_octree.leaf_codes_.end()));
+        EXPECT_TRUE(*linear_octree.ToOctree() == octree);
+
+        geometry::LinearOctree converted;
+        converted.FromOctree(octree);
+        EXPECT_EQ(converted.max_depth_, max_depth);
+        EXPECT_EQ(converted.leaf_codes_, linear_octree.leaf_codes_);
+        ExpectEQ(converted.leaf_colors_, linear_octree.leaf_colors_);
+    }
+}
+
+TEST(LinearOctree, LocateLeaf) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(100);
+    Rand(pcd.points_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 0);
+    geometry::LinearOctree linear_octree(5);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+    geometry::Octree octree(5);
+    pcd.colors_.resize(100);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+
+    for (const Eigen::Vector3d& point : pcd.points_) {
+        int leaf_idx = linear_octree.LocateLeaf(point);
+        ASSERT_GE(leaf_idx, 0);
+        geometry::OctreeNodeInfo node_info = linear_octree.GetNodeInfo(
+                linear_octree.leaf_codes_[leaf_idx], 5);
+        auto ref = octree.LocateLeafNode(point);
+        ExpectEQ(node_info.origin_, ref.second->origin_);
+        EXPECT_NEAR(node_info.size_, ref.second->size_, 1e-12);
+        EXPECT_EQ(node_info.child_index_, ref.second->child_index_);
+    }
+    EXPECT_EQ(linear_octree.LocateLeaf(Eigen::Vector3d(10, 10, 10)), -1);
+
+    // the root covers all leaves, the children partition them
+    auto range = linear_octree.GetLeafRange(0, 0);
+    EXPECT_EQ(range.first, 0u);
+    EXPECT_EQ(range.second, linear_octree.NumberOfLeaves());
+    size_t num_leaves = 0;
+    for (uint64_t child_code = 0; child_code < 8; ++child_code) {
+        range = linear_octree.GetLeafRange(child_code, 1);
+        EXPECT_EQ(range.first, num_leaves);
+        num_leaves = range.second;
+    }
+    EXPECT_EQ(num_leaves, linear_octree.NumberOfLeaves());
+}
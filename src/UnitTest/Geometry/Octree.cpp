@@ -28,6 +28,7 @@
 #include <iostream>
 #include <memory>
 
+#include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/Octree.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/VoxelGrid.h"
@@ -261,6 +262,12 @@ TEST(Octree, FragmentPLYLocate) {
         std::shared_ptr<geometry::OctreeLeafNode> node;
         std::shared_ptr<geometry::OctreeNodeInfo> node_info;
         std::tie(node, node_info) = octree.LocateLeafNode(point);
+        // Points are only stored in the leaves on request
+        EXPECT_TRUE(std::dynamic_pointer_cast<geometry::OctreeColorLeafNode>(
+                            node) != nullptr);
+        EXPECT_TRUE(
+                std::dynamic_pointer_cast<geometry::OctreePointColorLeafNode>(
+                        node) == nullptr);
         EXPECT_TRUE(geometry::Octree::IsPointInBound(point, node_info->origin_,
                                                      node_info->size_));
         EXPECT_EQ(node_info->depth_, max_depth);
@@ -314,3 +321,111 @@ TEST(Octree, ConvertToJsonValue) {
 
     EXPECT_TRUE(src_octree == dst_octree);
 }
+
+TEST(Octree, SearchKNNRadius) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    geometry::Octree octree(4);
+    octree.ConvertFromPointCloud(pcd, 0.01, true);
+    geometry::KDTreeFlann kdtree(pcd);
+
+    std::vector<Eigen::Vector3d> queries(50);
+    Rand(queries, Eigen::Vector3d(-1.5, -1.5, -1.5),
+         Eigen::Vector3d(1.5, 1.5, 1.5), 1);
+    std::vector<std::vector<int>> batch_indices;
+    std::vector<std::vector<double>> batch_distance2;
+    octree.SearchKNN(queries, 10, batch_indices, batch_distance2);
+    ASSERT_EQ(batch_indices.size(), queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        std::vector<int> indices, ref_indices;
+        std::vector<double> distance2, ref_distance2;
+        EXPECT_EQ(octree.SearchKNN(queries[i], 10, indices, distance2), 10);
+        kdtree.SearchKNN(queries[i], 10, ref_indices, ref_distance2);
+        EXPECT_EQ(indices, ref_indices);
+        ExpectEQ(distance2, ref_distance2);
+        EXPECT_EQ(batch_indices[i], indices);
+
+        int num = octree.SearchRadius(queries[i], 0.3, indices, distance2);
+        EXPECT_EQ(num, int(indices.size()));
+        kdtree.SearchRadius(queries[i], 0.3, ref_indices, ref_distance2);
+        EXPECT_EQ(indices, ref_indices);
+        ExpectEQ(distance2, ref_distance2);
+    }
+
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    EXPECT_EQ(octree.SearchKNN(queries[0], 5000, indices, distance2), 1000);
+    EXPECT_EQ(geometry::Octree(4).SearchKNN(queries[0], 1, indices, distance2),
+              -1);
+}
+
+TEST(Octree, SearchBoxFrustum) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(2000);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    geometry::Octree octree(4);
+    octree.ConvertFromPointCloud(pcd, 0.01, true);
+
+    Eigen::Vector3d min_bound(-0.3, -0.5, 0.1);
+    Eigen::Vector3d max_bound(0.6, 0.2, 1.5);
+    std::vector<int> indices, ref_indices;
+    for (size_t i = 0; i < pcd.points_.size(); ++i) {
+        const Eigen::Vector3d& p = pcd.points_[i];
+        if ((p.array() >= min_bound.array()).all() &&
+            (p.array() <= max_bound.array()).all()) {
+            ref_indices.push_back(int(i));
+        }
+    }
+    octree.SearchBox(min_bound, max_bound, indices);
+    std::sort(indices.begin(), indices.end());
+    EXPECT_EQ(indices, ref_indices);
+
+    // Nodes are reported at the level of detail depth unless they are leaves
+    for (int lod_depth : {-1, 0, 2}) {
+        auto nodes = octree.LocateNodesInBox(min_bound, max_bound, lod_depth);
+        EXPECT_FALSE(nodes.empty());
+        size_t expected_depth = lod_depth < 0 ? 4 : size_t(lod_depth);
+        for (const auto& node : nodes) {
+            EXPECT_EQ(node.second->depth_, expected_depth);
+        }
+    }
+
+    // Frustum of a camera at (0, 0, 3) looking towards -z
+    Eigen::Matrix4d projection = Eigen::Matrix4d::Zero();
+    double z_near = 1, z_far = 3.5;
+    projection(0, 0) = 2;
+    projection(1, 1) = 2;
+    projection(2, 2) = -(z_far + z_near) / (z_far - z_near);
+    projection(2, 3) = -2 * z_far * z_near / (z_far - z_near);
+    projection(3, 2) = -1;
+    Eigen::Matrix4d view = Eigen::Matrix4d::Identity();
+    view(2, 3) = -3;
+    Eigen::Matrix4d view_projection = projection * view;
+    ref_indices.clear();
+    for (size_t i = 0; i < pcd.points_.size(); ++i) {
+        Eigen::Vector4d clip = view_projection * pcd.points_[i].homogeneous();
+        if ((clip.head<3>().array().abs() <= clip(3)).all()) {
+            ref_indices.push_back(int(i));
+        }
+    }
+    EXPECT_GT(ref_indices.size(), 0u);
+    EXPECT_LT(ref_indices.size(), pcd.points_.size());
+    octree.SearchFrustum(view_projection, indices);
+    std::sort(indices.begin(), indices.end());
+    EXPECT_EQ(indices, ref_indices);
+
+    std::vector<int> node_indices;
+    for (const auto& node : octree.LocateNodesInFrustum(view_projection, -1)) {
+        auto leaf_node =
+                std::dynamic_pointer_cast<geometry::OctreePointColorLeafNode>(
+                        node.first);
+        ASSERT_TRUE(leaf_node != nullptr);
+        for (size_t idx : leaf_node->indices_) {
+            node_indices.push_back(int(idx));
+        }
+    }
+    std::sort(node_indices.begin(), node_indices.end());
+    EXPECT_TRUE(std::includes(node_indices.begin(), node_indices.end(),
+                              ref_indices.begin(), ref_indices.end()));
+}
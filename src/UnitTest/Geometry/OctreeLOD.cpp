@@ -0,0 +1,141 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Octree.h"
+#include "Open3D/Geometry/OctreeLOD.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+geometry::OctreeLOD CreateLOD(size_t num_points, size_t max_depth) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    geometry::Octree octree(max_depth);
+    octree.ConvertFromPointCloud(pcd, 0.01, true);
+    geometry::OctreeLOD lod;
+    EXPECT_TRUE(lod.ConvertFromOctree(octree, 4));
+    return lod;
+}
+
+/// Camera on the z axis at distance from the origin, looking towards +z
+camera::PinholeCameraParameters CreateCamera(double distance) {
+    camera::PinholeCameraParameters camera;
+    camera.intrinsic_.SetIntrinsics(640, 480, 500, 500, 319.5, 239.5);
+    camera.extrinsic_ = Eigen::Matrix4d::Identity();
+    camera.extrinsic_(2, 3) = distance;
+    return camera;
+}
+
+size_t CountPoints(const geometry::OctreeLOD& lod,
+                   const std::vector<size_t>& nodes) {
+    size_t num_points = 0;
+    for (size_t node_index : nodes) {
+        num_points += lod.nodes_[node_index].indices_.size();
+    }
+    return num_points;
+}
+
+}  // unnamed namespace
+
+TEST(OctreeLOD, ConvertFromOctree) {
+    geometry::OctreeLOD lod = CreateLOD(1000, 3);
+    ASSERT_FALSE(lod.IsEmpty());
+    EXPECT_EQ(lod.nodes_[0].depth_, 0u);
+
+    std::vector<size_t> leaf_indices;
+    for (const geometry::OctreeLODNode& node : lod.nodes_) {
+        EXPECT_EQ(node.indices_.size(), node.points_.size());
+        if (node.IsLeaf()) {
+            EXPECT_EQ(node.depth_, 3u);
+            leaf_indices.insert(leaf_indices.end(), node.indices_.begin(),
+                                node.indices_.end());
+            continue;
+        }
+        // At most one sample per cell, taken from the children's samples
+        EXPECT_GT(node.indices_.size(), 0u);
+        EXPECT_LE(node.indices_.size(), 4u * 4u * 4u);
+        std::vector<size_t> child_indices;
+        for (size_t child_index : node.children_) {
+            const geometry::OctreeLODNode& child = lod.nodes_[child_index];
+            EXPECT_EQ(child.depth_, node.depth_ + 1);
+            child_indices.insert(child_indices.end(), child.indices_.begin(),
+                                 child.indices_.end());
+        }
+        std::vector<size_t> indices = node.indices_;
+        std::sort(indices.begin(), indices.end());
+        std::sort(child_indices.begin(), child_indices.end());
+        EXPECT_TRUE(std::includes(child_indices.begin(), child_indices.end(),
+                                  indices.begin(), indices.end()));
+    }
+    std::sort(leaf_indices.begin(), leaf_indices.end());
+    ASSERT_EQ(leaf_indices.size(), 1000u);
+    for (size_t i = 0; i < leaf_indices.size(); ++i) {
+        EXPECT_EQ(leaf_indices[i], i);
+    }
+
+    geometry::Octree octree(2);
+    EXPECT_FALSE(lod.ConvertFromOctree(octree));
+    EXPECT_TRUE(lod.IsEmpty());
+}
+
+TEST(OctreeLOD, SelectNodes) {
+    geometry::OctreeLOD lod = CreateLOD(5000, 4);
+
+    // From far away the root is accurate enough
+    std::vector<size_t> nodes = lod.SelectNodes(CreateCamera(1000), 1.0);
+    EXPECT_EQ(nodes, std::vector<size_t>({0}));
+    EXPECT_GT(lod.ComputeScreenSpaceError(0, CreateCamera(10)),
+              lod.ComputeScreenSpaceError(0, CreateCamera(1000)));
+
+    // Without error tolerance all visible leaves are selected
+    nodes = lod.SelectNodes(CreateCamera(10), 0.0, 100000);
+    EXPECT_EQ(CountPoints(lod, nodes), 5000u);
+    for (size_t node_index : nodes) {
+        EXPECT_TRUE(lod.nodes_[node_index].IsLeaf());
+    }
+
+    // The point budget is respected
+    for (size_t max_points : {600, 1000, 2000}) {
+        nodes = lod.SelectNodes(CreateCamera(2), 0.0, max_points);
+        EXPECT_LE(CountPoints(lod, nodes), max_points);
+        EXPECT_GT(nodes.size(), 1u);
+    }
+
+    // Nodes behind the camera are culled
+    nodes = lod.SelectNodes(CreateCamera(-2), 0.0, 100000);
+    EXPECT_TRUE(nodes.empty());
+    nodes = lod.SelectNodes(CreateCamera(0.5), 0.0, 100000);
+    EXPECT_GT(CountPoints(lod, nodes), 0u);
+    EXPECT_LT(CountPoints(lod, nodes), 5000u);
+}
@@ -25,6 +25,13 @@
 // ----------------------------------------------------------------------------
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/Image.h"
@@ -688,6 +695,58 @@ TEST(PointCloud, EstimateNormals) {
     ExpectEQ(ref, pc.normals_);
 }
 
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PointCloud, EstimateNormalsOrganised) {
+    const int width = 64;
+    const int height = 48;
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 500.0, 500.0,
+                                             31.5, 23.5);
+
+    // Two planes n.x = d, the right one in front of the left one, and holes
+    // away from the step.
+    const Vector3d n0 = Vector3d(0.3, -0.2, 1.0).normalized();
+    const Vector3d n1 = Vector3d(-0.5, 0.1, 1.0).normalized();
+    geometry::Image depth;
+    depth.PrepareImage(width, height, 1, 4);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            Vector3d ray((u - 31.5) / 500.0, (v - 23.5) / 500.0, 1.0);
+            double z = u < 40 ? 2.0 / n0.dot(ray) : 1.0 / n1.dot(ray);
+            if ((u < 36 || u > 44) && (u * 7 + v * 13) % 23 == 0) z = 0.0;
+            *geometry::PointerAt<float>(depth, u, v) = float(z);
+        }
+    }
+    auto pc = geometry::CreatePointCloudFromDepthImage(
+            depth, intrinsic, Matrix4d::Identity(), 1000.0, 1000.0, 1, false);
+
+    EXPECT_FALSE(geometry::EstimateNormalsOrganised(*pc, width, height + 1));
+    EXPECT_FALSE(pc->HasNormals());
+
+    EXPECT_TRUE(geometry::EstimateNormalsOrganised(*pc, width, height));
+    ASSERT_EQ(pc->points_.size(), pc->normals_.size());
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            const size_t i = v * width + u;
+            if (std::isnan(pc->points_[i](0))) {
+                EXPECT_TRUE(std::isnan(pc->normals_[i](0)));
+            } else {
+                // Oriented towards the camera.
+                ExpectEQ(u < 40 ? Vector3d(-n0) : Vector3d(-n1),
+                         pc->normals_[i], 1e-4);
+            }
+        }
+    }
+
+    // Orientation is kept from existing normals.
+    for (auto& normal : pc->normals_) {
+        normal = -normal;
+    }
+    EXPECT_TRUE(geometry::EstimateNormalsOrganised(*pc, width, height, 2));
+    ExpectEQ(n0, pc->normals_[10 * width + 10], 1e-4);
+}
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -938,6 +997,242 @@ TEST(PointCloud, ComputePointCloudNearestNeighborDistance) {
     ExpectEQ(ref, distance);
 }
 
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PointCloud, ClusterDBSCAN) {
+    int size = 1000;
+    double eps = 60.0;
+    size_t min_points = 4;
+
+    geometry::PointCloud pc;
+
+    Vector3d vmin(0.0, 0.0, 0.0);
+    Vector3d vmax(1000.0, 1000.0, 1000.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    // Brute force reference: flood fill the core points, attach every border
+    // point to its nearest core point, number the clusters by their smallest
+    // point index.
+    vector<vector<int>> neighbors(size);
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            if ((pc.points_[i] - pc.points_[j]).norm() <= eps) {
+                neighbors[i].push_back(j);
+            }
+        }
+    }
+    vector<int> component(size, -1);
+    for (int i = 0; i < size; i++) {
+        if (neighbors[i].size() < min_points || component[i] >= 0) {
+            continue;
+        }
+        vector<int> stack(1, i);
+        component[i] = i;
+        while (!stack.empty()) {
+            int k = stack.back();
+            stack.pop_back();
+            for (int j : neighbors[k]) {
+                if (neighbors[j].size() >= min_points && component[j] < 0) {
+                    component[j] = i;
+                    stack.push_back(j);
+                }
+            }
+        }
+    }
+    for (int i = 0; i < size; i++) {
+        if (neighbors[i].size() >= min_points) {
+            continue;
+        }
+        int nearest = -1;
+        for (int j : neighbors[i]) {
+            if (neighbors[j].size() >= min_points &&
+                (nearest < 0 || (pc.points_[i] - pc.points_[j]).norm() <
+                                        (pc.points_[i] - pc.points_[nearest])
+                                                .norm())) {
+                nearest = j;
+            }
+        }
+        if (nearest >= 0) {
+            component[i] = component[nearest];
+        }
+    }
+    map<int, int> first_point;
+    for (int i = size - 1; i >= 0; i--) {
+        if (component[i] >= 0) {
+            first_point[component[i]] = i;
+        }
+    }
+    map<int, int> order;
+    for (const auto& it : first_point) {
+        order[it.second] = 0;
+    }
+    int num_clusters = 0;
+    for (auto& it : order) {
+        it.second = num_clusters++;
+    }
+    vector<int> ref_labels(size, -1);
+    vector<size_t> ref_sizes(num_clusters, 0);
+    for (int i = 0; i < size; i++) {
+        if (component[i] >= 0) {
+            ref_labels[i] = order[first_point[component[i]]];
+            ref_sizes[ref_labels[i]]++;
+        }
+    }
+
+    vector<int> labels;
+    vector<size_t> sizes;
+    tie(labels, sizes) = geometry::ClusterDBSCAN(pc, eps, min_points);
+
+    EXPECT_LT(1, num_clusters);
+    EXPECT_EQ(ref_labels, labels);
+    EXPECT_EQ(ref_sizes, sizes);
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PointCloud, ClusterEuclidean) {
+    geometry::PointCloud pc;
+
+    // Three blobs of 50, 20 and 5 points, and an isolated point.
+    vector<Vector3d> centers = {{0.0, 0.0, 0.0},
+                                {10.0, 0.0, 0.0},
+                                {0.0, 10.0, 0.0}};
+    vector<int> counts = {50, 20, 5};
+    for (size_t c = 0; c < centers.size(); c++) {
+        vector<Vector3d> blob(counts[c]);
+        Rand(blob, centers[c] - Vector3d::Constant(0.5),
+             centers[c] + Vector3d::Constant(0.5), int(c));
+        pc.points_.insert(pc.points_.end(), blob.begin(), blob.end());
+    }
+    pc.points_.push_back(Vector3d(10.0, 10.0, 10.0));
+
+    vector<int> labels;
+    vector<size_t> sizes;
+    tie(labels, sizes) = geometry::ClusterEuclidean(pc, 1.0);
+    EXPECT_EQ(vector<size_t>({50, 20, 5, 1}), sizes);
+    EXPECT_EQ(0, labels[0]);
+    EXPECT_EQ(1, labels[50]);
+    EXPECT_EQ(2, labels[70]);
+    EXPECT_EQ(3, labels[75]);
+
+    tie(labels, sizes) = geometry::ClusterEuclidean(pc, 1.0, 10, 30);
+    EXPECT_EQ(vector<size_t>({20}), sizes);
+    for (size_t i = 0; i < labels.size(); i++) {
+        EXPECT_EQ(i >= 50 && i < 70 ? 0 : -1, labels[i]);
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PointCloud, SegmentPlane) {
+    double threshold = 0.01;
+    Vector4d ref_plane(0.5, -0.2, -1.0, 3.0);
+    ref_plane /= ref_plane.head<3>().norm();
+
+    geometry::PointCloud pc;
+    pc.points_.resize(500);
+    Rand(pc.points_, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 0.0), 0);
+    for (auto& p : pc.points_) {
+        p(2) = 0.5 * p(0) - 0.2 * p(1) + 3.0;
+    }
+    vector<Vector3d> outliers(200);
+    Rand(outliers, Vector3d(0.0, 0.0, -10.0), Vector3d(10.0, 10.0, 20.0), 1);
+    pc.points_.insert(pc.points_.end(), outliers.begin(), outliers.end());
+
+    Vector4d plane;
+    vector<size_t> inliers;
+    tie(plane, inliers) = geometry::SegmentPlane(pc, threshold);
+
+    if (plane(3) * ref_plane(3) < 0.0) {
+        plane = -plane;
+    }
+    // Outliers within the threshold take part in the refinement.
+    ExpectEQ(ref_plane, plane, 1e-4);
+    ASSERT_LE(500u, inliers.size());
+    for (size_t i = 0; i < 500; i++) {
+        EXPECT_EQ(i, inliers[i]);
+    }
+    for (size_t i : inliers) {
+        EXPECT_GT(threshold, std::abs(plane.head<3>().dot(pc.points_[i]) +
+                                      plane(3)));
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PointCloud, SegmentSphere) {
+    double threshold = 0.01;
+    Vector4d ref_sphere(1.0, 2.0, 3.0, 2.0);
+
+    geometry::PointCloud pc;
+    pc.points_.resize(400);
+    Rand(pc.points_, Vector3d(-1.0, -1.0, -1.0), Vector3d(1.0, 1.0, 1.0), 0);
+    for (auto& p : pc.points_) {
+        p = ref_sphere.head<3>() + ref_sphere(3) * p.normalized();
+    }
+    vector<Vector3d> outliers(100);
+    Rand(outliers, Vector3d(-2.0, -2.0, -2.0), Vector3d(4.0, 6.0, 8.0), 1);
+    pc.points_.insert(pc.points_.end(), outliers.begin(), outliers.end());
+
+    Vector4d sphere;
+    vector<size_t> inliers;
+    tie(sphere, inliers) = geometry::SegmentSphere(pc, threshold);
+
+    ExpectEQ(ref_sphere, sphere, 1e-4);
+    ASSERT_LE(400u, inliers.size());
+    for (size_t i = 0; i < 400; i++) {
+        EXPECT_EQ(i, inliers[i]);
+    }
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PointCloud, SegmentCylinder) {
+    double threshold = 0.01;
+    Vector3d axis = Vector3d(1.0, 1.0, 0.0).normalized();
+    Vector3d u = Vector3d(0.0, 0.0, 1.0);
+    Vector3d v = axis.cross(u);
+    Vector3d point(1.0, 0.0, 0.0);
+    double radius = 0.5;
+
+    geometry::PointCloud pc;
+    vector<Vector3d> samples(300);
+    Rand(samples, Vector3d(-1.0, -1.0, -2.0), Vector3d(1.0, 1.0, 2.0), 0);
+    for (const auto& s : samples) {
+        Vector3d n = (s(0) * u + s(1) * v).normalized();
+        pc.points_.push_back(point + s(2) * axis + radius * n);
+        pc.normals_.push_back(n);
+    }
+    vector<Vector3d> outliers(100);
+    Rand(outliers, Vector3d(-2.0, -2.0, -2.0), Vector3d(2.0, 2.0, 2.0), 1);
+    pc.points_.insert(pc.points_.end(), outliers.begin(), outliers.end());
+    Rand(outliers, Vector3d(-1.0, -1.0, -1.0), Vector3d(1.0, 1.0, 1.0), 2);
+    for (const auto& n : outliers) {
+        pc.normals_.push_back(n.normalized());
+    }
+
+    Eigen::Matrix<double, 7, 1> cylinder;
+    vector<size_t> inliers;
+    tie(cylinder, inliers) = geometry::SegmentCylinder(pc, threshold);
+
+    Vector3d found_axis = cylinder.segment<3>(3);
+    Vector3d found_point = cylinder.head<3>();
+    EXPECT_NEAR(1.0, std::abs(found_axis.dot(axis)), 1e-6);
+    EXPECT_NEAR(0.0, ((found_point - point).cross(axis)).norm(), 1e-6);
+    EXPECT_NEAR(radius, cylinder(6), 1e-6);
+    ASSERT_LE(300u, inliers.size());
+    for (size_t i = 0; i < 300; i++) {
+        EXPECT_EQ(i, inliers[i]);
+    }
+}
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -989,6 +1284,137 @@ TEST(PointCloud, CreatePointCloudFromDepthImage) {
     ExpectEQ(ref, output_pc->points_);
 }
 
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(PointCloud, CreatePointCloudFromDepthImageOrganised) {
+    const int width = 7;
+    const int height = 5;
+    const int stride = 2;
+
+    geometry::Image depth;
+    depth.PrepareImage(width, height, 1, 4);
+    float* data = reinterpret_cast<float*>(depth.data_.data());
+    Rand(data, width * height, 0.5f, 3.0f, 0);
+    data[0] = 0.0f;
+    data[2 * width + 4] = 0.0f;
+    data[4 * width + 6] = numeric_limits<float>::quiet_NaN();
+
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 6.0, 5.0, 3.2,
+                                             2.1);
+    Matrix4d extrinsic = Matrix4d::Identity();
+    extrinsic.block<3, 3>(0, 0) =
+            AngleAxisd(0.3, Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    extrinsic.block<3, 1>(0, 3) = Vector3d(0.5, -1.0, 2.0);
+    Matrix4d pose = extrinsic.inverse();
+
+    vector<Vector3d> ref;
+    vector<bool> valid;
+    for (int v = 0; v < height; v += stride) {
+        for (int u = 0; u < width; u += stride) {
+            double z = data[v * width + u];
+            valid.push_back(z > 0);
+            Vector4d point((u - 3.2) * z / 6.0, (v - 2.1) * z / 5.0, z, 1.0);
+            ref.push_back((pose * point).head<3>());
+        }
+    }
+
+    auto organised = geometry::CreatePointCloudFromDepthImage(
+            depth, intrinsic, extrinsic, 1000.0, 1000.0, stride, false);
+    auto compact = geometry::CreatePointCloudFromDepthImage(
+            depth, intrinsic, extrinsic, 1000.0, 1000.0, stride, true);
+
+    ASSERT_EQ(ref.size(), organised->points_.size());
+    size_t num_of_valid = 0;
+    for (size_t i = 0; i < ref.size(); i++) {
+        if (valid[i]) {
+            ExpectEQ(ref[i], organised->points_[i]);
+            ASSERT_LT(num_of_valid, compact->points_.size());
+            ExpectEQ(ref[i], compact->points_[num_of_valid++]);
+        } else {
+            EXPECT_TRUE(std::isnan(organised->points_[i](0)));
+            EXPECT_TRUE(std::isnan(organised->points_[i](2)));
+        }
+    }
+    EXPECT_EQ(num_of_valid, compact->points_.size());
+    EXPECT_EQ(9u, num_of_valid);
+
+    geometry::Image color;
+    color.PrepareImage(width, height, 3, 1);
+    Rand(color.data_, 0, 255, 0);
+    geometry::RGBDImage rgbd(color, depth);
+    auto organised_rgbd = geometry::CreatePointCloudFromRGBDImage(
+            rgbd, intrinsic, extrinsic, false);
+    ASSERT_EQ(size_t(width * height), organised_rgbd->points_.size());
+    ASSERT_EQ(size_t(width * height), organised_rgbd->colors_.size());
+    EXPECT_TRUE(std::isnan(organised_rgbd->points_[0](0)));
+    for (int i = 0; i < width * height; i++) {
+        Vector3d ref_color(color.data_[3 * i], color.data_[3 * i + 1],
+                           color.data_[3 * i + 2]);
+        ref_color /= 255.0;
+        ExpectEQ(ref_color, organised_rgbd->colors_[i]);
+    }
+    ExpectEQ(organised->points_[1], organised_rgbd->points_[2]);
+}
+
+TEST(PointCloud, CreatePointCloudFromDepthImageParallel) {
+    const int width = 160;
+    const int height = 120;
+    geometry::Image depth;
+    depth.PrepareImage(width, height, 1, 4);
+    float* data = reinterpret_cast<float*>(depth.data_.data());
+    Rand(data, width * height, -1.0f, 3.0f, 0);
+
+    // Two cameras of the same image size, whose cached ray tables must be
+    // told apart.
+    vector<camera::PinholeCameraIntrinsic> intrinsics = {
+            camera::PinholeCameraIntrinsic(width, height, 100.0, 100.0, 79.5,
+                                           59.5),
+            camera::PinholeCameraIntrinsic(width, height, 120.0, 110.0, 80.0,
+                                           60.0)};
+    Matrix4d extrinsic = Matrix4d::Identity();
+    extrinsic.block<3, 1>(0, 3) = Vector3d(0.5, -1.0, 2.0);
+
+    for (bool compact : {true, false}) {
+        for (int stride : {1, 3}) {
+            vector<vector<Vector3d>> serial;
+#ifdef _OPENMP
+            int num_threads = omp_get_max_threads();
+            omp_set_num_threads(1);
+#endif
+            for (const auto& intrinsic : intrinsics) {
+                serial.push_back(geometry::CreatePointCloudFromDepthImage(
+                                         depth, intrinsic, extrinsic, 1000.0,
+                                         1000.0, stride, compact)
+                                         ->points_);
+            }
+#ifdef _OPENMP
+            omp_set_num_threads(4);
+#endif
+            for (size_t k = 0; k < intrinsics.size(); k++) {
+                auto pc = geometry::CreatePointCloudFromDepthImage(
+                        depth, intrinsics[k], extrinsic, 1000.0, 1000.0,
+                        stride, compact);
+                ASSERT_EQ(serial[k].size(), pc->points_.size());
+                for (size_t i = 0; i < serial[k].size(); i++) {
+                    if (std::isnan(serial[k][i](0))) {
+                        EXPECT_TRUE(std::isnan(pc->points_[i](0)));
+                    } else {
+                        EXPECT_EQ(serial[k][i], pc->points_[i]);
+                    }
+                }
+            }
+#ifdef _OPENMP
+            omp_set_num_threads(num_threads);
+#endif
+            if (compact) {
+                EXPECT_FALSE(serial[0] == serial[1]);
+            }
+        }
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Test CreatePointCloudFromRGBDImage for the following configurations:
 // index | color_num_of_channels | color_bytes_per_channel
@@ -133,6 +133,51 @@ TEST(RGBDImage, CreateRGBDImageFromColorAndDepth) {
     ExpectEQ(ref_depth, rgbd_image->depth_.data_);
 }
 
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(RGBDImage, CreateRGBDImageFromColorAndDepth_16bit) {
+    // Height not a multiple of the conversion bands.
+    const int width = 23;
+    const int height = 37;
+    geometry::Image color;
+    color.PrepareImage(width, height, 3, 1);
+    Rand(color.data_, 0, 255, 0);
+    geometry::Image depth;
+    depth.PrepareImage(width, height, 1, 2);
+    Rand(depth.data_, 0, 255, 1);
+
+    auto rgbd = geometry::CreateRGBDImageFromColorAndDepth(color, depth, 100.0,
+                                                           500.0);
+    ASSERT_EQ(1, rgbd->depth_.num_of_channels_);
+    ASSERT_EQ(4, rgbd->depth_.bytes_per_channel_);
+    ASSERT_EQ(1, rgbd->color_.num_of_channels_);
+    ASSERT_EQ(4, rgbd->color_.bytes_per_channel_);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            float ref_depth =
+                    (float)(*geometry::PointerAt<uint16_t>(depth, u, v));
+            ref_depth /= 100.0f;
+            if (ref_depth >= 500.0) ref_depth = 0.0f;
+            EXPECT_EQ(ref_depth,
+                      *geometry::PointerAt<float>(rgbd->depth_, u, v));
+            const uint8_t* pc = geometry::PointerAt<uint8_t>(color, u, v, 0);
+            float ref_color = (0.2990f * (float)(pc[0]) +
+                               0.5870f * (float)(pc[1]) +
+                               0.1140f * (float)(pc[2])) /
+                              255.0f;
+            EXPECT_EQ(ref_color,
+                      *geometry::PointerAt<float>(rgbd->color_, u, v));
+        }
+    }
+
+    rgbd = geometry::CreateRGBDImageFromColorAndDepth(color, depth, 100.0,
+                                                      500.0, false);
+    EXPECT_EQ(3, rgbd->color_.num_of_channels_);
+    ExpectEQ(color.data_, rgbd->color_.data_);
+    EXPECT_EQ(4, rgbd->depth_.bytes_per_channel_);
+}
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -676,6 +676,37 @@ TEST(TriangleMesh, Purge) {
     ExpectEQ(ref_triangle_normals, tm.triangle_normals_);
 }
 
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(TriangleMesh, RemoveDuplicatedVertices) {
+    geometry::TriangleMesh tm;
+    tm.vertices_ = {{0.0, 0.0, 0.0},    {1.0, 0.0, 0.0}, {0.0, 0.0, 0.0},
+                    {1.0, 0.0, 0.0},    {0.0, 1.0, 0.0}, {0.0005, 1.0, 0.0},
+                    {1.0, 0.0002, 0.0}, {1.0, 1.0, 0.0}};
+    tm.triangles_ = {{0, 1, 4}, {2, 3, 7}, {6, 7, 5}};
+    tm.ComputeAdjacencyList();
+
+    geometry::TriangleMesh exact = tm;
+    exact.RemoveDuplicatedVertices();
+    vector<Vector3d> ref_exact_vertices = {
+            {0.0, 0.0, 0.0},    {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0},
+            {0.0005, 1.0, 0.0}, {1.0, 0.0002, 0.0}, {1.0, 1.0, 0.0}};
+    vector<Vector3i> ref_exact_triangles = {{0, 1, 2}, {0, 1, 5}, {4, 5, 3}};
+    ExpectEQ(ref_exact_vertices, exact.vertices_);
+    ExpectEQ(ref_exact_triangles, exact.triangles_);
+    EXPECT_TRUE(exact.HasAdjacencyList());
+
+    geometry::TriangleMesh merged = tm;
+    merged.RemoveDuplicatedVertices(0.001);
+    vector<Vector3d> ref_merged_vertices = {
+            {0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {1.0, 1.0, 0.0}};
+    vector<Vector3i> ref_merged_triangles = {{0, 1, 2}, {0, 1, 3}, {1, 3, 2}};
+    ExpectEQ(ref_merged_vertices, merged.vertices_);
+    ExpectEQ(ref_merged_triangles, merged.triangles_);
+    EXPECT_TRUE(merged.HasAdjacencyList());
+}
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -714,6 +745,107 @@ TEST(TriangleMesh, SamplePointsUniformly) {
     }
 }
 
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(TriangleMesh, SamplePointsPoissonDiskParallel) {
+    auto mesh_empty = geometry::TriangleMesh();
+    auto pcd_empty =
+            geometry::SamplePointsPoissonDiskParallel(mesh_empty, 100);
+    EXPECT_TRUE(pcd_empty->points_.size() == 0);
+
+    auto mesh = geometry::CreateMeshSphere(1.0, 40);
+    mesh->PaintUniformColor(Vector3d(1, 0, 0));
+    size_t n_points = 1000;
+    auto pcd = geometry::SamplePointsPoissonDiskParallel(*mesh, n_points);
+    EXPECT_EQ(n_points, pcd->points_.size());
+    EXPECT_EQ(n_points, pcd->colors_.size());
+    for (size_t pidx = 0; pidx < n_points; ++pidx) {
+        EXPECT_NEAR(1.0, pcd->points_[pidx].norm(), 0.01);
+        ExpectEQ(pcd->colors_[pidx], Vector3d(1, 0, 0));
+    }
+
+    // the eliminated set is more evenly spaced than the uniform samples
+    auto ComputeMinDistance = [](const geometry::PointCloud &pcd) {
+        double min_dist = std::numeric_limits<double>::max();
+        for (size_t i = 0; i < pcd.points_.size(); ++i) {
+            for (size_t j = i + 1; j < pcd.points_.size(); ++j) {
+                min_dist = std::min(min_dist,
+                                    (pcd.points_[i] - pcd.points_[j]).norm());
+            }
+        }
+        return min_dist;
+    };
+    auto pcd_uniform = geometry::SamplePointsUniformly(*mesh, n_points);
+    EXPECT_GT(ComputeMinDistance(*pcd), ComputeMinDistance(*pcd_uniform));
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(TriangleMesh, SubdivideMidpoint) {
+    auto mesh = geometry::TriangleMesh();
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}};
+    mesh.triangles_ = {{0, 1, 2}};
+
+    auto mesh1 = geometry::SubdivideMidpoint(mesh, 1);
+    std::vector<Eigen::Vector3d> vertices_ref = {
+            {0, 0, 0},   {1, 0, 0},     {0, 1, 0},
+            {0.5, 0, 0}, {0.5, 0.5, 0}, {0, 0.5, 0}};
+    std::vector<Eigen::Vector3i> triangles_ref = {
+            {0, 3, 5}, {3, 1, 4}, {4, 2, 5}, {3, 4, 5}};
+    ExpectEQ(mesh1->vertices_, vertices_ref);
+    ExpectEQ(mesh1->triangles_, triangles_ref);
+
+    auto mesh2 = geometry::SubdivideMidpoint(mesh, 2);
+    EXPECT_EQ(15u, mesh2->vertices_.size());
+    EXPECT_EQ(16u, mesh2->triangles_.size());
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(TriangleMesh, SubdivideLoop) {
+    // closed tetrahedron, all vertices have valence 3
+    auto mesh = geometry::TriangleMesh();
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    mesh.triangles_ = {{0, 2, 1}, {0, 1, 3}, {0, 3, 2}, {1, 2, 3}};
+
+    auto mesh1 = geometry::SubdivideLoop(mesh, 1);
+    std::vector<Eigen::Vector3d> vertices_ref = {{0.1875, 0.1875, 0.1875},
+                                                 {0.4375, 0.1875, 0.1875},
+                                                 {0.1875, 0.4375, 0.1875},
+                                                 {0.1875, 0.1875, 0.4375},
+                                                 {0.125, 0.375, 0.125},
+                                                 {0.375, 0.375, 0.125},
+                                                 {0.375, 0.125, 0.125},
+                                                 {0.375, 0.125, 0.375},
+                                                 {0.125, 0.125, 0.375},
+                                                 {0.125, 0.375, 0.375}};
+    std::vector<Eigen::Vector3i> triangles_ref = {
+            {0, 4, 6}, {4, 2, 5}, {5, 1, 6}, {4, 5, 6},
+            {0, 6, 8}, {6, 1, 7}, {7, 3, 8}, {6, 7, 8},
+            {0, 8, 4}, {8, 3, 9}, {9, 2, 4}, {8, 9, 4},
+            {1, 5, 7}, {5, 2, 9}, {9, 3, 7}, {5, 9, 7}};
+    ExpectEQ(mesh1->vertices_, vertices_ref);
+    ExpectEQ(mesh1->triangles_, triangles_ref);
+
+    // open quad, boundary vertices and edges use the boundary rules
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}};
+    mesh.triangles_ = {{0, 1, 2}, {1, 3, 2}};
+    mesh.PaintUniformColor(Vector3d(1, 0, 0));
+    mesh1 = geometry::SubdivideLoop(mesh, 1);
+    vertices_ref = {{0.125, 0.125, 0}, {0.875, 0.125, 0}, {0.125, 0.875, 0},
+                    {0.875, 0.875, 0}, {0.5, 0, 0},       {0.5, 0.5, 0},
+                    {0, 0.5, 0},       {1, 0.5, 0},       {0.5, 1, 0}};
+    triangles_ref = {{0, 4, 6}, {4, 1, 5}, {5, 2, 6}, {4, 5, 6},
+                     {1, 7, 5}, {7, 3, 8}, {8, 2, 5}, {7, 8, 5}};
+    ExpectEQ(mesh1->vertices_, vertices_ref);
+    ExpectEQ(mesh1->triangles_, triangles_ref);
+    ExpectEQ(mesh1->vertex_colors_,
+             std::vector<Eigen::Vector3d>(9, Vector3d(1, 0, 0)));
+}
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -1015,6 +1147,66 @@ TEST(TriangleMesh, IsEdgeManifold) {
     EXPECT_EQ(mesh1.IsEdgeManifold(false), false);
 }
 
+TEST(TriangleMesh, GetNonManifoldEdges) {
+    EXPECT_EQ(geometry::CreateMeshBox()->GetNonManifoldEdges(false).size(), 0);
+    EXPECT_EQ(geometry::CreateMeshTorus()->GetNonManifoldEdges(false).size(),
+              0);
+
+    geometry::TriangleMesh mesh0;
+    mesh0.vertices_ = {{0, 0, 0}, {0, 0, 1}, {0, 1, 1}, {0, 0, 2}, {1, 0.5, 1}};
+    mesh0.triangles_ = {{0, 1, 2}, {1, 2, 3}, {1, 2, 4}};
+    std::vector<Eigen::Vector2i> ref0 = {{1, 2}};
+    ExpectEQ(mesh0.GetNonManifoldEdges(true), ref0);
+    std::vector<Eigen::Vector2i> ref1 = {{0, 1}, {0, 2}, {1, 2}, {1, 3},
+                                         {1, 4}, {2, 3}, {2, 4}};
+    ExpectEQ(mesh0.GetNonManifoldEdges(false), ref1);
+}
+
+TEST(TriangleMesh, IsOrientable) {
+    EXPECT_EQ(geometry::CreateMeshBox()->IsOrientable(), true);
+    EXPECT_EQ(geometry::CreateMeshSphere()->IsOrientable(), true);
+    EXPECT_EQ(geometry::CreateMeshTorus()->IsOrientable(), true);
+
+    // Moebius strip with five vertices
+    geometry::TriangleMesh mesh0;
+    mesh0.vertices_ = {{1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}, {0, 0, 1}};
+    mesh0.triangles_ = {{0, 1, 2}, {1, 2, 3}, {2, 3, 4}, {3, 4, 0}, {4, 0, 1}};
+    EXPECT_EQ(mesh0.IsOrientable(), false);
+    EXPECT_EQ(mesh0.OrientTriangles(), false);
+
+    // edge with three adjacent triangles
+    geometry::TriangleMesh mesh1;
+    mesh1.vertices_ = {{0, 0, 0}, {0, 0, 1}, {0, 1, 1}, {0, 0, 2}, {1, 0.5, 1}};
+    mesh1.triangles_ = {{0, 1, 2}, {1, 2, 3}, {1, 2, 4}};
+    EXPECT_EQ(mesh1.IsOrientable(), false);
+}
+
+TEST(TriangleMesh, OrientTriangles) {
+    auto mesh = geometry::CreateMeshBox();
+    auto ref = mesh->triangles_;
+    std::swap(mesh->triangles_[1](0), mesh->triangles_[1](1));
+    std::swap(mesh->triangles_[4](1), mesh->triangles_[4](2));
+    std::swap(mesh->triangles_[7](2), mesh->triangles_[7](0));
+    EXPECT_EQ(mesh->IsOrientable(), true);
+    EXPECT_EQ(mesh->OrientTriangles(), true);
+
+    // all triangles are oriented consistently, either like the reference or
+    // all of them flipped
+    int n_same = 0;
+    for (size_t tidx = 0; tidx < ref.size(); ++tidx) {
+        Eigen::Vector3i triangle = mesh->triangles_[tidx];
+        bool same = false;
+        for (int k = 0; k < 3; ++k) {
+            same = same ||
+                   triangle == Eigen::Vector3i(ref[tidx](k),
+                                               ref[tidx]((k + 1) % 3),
+                                               ref[tidx]((k + 2) % 3));
+        }
+        n_same += same ? 1 : 0;
+    }
+    EXPECT_TRUE(n_same == 0 || n_same == int(ref.size()));
+}
+
 TEST(TriangleMesh, IsVertexManifold) {
     EXPECT_EQ(geometry::CreateMeshBox()->IsVertexManifold(), true);
     EXPECT_EQ(geometry::CreateMeshSphere()->IsVertexManifold(), true);
@@ -1546,3 +1738,30 @@ TEST(TriangleMesh, CreateMeshCoordinateFrame) {
     ExpectEQ(ref_triangles, output->triangles_);
     ExpectEQ(ref_triangle_normals, output->triangle_normals_);
 }
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(TriangleMesh, ClusterConnectedTriangles) {
+    auto box0 = geometry::CreateMeshBox();
+    auto box1 = geometry::CreateMeshBox();
+    box1->Translate(Vector3d(2.0, 0.0, 0.0));
+    geometry::TriangleMesh mesh = *box1 + *box0;
+
+    // A triangle sharing only a vertex with the second box is its own
+    // component.
+    int num_vertices = int(mesh.vertices_.size());
+    mesh.vertices_.push_back(Vector3d(-1.0, 0.0, 0.0));
+    mesh.vertices_.push_back(Vector3d(-1.0, -1.0, 0.0));
+    mesh.triangles_.push_back(Vector3i(num_vertices - 8, num_vertices,
+                                       num_vertices + 1));
+
+    vector<int> labels;
+    vector<size_t> sizes;
+    tie(labels, sizes) = geometry::ClusterConnectedTriangles(mesh);
+
+    EXPECT_EQ(vector<size_t>({12, 12, 1}), sizes);
+    for (size_t i = 0; i < labels.size(); i++) {
+        EXPECT_EQ(int(i / 12), labels[i]);
+    }
+}
@@ -25,7 +25,11 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/IntersectionTest.h"
 #include "Open3D/Geometry/LineSet.h"
+#include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Visualization/Utility/DrawGeometry.h"
 #include "TestUtility/UnitTest.h"
@@ -63,6 +67,203 @@ TEST(VoxelGrid, GetVoxel) {
              Eigen::Vector3i(0, 1, 0));
 }
 
+TEST(VoxelGrid, HasVoxel) {
+    geometry::VoxelGrid voxel_grid;
+    voxel_grid.voxel_size_ = 1;
+    for (int i = 0; i < 100; i++) {
+        voxel_grid.AddVoxel(geometry::Voxel(Eigen::Vector3i(i, -i, 2 * i)));
+    }
+    EXPECT_EQ(voxel_grid.voxels_.size(), 100u);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_TRUE(voxel_grid.HasVoxel(Eigen::Vector3i(i, -i, 2 * i)));
+        EXPECT_EQ(voxel_grid.FindVoxel(Eigen::Vector3i(i, -i, 2 * i)), i);
+        EXPECT_FALSE(voxel_grid.HasVoxel(Eigen::Vector3i(i, i, 2 * i + 1)));
+    }
+
+    // Adding an existing voxel overwrites its color.
+    voxel_grid.AddVoxel(geometry::Voxel(Eigen::Vector3i(3, -3, 6),
+                                        Eigen::Vector3d(1, 0, 0)));
+    EXPECT_EQ(voxel_grid.voxels_.size(), 100u);
+    ExpectEQ(voxel_grid.voxels_[3].color_, Eigen::Vector3d(1, 0, 0));
+
+    // Direct modifications of voxels_ are picked up.
+    voxel_grid.voxels_.push_back(geometry::Voxel(Eigen::Vector3i(7, 7, 7)));
+    EXPECT_TRUE(voxel_grid.HasVoxel(Eigen::Vector3i(7, 7, 7)));
+    voxel_grid.Clear();
+    EXPECT_FALSE(voxel_grid.HasVoxel(Eigen::Vector3i(0, 0, 0)));
+}
+
+TEST(VoxelGrid, BooleanOperations) {
+    geometry::VoxelGrid a;
+    geometry::VoxelGrid b;
+    a.voxel_size_ = b.voxel_size_ = 0.5;
+    for (int i = 0; i < 10; i++) {
+        a.AddVoxel(geometry::Voxel(Eigen::Vector3i(i, 0, 0)));
+        b.AddVoxel(geometry::Voxel(Eigen::Vector3i(i + 5, 0, 0)));
+    }
+
+    geometry::VoxelGrid united = a + b;
+    EXPECT_EQ(united.voxels_.size(), 15u);
+    for (int i = 0; i < 15; i++) {
+        EXPECT_TRUE(united.HasVoxel(Eigen::Vector3i(i, 0, 0)));
+    }
+
+    geometry::VoxelGrid intersected = a;
+    intersected.Intersect(b);
+    EXPECT_EQ(intersected.voxels_.size(), 5u);
+    for (int i = 5; i < 10; i++) {
+        EXPECT_TRUE(intersected.HasVoxel(Eigen::Vector3i(i, 0, 0)));
+    }
+
+    geometry::VoxelGrid subtracted = a;
+    subtracted.Subtract(b);
+    EXPECT_EQ(subtracted.voxels_.size(), 5u);
+    for (int i = 0; i < 5; i++) {
+        EXPECT_TRUE(subtracted.HasVoxel(Eigen::Vector3i(i, 0, 0)));
+    }
+
+    // Grids with a different layout are left untouched.
+    geometry::VoxelGrid c = b;
+    c.voxel_size_ = 1.0;
+    a.Subtract(c);
+    EXPECT_EQ(a.voxels_.size(), 10u);
+}
+
+TEST(VoxelGrid, DilateErode) {
+    geometry::VoxelGrid voxel_grid;
+    voxel_grid.voxel_size_ = 1;
+    voxel_grid.AddVoxel(geometry::Voxel(Eigen::Vector3i(0, 0, 0),
+                                        Eigen::Vector3d(0.2, 0.4, 0.6)));
+    voxel_grid.Dilate();
+    EXPECT_EQ(voxel_grid.voxels_.size(), 7u);
+    ExpectEQ(voxel_grid.voxels_[6].color_, Eigen::Vector3d(0.2, 0.4, 0.6));
+    voxel_grid.Dilate(2);
+    // Octahedron of radius 3.
+    EXPECT_EQ(voxel_grid.voxels_.size(), 63u);
+
+    voxel_grid.Erode(2);
+    EXPECT_EQ(voxel_grid.voxels_.size(), 7u);
+    voxel_grid.Erode();
+    EXPECT_EQ(voxel_grid.voxels_.size(), 1u);
+    EXPECT_TRUE(voxel_grid.HasVoxel(Eigen::Vector3i(0, 0, 0)));
+    voxel_grid.Erode();
+    EXPECT_FALSE(voxel_grid.HasVoxels());
+}
+
+TEST(VoxelGrid, Carve) {
+    // 10x10x10 voxels of size 0.1 in [-0.5, 0.5]^2 x [1, 2], seen by a
+    // camera at the origin looking along +z.
+    geometry::VoxelGrid voxel_grid;
+    voxel_grid.voxel_size_ = 0.1;
+    voxel_grid.origin_ = Eigen::Vector3d(-0.5, -0.5, 1.0);
+    for (int x = 0; x < 10; x++) {
+        for (int y = 0; y < 10; y++) {
+            for (int z = 0; z < 10; z++) {
+                voxel_grid.AddVoxel(geometry::Voxel(Eigen::Vector3i(x, y, z)));
+            }
+        }
+    }
+    camera::PinholeCameraParameters camera;
+    camera.intrinsic_.SetIntrinsics(100, 100, 100, 100, 49.5, 49.5);
+    camera.extrinsic_ = Eigen::Matrix4d::Identity();
+
+    geometry::Image depth;
+    depth.PrepareImage(100, 100, 1, 4);
+    for (int v = 0; v < 100; v++) {
+        for (int u = 0; u < 100; u++) {
+            *geometry::PointerAt<float>(depth, u, v) = 1.5f;
+        }
+    }
+    geometry::VoxelGrid carved = voxel_grid;
+    carved.CarveDepthMap(depth, camera);
+    // The voxels with z index < 4 are entirely in front of depth 1.5.
+    EXPECT_EQ(carved.voxels_.size(), 600u);
+    for (const auto& voxel : carved.voxels_) {
+        EXPECT_GE(voxel.grid_index_(2), 4);
+    }
+
+    // Silhouette keeps the voxels projecting to the left half of the image.
+    geometry::Image mask;
+    mask.PrepareImage(100, 100, 1, 1);
+    for (int v = 0; v < 100; v++) {
+        for (int u = 0; u < 100; u++) {
+            *geometry::PointerAt<uint8_t>(mask, u, v) = u < 50 ? 255 : 0;
+        }
+    }
+    carved = voxel_grid;
+    carved.CarveSilhouette(mask, camera);
+    EXPECT_EQ(carved.voxels_.size(), 500u);
+    for (const auto& voxel : carved.voxels_) {
+        EXPECT_LT(voxel.grid_index_(0), 5);
+    }
+}
+
+TEST(VoxelGrid, CreateSurfaceVoxelGridFromPointCloud) {
+    geometry::PointCloud pc;
+    pc.points_ = {{0.05, 0.05, 0.05}, {0.15, 0.05, 0.05}, {0.06, 0.05, 0.05},
+                  {0.35, 0.05, 0.05}};
+    pc.colors_ = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 1}};
+    auto voxel_grid = geometry::CreateSurfaceVoxelGridFromPointCloud(pc, 0.1);
+    ExpectEQ(voxel_grid->origin_, Eigen::Vector3d(0, 0, 0));
+    ASSERT_EQ(voxel_grid->voxels_.size(), 3u);
+    ExpectEQ(voxel_grid->voxels_[0].grid_index_, Eigen::Vector3i(0, 0, 0));
+    ExpectEQ(voxel_grid->voxels_[0].color_, Eigen::Vector3d(0.5, 0, 0.5));
+    ExpectEQ(voxel_grid->voxels_[1].grid_index_, Eigen::Vector3i(1, 0, 0));
+    ExpectEQ(voxel_grid->voxels_[2].grid_index_, Eigen::Vector3i(3, 0, 0));
+    for (const auto& point : pc.points_) {
+        EXPECT_TRUE(voxel_grid->HasVoxel(voxel_grid->GetVoxel(point)));
+    }
+}
+
+TEST(VoxelGrid, IntersectingTriangleAABB) {
+    Eigen::Vector3d min_bound(0, 0, 0);
+    Eigen::Vector3d max_bound(1, 1, 1);
+    // Crossing the box without any vertex inside.
+    EXPECT_TRUE(geometry::IntersectingTriangleAABB(
+            Eigen::Vector3d(-1, 0.5, -1), Eigen::Vector3d(2, 0.5, -1),
+            Eigen::Vector3d(0.5, 0.5, 3), min_bound, max_bound));
+    // Bounding boxes overlap, but the triangle passes by a corner.
+    EXPECT_FALSE(geometry::IntersectingTriangleAABB(
+            Eigen::Vector3d(2.2, 0, 0.5), Eigen::Vector3d(0, 2.2, 0.5),
+            Eigen::Vector3d(2.2, 2.2, 0.5), min_bound, max_bound));
+    // Touching a face.
+    EXPECT_TRUE(geometry::IntersectingTriangleAABB(
+            Eigen::Vector3d(1, 0, 0), Eigen::Vector3d(1, 1, 0),
+            Eigen::Vector3d(1, 0, 1), min_bound, max_bound));
+}
+
+TEST(VoxelGrid, CreateFromTriangleMesh) {
+    auto box = geometry::CreateMeshBox(1, 1, 1);
+    auto surface = geometry::CreateSurfaceVoxelGridFromTriangleMesh(*box, 0.1);
+    ExpectEQ(surface->origin_, Eigen::Vector3d(-0.05, -0.05, -0.05));
+    // The faces lie in the middle of the outer layer of 11^3 voxels.
+    EXPECT_EQ(surface->voxels_.size(), size_t(11 * 11 * 11 - 9 * 9 * 9));
+    auto solid = geometry::CreateVoxelGridFromTriangleMesh(*box, 0.1);
+    EXPECT_EQ(solid->voxels_.size(), size_t(11 * 11 * 11));
+
+    auto sphere = geometry::CreateMeshSphere(1.0, 20);
+    const double voxel_size = 0.1;
+    solid = geometry::CreateVoxelGridFromTriangleMesh(*sphere, voxel_size);
+    for (const auto& voxel : solid->voxels_) {
+        Eigen::Vector3d center =
+                solid->origin_ +
+                (voxel.grid_index_.cast<double>().array() + 0.5).matrix() *
+                        voxel_size;
+        EXPECT_LE(center.norm(), 1.0 + voxel_size);
+    }
+    for (int x = -10; x <= 10; x++) {
+        for (int y = -10; y <= 10; y++) {
+            for (int z = -10; z <= 10; z++) {
+                Eigen::Vector3d point(x, y, z);
+                point *= voxel_size;
+                if (point.norm() < 0.9) {
+                    EXPECT_TRUE(solid->HasVoxel(solid->GetVoxel(point)));
+                }
+            }
+        }
+    }
+}
+
 TEST(VoxelGrid, Visualization) {
     auto voxel_grid = std::make_shared<geometry::VoxelGrid>();
     voxel_grid->origin_ = Eigen::Vector3d(0, 0, 0);
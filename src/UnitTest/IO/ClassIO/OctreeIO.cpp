@@ -38,10 +38,13 @@ using namespace open3d;
 using namespace unit_test;
 
 void WriteReadAndAssertEqual(const geometry::Octree& src_octree,
-                             bool delete_temp = true) {
+                             bool delete_temp = true,
+                             const std::string& extension = "json",
+                             bool compressed = false) {
     // Write to file
-    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_octree.json";
-    EXPECT_TRUE(io::WriteOctree(file_name, src_octree));
+    std::string file_name =
+            std::string(TEST_DATA_DIR) + "/temp_octree." + extension;
+    EXPECT_TRUE(io::WriteOctree(file_name, src_octree, compressed));
 
     // Read from file
     geometry::Octree dst_octree;
@@ -102,3 +105,110 @@ TEST(OctreeIO, JsonFileIOSevenCubes) {
 
     WriteReadAndAssertEqual(octree);
 }
+
+TEST(OctreeIO, BinFileIO) {
+    geometry::Octree empty_octree(10);
+    WriteReadAndAssertEqual(empty_octree, true, "bin");
+
+    geometry::Octree zero_depth_octree(0, Eigen::Vector3d(-1, -1, -1), 2);
+    zero_depth_octree.InsertPoint(
+            Eigen::Vector3d(0, 0, 0),
+            geometry::OctreeColorLeafNode::GetInitFunction(),
+            geometry::OctreeColorLeafNode::GetUpdateFunction(
+                    Eigen::Vector3d(0, 0.1, 0.2)));
+    WriteReadAndAssertEqual(zero_depth_octree, true, "bin");
+
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    pcd.colors_.resize(1000);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    Rand(pcd.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 1);
+    geometry::Octree octree(5);
+    octree.ConvertFromPointCloud(pcd, 0.01, true);
+    for (bool compressed : {false, true}) {
+        WriteReadAndAssertEqual(octree, true, "bin", compressed);
+    }
+
+    // Point leaves are kept
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_octree.bin";
+    EXPECT_TRUE(io::WriteOctreeToBIN(file_name, octree, true));
+    geometry::Octree dst_octree;
+    EXPECT_TRUE(io::ReadOctree(file_name, dst_octree));
+    std::vector<int> indices, ref_indices;
+    std::vector<double> distance2, ref_distance2;
+    octree.SearchKNN(Eigen::Vector3d(0.1, 0.2, 0.3), 5, ref_indices,
+                     ref_distance2);
+    dst_octree.SearchKNN(Eigen::Vector3d(0.1, 0.2, 0.3), 5, indices,
+                         distance2);
+    EXPECT_EQ(indices, ref_indices);
+    ExpectEQ(distance2, ref_distance2);
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
+
+TEST(OctreeIO, BinFileIOTopLevels) {
+    // Seven cubes, a depth 1 tree whose root has seven leaf children
+    geometry::Octree octree(1, Eigen::Vector3d(0, 0, 0), 2);
+    for (int i = 0; i < 7; ++i) {
+        Eigen::Vector3d point(i % 2 + 0.5, (i / 2) % 2 + 0.5, i / 4 + 0.5);
+        Eigen::Vector3d color = Eigen::Vector3d(i % 2, (i / 2) % 2, i / 4);
+        octree.InsertPoint(
+                point, geometry::OctreeColorLeafNode::GetInitFunction(),
+                geometry::OctreeColorLeafNode::GetUpdateFunction(color));
+    }
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_octree.bin";
+    EXPECT_TRUE(io::WriteOctreeToBIN(file_name, octree));
+
+    geometry::Octree full_octree;
+    EXPECT_TRUE(io::ReadOctreeFromBIN(file_name, full_octree, 5));
+    EXPECT_TRUE(full_octree == octree);
+
+    // The root becomes a leaf with the mean color of the seven cubes
+    geometry::Octree top_octree;
+    EXPECT_TRUE(io::ReadOctreeFromBIN(file_name, top_octree, 0));
+    EXPECT_EQ(top_octree.max_depth_, 0u);
+    ExpectEQ(top_octree.origin_, octree.origin_);
+    auto leaf_node = std::dynamic_pointer_cast<geometry::OctreeColorLeafNode>(
+            top_octree.root_node_);
+    ASSERT_TRUE(leaf_node != nullptr);
+    // Each color channel is 1 for three of the seven cubes: round(255 * 3 / 7)
+    Eigen::Vector3d mean_color = Eigen::Vector3d(109, 109, 109) / 255.0;
+    ExpectEQ(leaf_node->color_, mean_color);
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
+
+TEST(OctreeIO, BinFileIOEmptyInternalNode) {
+    // An internal node without leaves has no mean color
+    geometry::Octree octree(2, Eigen::Vector3d(0, 0, 0), 2);
+    octree.root_node_ = std::make_shared<geometry::OctreeInternalNode>();
+    WriteReadAndAssertEqual(octree, true, "bin");
+}
+
+TEST(OctreeIO, BinFileIOCorruptPointCount) {
+    geometry::Octree octree(0, Eigen::Vector3d(-1, -1, -1), 2);
+    Eigen::Vector3d point(0, 0, 0);
+    octree.InsertPoint(point,
+                       geometry::OctreePointColorLeafNode::GetInitFunction(),
+                       geometry::OctreePointColorLeafNode::GetUpdateFunction(
+                               0, point, Eigen::Vector3d(0, 0.1, 0.2)));
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_octree.bin";
+    EXPECT_TRUE(io::WriteOctreeToBIN(file_name, octree, false));
+
+    // The point count of the root leaf follows the 48 byte header, the block
+    // sizes and the leaf color
+    const long offset = 48 + 2 * sizeof(uint32_t) + 3 * sizeof(double);
+    FILE* file = fopen(file_name.c_str(), "r+b");
+    ASSERT_TRUE(file != nullptr);
+    uint32_t num_points = 0;
+    fseek(file, offset, SEEK_SET);
+    EXPECT_EQ(fread(&num_points, sizeof(uint32_t), 1, file), 1u);
+    EXPECT_EQ(num_points, 1u);
+    num_points = 0xffffffff;
+    fseek(file, offset, SEEK_SET);
+    EXPECT_EQ(fwrite(&num_points, sizeof(uint32_t), 1, file), 1u);
+    fclose(file);
+
+    geometry::Octree dst_octree;
+    EXPECT_FALSE(io::ReadOctree(file_name, dst_octree));
+    EXPECT_TRUE(dst_octree.root_node_ == nullptr);
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+}
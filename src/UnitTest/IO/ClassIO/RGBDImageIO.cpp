@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/RGBDImageIO.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+void GetRGBDFilenames(int num_of_frames,
+                      vector<string>& color_filenames,
+                      vector<string>& depth_filenames) {
+    const string dir = string(TEST_DATA_DIR) + "/RGBD/";
+    for (int i = 0; i < num_of_frames; i++) {
+        const string index = "0000" + to_string(i % 5);
+        color_filenames.push_back(dir + "color/" + index + ".jpg");
+        depth_filenames.push_back(dir + "depth/" + index + ".png");
+    }
+}
+
+}  // unnamed namespace
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(RGBDImageIO, CreateRGBDImageFromFiles) {
+    vector<string> color_filenames, depth_filenames;
+    GetRGBDFilenames(1, color_filenames, depth_filenames);
+
+    auto rgbd = io::CreateRGBDImageFromFiles(color_filenames[0],
+                                             depth_filenames[0], 1000.0, 4.0);
+    geometry::Image color, depth;
+    ASSERT_TRUE(io::ReadImage(color_filenames[0], color));
+    ASSERT_TRUE(io::ReadImage(depth_filenames[0], depth));
+    auto ref = geometry::CreateRGBDImageFromColorAndDepth(color, depth, 1000.0,
+                                                          4.0);
+    ExpectEQ(ref->color_.data_, rgbd->color_.data_);
+    ExpectEQ(ref->depth_.data_, rgbd->depth_.data_);
+
+    rgbd = io::CreateRGBDImageFromFiles(color_filenames[0], "missing.png");
+    EXPECT_TRUE(rgbd->color_.IsEmpty());
+    EXPECT_TRUE(rgbd->depth_.IsEmpty());
+}
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(RGBDImageIO, RGBDImageSequenceReader) {
+    vector<string> color_filenames, depth_filenames;
+    GetRGBDFilenames(12, color_filenames, depth_filenames);
+    color_filenames[7] = "missing.jpg";
+
+    vector<shared_ptr<geometry::RGBDImage>> refs;
+    for (size_t i = 0; i < color_filenames.size(); i++) {
+        refs.push_back(io::CreateRGBDImageFromFiles(
+                color_filenames[i], depth_filenames[i], 1000.0, 4.0, false));
+    }
+
+    for (int num_of_threads : {1, 3}) {
+        io::RGBDImageSequenceReader reader(color_filenames, depth_filenames,
+                                           1000.0, 4.0, false, 2,
+                                           num_of_threads);
+        EXPECT_EQ(refs.size(), reader.GetNumOfFrames());
+        for (size_t i = 0; i < refs.size(); i++) {
+            EXPECT_TRUE(reader.HasNext());
+            auto rgbd = reader.ReadNext();
+            ASSERT_NE(nullptr, rgbd);
+            EXPECT_EQ(refs[i]->color_.num_of_channels_,
+                      rgbd->color_.num_of_channels_);
+            ExpectEQ(refs[i]->color_.data_, rgbd->color_.data_);
+            ExpectEQ(refs[i]->depth_.data_, rgbd->depth_.data_);
+        }
+        EXPECT_FALSE(reader.HasNext());
+        EXPECT_EQ(nullptr, reader.ReadNext());
+    }
+
+    // Frames left unread when the reader is destroyed.
+    io::RGBDImageSequenceReader reader(color_filenames, depth_filenames);
+    EXPECT_NE(nullptr, reader.ReadNext());
+}
@@ -24,8 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -58,3 +64,40 @@ TEST(TriangleMeshIO, DISABLED_ReadTriangleMeshFromPLY) {
 TEST(TriangleMeshIO, DISABLED_WriteTriangleMeshToPLY) {
     unit_test::NotImplemented();
 }
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(TriangleMeshIO, SimplifyVertexClusteringFromPLY) {
+    // Place the mesh such that the voxel grid of SimplifyVertexClustering,
+    // which starts at min_bound - voxel_size / 2, is anchored at the origin.
+    double voxel_size = 0.5;
+    auto input = geometry::SubdivideMidpoint(*geometry::CreateMeshBox(), 2);
+    input->Translate(Eigen::Vector3d(0.25, 0.25, 0.25));
+    input->PaintUniformColor(Eigen::Vector3d(0.2, 0.4, 0.6));
+    auto expected = geometry::SimplifyVertexClustering(*input, voxel_size);
+
+    std::string input_name =
+            std::string(TEST_DATA_DIR) + "/temp_simplify_input.ply";
+    std::string output_name =
+            std::string(TEST_DATA_DIR) + "/temp_simplify_output.ply";
+    EXPECT_TRUE(io::WriteTriangleMeshToPLY(input_name, *input));
+    EXPECT_TRUE(io::SimplifyVertexClusteringFromPLY(input_name, output_name,
+                                                    voxel_size));
+
+    geometry::TriangleMesh output;
+    EXPECT_TRUE(io::ReadTriangleMeshFromPLY(output_name, output));
+    ExpectEQ(expected->vertices_, output.vertices_);
+    ExpectEQ(expected->triangles_, output.triangles_);
+    ExpectEQ(expected->vertex_colors_, output.vertex_colors_, 1.0 / 255.0);
+
+    EXPECT_TRUE(io::SimplifyVertexClusteringFromPLY(
+            input_name, output_name, voxel_size,
+            geometry::TriangleMesh::SimplificationContraction::Quadric));
+    EXPECT_TRUE(io::ReadTriangleMeshFromPLY(output_name, output));
+    EXPECT_EQ(expected->vertices_.size(), output.vertices_.size());
+    EXPECT_EQ(expected->triangles_.size(), output.triangles_.size());
+
+    EXPECT_EQ(std::remove(input_name.c_str()), 0);
+    EXPECT_EQ(std::remove(output_name.c_str()), 0);
+}
@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Integration/OccupancyVolume.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+geometry::Image CreateConstantDepth(int width, int height, float depth) {
+    geometry::Image image;
+    image.PrepareImage(width, height, 1, 4);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *geometry::PointerAt<float>(image, u, v) = depth;
+        }
+    }
+    return image;
+}
+
+}  // namespace
+
+TEST(OccupancyVolume, Integrate) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50, 50, 31.5, 23.5);
+    geometry::Image depth = CreateConstantDepth(64, 48, 2.05f);
+    // The camera at (0, 0, -1) looks at a wall at z = 1.05.
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(2, 3) = 1.0;
+
+    integration::OccupancyVolume volume(0.1);
+    volume.Integrate(depth, intrinsic, extrinsic);
+    volume.Integrate(depth, intrinsic, extrinsic);
+
+    auto occupied = volume.ExtractOccupied();
+    ASSERT_TRUE(occupied->HasVoxels());
+    for (const auto& voxel : occupied->voxels_) {
+        EXPECT_EQ(voxel.grid_index_(2), 10);
+        EXPECT_GT(voxel.color_(0), 0.5);
+    }
+    // The image sees the wall within [-1.29, 1.29] x [-0.96, 0.96].
+    EXPECT_TRUE(occupied->HasVoxel(Eigen::Vector3i(0, 0, 10)));
+    EXPECT_TRUE(occupied->HasVoxel(Eigen::Vector3i(-7, -5, 10)));
+    EXPECT_TRUE(occupied->HasVoxel(Eigen::Vector3i(6, 4, 10)));
+
+    EXPECT_GT(volume.GetOccupancyProbability({0.05, 0.05, 1.05}), 0.5);
+    EXPECT_LT(volume.GetOccupancyProbability({0.05, 0.05, 0.5}), 0.5);
+    EXPECT_LT(volume.GetOccupancyProbability({0.05, 0.05, -0.95}), 0.5);
+    EXPECT_EQ(volume.GetOccupancyProbability({0.05, 0.05, 1.5}), 0.5);
+    EXPECT_EQ(volume.GetOccupancyProbability({2.05, 0.05, 0.5}), 0.5);
+
+    // The log-odds are clamped.
+    for (int i = 0; i < 20; i++) {
+        volume.Integrate(depth, intrinsic, extrinsic);
+    }
+    EXPECT_NEAR(volume.GetOccupancyProbability({0.05, 0.05, 1.05}), 0.97,
+                1e-6);
+    EXPECT_NEAR(volume.GetOccupancyProbability({0.05, 0.05, 0.5}), 0.12,
+                1e-6);
+
+    volume.Reset();
+    EXPECT_FALSE(volume.ExtractOccupied()->HasVoxels());
+}
+
+TEST(OccupancyVolume, MaxRange) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50, 50, 31.5, 23.5);
+    geometry::Image depth = CreateConstantDepth(64, 48, 2.05f);
+    integration::OccupancyVolume volume(0.1, 1.0);
+    volume.Integrate(depth, intrinsic, Eigen::Matrix4d::Identity());
+    EXPECT_FALSE(volume.ExtractOccupied()->HasVoxels());
+    EXPECT_LT(volume.GetOccupancyProbability({0.05, 0.05, 0.75}), 0.5);
+    EXPECT_EQ(volume.GetOccupancyProbability({0.05, 0.05, 1.25}), 0.5);
+}
+
+TEST(OccupancyVolume, Carving) {
+    // An obstacle seen once and then replaced by free space vanishes.
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50, 50, 31.5, 23.5);
+    integration::OccupancyVolume volume(0.1);
+    volume.Integrate(CreateConstantDepth(64, 48, 1.05f), intrinsic,
+                     Eigen::Matrix4d::Identity());
+    EXPECT_GT(volume.GetOccupancyProbability({0.05, 0.05, 1.05}), 0.5);
+    for (int i = 0; i < 3; i++) {
+        volume.Integrate(CreateConstantDepth(64, 48, 2.05f), intrinsic,
+                         Eigen::Matrix4d::Identity());
+    }
+    EXPECT_LT(volume.GetOccupancyProbability({0.05, 0.05, 1.05}), 0.5);
+    EXPECT_GT(volume.GetOccupancyProbability({0.05, 0.05, 2.05}), 0.5);
+
+    // Invalid depth images are rejected.
+    geometry::Image wrong;
+    wrong.PrepareImage(64, 48, 1, 2);
+    volume.Reset();
+    volume.Integrate(wrong, intrinsic, Eigen::Matrix4d::Identity());
+    EXPECT_TRUE(volume.log_odds_.empty());
+}
+
+TEST(OccupancyVolume, OutOfRange) {
+    // Voxels farther than 2^20 voxels from the origin can't be represented
+    // and are not updated rather than aliasing other voxels.
+    camera::PinholeCameraIntrinsic intrinsic(4, 3, 2, 2, 1.5, 1.0);
+    integration::OccupancyVolume volume(1e-6);
+    volume.Integrate(CreateConstantDepth(4, 3, 2.0f), intrinsic,
+                     Eigen::Matrix4d::Identity());
+    EXPECT_TRUE(volume.log_odds_.empty());
+
+    integration::OccupancyVolume far_volume(0.1);
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(0, 3) = -2e5;
+    far_volume.Integrate(CreateConstantDepth(4, 3, 1.0f), intrinsic,
+                         extrinsic);
+    EXPECT_TRUE(far_volume.log_odds_.empty());
+}
@@ -24,8 +24,18 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Integration/ScalableTSDFVolume.h"
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Integration/UniformTSDFVolume.h"
 #include "TestUtility/UnitTest.h"
 
+#include <unordered_set>
+
+using namespace open3d;
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
@@ -54,7 +64,82 @@ TEST(ScalableTSDFVolume, DISABLED_Reset) { unit_test::NotImplemented(); }
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
-TEST(ScalableTSDFVolume, DISABLED_Integrate) { unit_test::NotImplemented(); }
+TEST(ScalableTSDFVolume, Integrate) {
+    geometry::Image color;
+    geometry::Image depth;
+    io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/color/00000.jpg", color);
+    io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/depth/00000.png", depth);
+    auto rgbd = geometry::CreateRGBDImageFromColorAndDepth(color, depth, 1000.0,
+                                                           4.0, false);
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(2, 3) = 0.1;
+
+    double voxel_length = 0.02;
+    double sdf_trunc = 0.06;
+    integration::ScalableTSDFVolume volume(
+            voxel_length, sdf_trunc, integration::TSDFVolumeColorType::RGB8);
+    volume.Integrate(*rgbd, intrinsic, extrinsic);
+
+    // The touched units are those within sdf_trunc of the subsampled depth
+    // points.
+    double unit_length = volume.volume_unit_length_;
+    auto points = geometry::CreatePointCloudFromDepthImage(
+            rgbd->depth_, intrinsic, extrinsic, 1000.0, 1000.0,
+            volume.depth_sampling_stride_);
+    std::unordered_set<Eigen::Vector3i,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            touched;
+    for (const Eigen::Vector3d& point : points->points_) {
+        Eigen::Vector3d p0 = point.array() - sdf_trunc;
+        Eigen::Vector3d p1 = point.array() + sdf_trunc;
+        for (int x = int(floor(p0(0) / unit_length));
+             x <= int(floor(p1(0) / unit_length)); x++) {
+            for (int y = int(floor(p0(1) / unit_length));
+                 y <= int(floor(p1(1) / unit_length)); y++) {
+                for (int z = int(floor(p0(2) / unit_length));
+                     z <= int(floor(p1(2) / unit_length)); z++) {
+                    touched.insert(Eigen::Vector3i(x, y, z));
+                }
+            }
+        }
+    }
+    EXPECT_LT(0u, touched.size());
+    ASSERT_EQ(touched.size(), volume.volume_units_.size());
+
+    // Each unit holds the integration of the frame into a uniform volume.
+    auto multiplier =
+            geometry::CreateDepthToCameraDistanceMultiplierFloatImage(
+                    intrinsic);
+    int num_of_mismatches = 0;
+    for (const auto& unit : volume.volume_units_) {
+        ASSERT_EQ(1u, touched.count(unit.first));
+        ASSERT_NE(nullptr, unit.second.volume_);
+        unit_test::ExpectEQ(unit.first, unit.second.index_);
+        integration::UniformTSDFVolume reference(
+                unit_length, volume.volume_unit_resolution_, sdf_trunc,
+                integration::TSDFVolumeColorType::RGB8,
+                unit.first.cast<double>() * unit_length);
+        reference.IntegrateWithDepthToCameraDistanceMultiplier(
+                *rgbd, intrinsic, extrinsic, *multiplier);
+        const auto& voxels = unit.second.volume_->voxel_grid_.voxels_;
+        const auto& reference_voxels = reference.voxel_grid_.voxels_;
+        ASSERT_EQ(reference_voxels.size(), voxels.size());
+        for (size_t i = 0; i < voxels.size(); i++) {
+            if (voxels[i].tsdf_ != reference_voxels[i].tsdf_ ||
+                voxels[i].weight_ != reference_voxels[i].weight_ ||
+                voxels[i].color_ != reference_voxels[i].color_) {
+                num_of_mismatches++;
+            }
+        }
+    }
+    EXPECT_EQ(0, num_of_mismatches);
+
+    // Integrating again reuses the units.
+    volume.Integrate(*rgbd, intrinsic, extrinsic);
+    EXPECT_EQ(touched.size(), volume.volume_units_.size());
+}
 
 // ----------------------------------------------------------------------------
 //
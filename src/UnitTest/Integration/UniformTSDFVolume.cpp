@@ -26,6 +26,7 @@
 
 #include "Open3D/Integration/UniformTSDFVolume.h"
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/DistanceField.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/IO/ClassIO/ImageIO.h"
 #include "Open3D/Visualization/Utility/DrawGeometry.h"
@@ -164,6 +165,14 @@ TEST(UniformTSDFVolume, RealData) {
     // Uncomment to visualize
     // visualization::DrawGeometries({mesh});
 
+    // The signed distance field vanishes on the surface.
+    std::shared_ptr<geometry::DistanceField> field =
+            tsdf_volume.ExtractDistanceField();
+    for (const Eigen::Vector3d& vertex : mesh->vertices_) {
+        EXPECT_LT(std::abs(field->GetDistance(vertex)),
+                  tsdf_volume.voxel_length_);
+    }
+
     // Extract point cloud
     std::shared_ptr<geometry::PointCloud> pcd = tsdf_volume.ExtractPointCloud();
     EXPECT_EQ(pcd->points_.size(), 2227);
@@ -194,6 +203,37 @@ TEST(UniformTSDFVolume, RealData) {
              /*threshold*/ 0.1);
 }
 
+TEST(UniformTSDFVolume, ExtractDistanceFieldSolid) {
+    // The camera at the origin sees the face z = 0.5 of a solid box filling
+    // the far half of the volume, far thicker than sdf_trunc.
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50, 50, 31.5, 23.5);
+    geometry::Image color;
+    color.PrepareImage(64, 48, 3, 1);
+    geometry::Image depth;
+    depth.PrepareImage(64, 48, 1, 2);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            *geometry::PointerAt<uint16_t>(depth, u, v) = 500;
+        }
+    }
+    std::shared_ptr<geometry::RGBDImage> rgbd =
+            geometry::CreateRGBDImageFromColorAndDepth(color, depth);
+    integration::UniformTSDFVolume tsdf_volume(
+            1.0, 50, 0.04, integration::TSDFVolumeColorType::None,
+            Eigen::Vector3d(-0.5, -0.5, 0.0));
+    tsdf_volume.Integrate(*rgbd, intrinsic, Eigen::Matrix4d::Identity());
+
+    // The unobserved interior of the box is inside, the unobserved space
+    // beside the view frustum outside.
+    std::shared_ptr<geometry::DistanceField> field =
+            tsdf_volume.ExtractDistanceField();
+    EXPECT_NEAR(field->GetDistance(Eigen::Vector3d(0, 0, 0.3)), 0.2, 0.02);
+    EXPECT_NEAR(field->GetDistance(Eigen::Vector3d(0, 0, 0.5)), 0.0, 0.02);
+    EXPECT_NEAR(field->GetDistance(Eigen::Vector3d(0, 0, 0.8)), -0.3, 0.02);
+    EXPECT_LT(field->GetDistance(Eigen::Vector3d(0.2, -0.1, 0.95)), -0.3);
+    EXPECT_GT(field->GetDistance(Eigen::Vector3d(0.45, 0, 0.1)), 0.0);
+}
+
 TEST(UniformTSDFVolume, DISABLED_Destructor) {}
 
 TEST(UniformTSDFVolume, DISABLED_MemberData) {}
@@ -24,9 +24,27 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Utility/Helper.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 // ----------------------------------------------------------------------------
 //
 // ----------------------------------------------------------------------------
 TEST(Helper, DISABLED_SplitString) { unit_test::NotImplemented(); }
+
+// ----------------------------------------------------------------------------
+//
+// ----------------------------------------------------------------------------
+TEST(Helper, ParallelSort) {
+    std::vector<int> values(100000);
+    Rand(values, -1000, 1000, 0);
+    std::vector<int> ref = values;
+    std::sort(ref.begin(), ref.end());
+
+    utility::ParallelSort(values.begin(), values.end(),
+                          [](int a, int b) { return a < b; });
+    ExpectEQ(ref, values);
+}